@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -36,6 +37,45 @@ struct DefaultConnect {
   ConnectResult operator()(const Cell& ref, const Cell& iter);
 };
 
+/// @brief Union-find structure recording label equivalences
+///
+/// Labels are handed out consecutively starting at 1 (0 is reserved for
+/// NO_LABEL). The storage keeps its capacity when cleared, so that a single
+/// instance can be reused to label many modules without reallocating.
+class DisjointSets {
+ public:
+  /// @param initialSize number of labels to reserve storage for
+  DisjointSets(size_t initialSize = 128);
+
+  /// Forget all labels but keep the allocated storage
+  void clear();
+
+  /// Allocate a new label in its own set
+  Label makeSet();
+
+  /// Merge the sets containing the two labels
+  void unionSet(Label x, Label y);
+
+  /// Find the representative (smallest) label of the set containing x
+  Label findSet(Label x);
+
+  /// Replace the equivalences by dense labels in [1, N], one per set
+  ///
+  /// After this call, only compactLabel may be used until the next clear.
+  ///
+  /// @return the number of sets N
+  size_t compact();
+
+  /// The dense label of x, only valid after compact
+  Label compactLabel(Label x) const { return m_parent[x]; }
+
+  /// Number of labels allocated since the last clear
+  size_t size() const { return m_parent.size() - 1; }
+
+ private:
+  std::vector<Label> m_parent;
+};
+
 /// @brief labelClusters
 ///
 /// In-place connected component labelling using the Hoshen-Kopelman algorithm.
@@ -50,6 +90,23 @@ template <typename CellCollection, typename Connect = DefaultConnect<
                                        typename CellCollection::value_type>>
 void labelClusters(CellCollection& cells, Connect connect = Connect());
 
+/// @brief labelSortedClusters
+///
+/// Raster-scan variant of labelClusters for cell collections that are
+/// already ordered column-wise, i.e. by column and then by row. The cells
+/// are not sorted and the equivalence storage of @p ds is reused, which makes
+/// this suitable for labelling many modules in a row. After the call the
+/// labels are dense, i.e. every cell carries a label in [1, N].
+///
+/// @param [in] cells the column-wise ordered cell collection to be labeled
+/// @param [in] ds the union-find workspace, cleared before use
+/// @param [in] connect the connection type (see DefaultConnect)
+/// @return the number of clusters N
+template <typename CellCollection, typename Connect = DefaultConnect<
+                                       typename CellCollection::value_type>>
+size_t labelSortedClusters(CellCollection& cells, DisjointSets& ds,
+                           Connect connect = Connect());
+
 /// @brief mergeClusters
 ///
 /// Merge a set of cells previously labeled (for instance with `labelClusters`)
@@ -70,6 +127,24 @@ template <
 ClusterCollection createClusters(CellCollection& cells,
                                  Connect connect = Connect());
 
+/// @brief createClustersBatch
+///
+/// Run the clusterization on a collection of modules, each given as a
+/// separate cell collection, sharing a single union-find workspace between
+/// them. If @p sorted is true the cells of each module are assumed to be
+/// ordered column-wise already and the sort is skipped.
+///
+/// @param [in] modules the cell collections, one per module
+/// @param [in] connect the connection type (see DefaultConnect)
+/// @param [in] sorted whether the cells are already ordered column-wise
+/// @return one cluster collection per module, in input order
+template <typename ModuleCollection, typename ClusterCollection,
+          typename Connect = DefaultConnect<
+              typename ModuleCollection::value_type::value_type>>
+std::vector<ClusterCollection> createClustersBatch(ModuleCollection& modules,
+                                                   Connect connect = Connect(),
+                                                   bool sorted = false);
+
 }  // namespace Ccl
 }  // namespace Acts
 
@@ -6,13 +6,62 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <array>
+#include <stdexcept>
 #include <vector>
 
-#include <boost/pending/disjoint_sets.hpp>
-
 namespace Acts {
 namespace Ccl {
+
+inline DisjointSets::DisjointSets(size_t initialSize) {
+  m_parent.reserve(initialSize + 1);
+  m_parent.push_back(NO_LABEL);
+}
+
+inline void DisjointSets::clear() {
+  m_parent.resize(1);
+}
+
+inline Label DisjointSets::makeSet() {
+  Label lbl = static_cast<Label>(m_parent.size());
+  m_parent.push_back(lbl);
+  return lbl;
+}
+
+inline void DisjointSets::unionSet(Label x, Label y) {
+  x = findSet(x);
+  y = findSet(y);
+  // Always keep the smaller label as root, such that the root of a set is
+  // the label of the first cell encountered in the scan
+  if (x < y) {
+    m_parent[y] = x;
+  } else {
+    m_parent[x] = y;
+  }
+}
+
+inline Label DisjointSets::findSet(Label x) {
+  // Path halving
+  while (m_parent[x] != x) {
+    m_parent[x] = m_parent[m_parent[x]];
+    x = m_parent[x];
+  }
+  return x;
+}
+
+inline size_t DisjointSets::compact() {
+  // Parents are never larger than their children, so going through the
+  // labels in increasing order the parent of a label has always been
+  // compacted already, and the parent entry can be overwritten in-place
+  Label nSets = 0;
+  for (Label lbl = 1; lbl < static_cast<Label>(m_parent.size()); ++lbl) {
+    Label parent = m_parent[lbl];
+    m_parent[lbl] = (parent == lbl) ? ++nSets : m_parent[parent];
+  }
+  return static_cast<size_t>(nSets);
+}
+
 namespace internal {
 
 // Machinery for validating generic Cell/Cluster types at compile-time
@@ -68,42 +117,6 @@ struct Compare {
   }
 };
 
-// Simple wrapper around boost::disjoint_sets. In theory, could use
-// boost::vector_property_map and use boost::disjoint_sets without
-// wrapping, but it's way slower
-class DisjointSets {
- public:
-  DisjointSets(size_t initial_size = 128)
-      : m_globalId(1),
-        m_size(initial_size),
-        m_rank(m_size),
-        m_parent(m_size),
-        m_ds(&m_rank[0], &m_parent[0]) {}
-
-  Label makeSet() {
-    // Empirically, m_size = 128 seems to be good default. If we
-    // exceed this, take a performance hit and do the right thing.
-    while (m_globalId >= m_size) {
-      m_size *= 2;
-      m_rank.resize(m_size);
-      m_parent.resize(m_size);
-      m_ds = boost::disjoint_sets<size_t*, size_t*>(&m_rank[0], &m_parent[0]);
-    }
-    m_ds.make_set(m_globalId);
-    return static_cast<Label>(m_globalId++);
-  }
-
-  void unionSet(size_t x, size_t y) { m_ds.union_set(x, y); }
-  Label findSet(size_t x) { return static_cast<Label>(m_ds.find_set(x)); }
-
- private:
-  size_t m_globalId;
-  size_t m_size;
-  std::vector<size_t> m_rank;
-  std::vector<size_t> m_parent;
-  boost::disjoint_sets<size_t*, size_t*> m_ds;
-};
-
 // Cell collection logic
 template <typename Cell, typename Connect>
 int getConnections(typename std::vector<Cell>::iterator it,
@@ -133,6 +146,17 @@ int getConnections(typename std::vector<Cell>::iterator it,
   return nconn;
 }
 
+// Merge cells carrying dense labels in [1, nClusters] into clusters,
+// without sorting
+template <typename CellCollection, typename ClusterCollection>
+ClusterCollection mergeDenseClusters(CellCollection& cells, size_t nClusters) {
+  ClusterCollection outv(nClusters);
+  for (auto& cell : cells) {
+    clusterAddCell(outv[getCellLabel(cell) - 1], cell);
+  }
+  return outv;
+}
+
 }  // namespace internal
 
 template <typename Cell>
@@ -145,8 +169,13 @@ ConnectResult DefaultConnect<Cell>::operator()(const Cell& a, const Cell& b) {
     return ConnectResult::eNoConnStop;
   }
   // For same reason, if too far in row we know the pixel is not
-  // connected, but need to keep iterating
+  // connected, but need to keep iterating. The only exception is the
+  // previous column: it is sorted row-wise too, so once we are below
+  // the reference cell no further connection is possible
   if (deltaRow > 1) {
+    if (deltaCol == 1 and getCellRow(b) < getCellRow(a)) {
+      return ConnectResult::eNoConnStop;
+    }
     return ConnectResult::eNoConn;
   }
   // Decide whether or not cluster is connected based on 4- or
@@ -158,16 +187,14 @@ ConnectResult DefaultConnect<Cell>::operator()(const Cell& a, const Cell& b) {
 }
 
 template <typename CellCollection, typename Connect>
-void labelClusters(CellCollection& cells, Connect connect) {
+size_t labelSortedClusters(CellCollection& cells, DisjointSets& ds,
+                           Connect connect) {
   using Cell = typename CellCollection::value_type;
   internal::staticCheckCellType<Cell>();
 
-  internal::DisjointSets ds{};
+  ds.clear();
   std::array<Label, 4> seen = {NO_LABEL, NO_LABEL, NO_LABEL, NO_LABEL};
 
-  // Sort cells by position to enable in-order scan
-  std::sort(cells.begin(), cells.end(), internal::Compare<Cell>());
-
   // First pass: Allocate labels and record equivalences
   for (auto it = cells.begin(); it != cells.end(); ++it) {
     int nconn =
@@ -194,10 +221,24 @@ void labelClusters(CellCollection& cells, Connect connect) {
   }
 
   // Second pass: Merge labels based on recorded equivalences
+  size_t nClusters = ds.compact();
   for (auto& cell : cells) {
     Label& lbl = getCellLabel(cell);
-    lbl = ds.findSet(lbl);
+    lbl = ds.compactLabel(lbl);
   }
+  return nClusters;
+}
+
+template <typename CellCollection, typename Connect>
+void labelClusters(CellCollection& cells, Connect connect) {
+  using Cell = typename CellCollection::value_type;
+  internal::staticCheckCellType<Cell>();
+
+  DisjointSets ds{};
+
+  // Sort cells by position to enable in-order scan
+  std::sort(cells.begin(), cells.end(), internal::Compare<Cell>());
+  labelSortedClusters<CellCollection, Connect>(cells, ds, connect);
 }
 
 template <typename CellCollection, typename ClusterCollection>
@@ -241,8 +282,40 @@ ClusterCollection createClusters(CellCollection& cells, Connect connect) {
   using Cluster = typename ClusterCollection::value_type;
   internal::staticCheckCellType<Cell>();
   internal::staticCheckClusterType<Cluster&, const Cell&>();
-  labelClusters<CellCollection, Connect>(cells, connect);
-  return mergeClusters<CellCollection, ClusterCollection>(cells);
+
+  DisjointSets ds{};
+  std::sort(cells.begin(), cells.end(), internal::Compare<Cell>());
+  size_t nClusters =
+      labelSortedClusters<CellCollection, Connect>(cells, ds, connect);
+  return internal::mergeDenseClusters<CellCollection, ClusterCollection>(
+      cells, nClusters);
+}
+
+template <typename ModuleCollection, typename ClusterCollection,
+          typename Connect>
+std::vector<ClusterCollection> createClustersBatch(ModuleCollection& modules,
+                                                   Connect connect,
+                                                   bool sorted) {
+  using CellCollection = typename ModuleCollection::value_type;
+  using Cell = typename CellCollection::value_type;
+  using Cluster = typename ClusterCollection::value_type;
+  internal::staticCheckCellType<Cell>();
+  internal::staticCheckClusterType<Cluster&, const Cell&>();
+
+  DisjointSets ds{};
+  std::vector<ClusterCollection> outv;
+  outv.reserve(modules.size());
+  for (CellCollection& cells : modules) {
+    if (not sorted) {
+      std::sort(cells.begin(), cells.end(), internal::Compare<Cell>());
+    }
+    size_t nClusters =
+        labelSortedClusters<CellCollection, Connect>(cells, ds, connect);
+    outv.push_back(
+        internal::mergeDenseClusters<CellCollection, ClusterCollection>(
+            cells, nClusters));
+  }
+  return outv;
 }
 
 }  // namespace Ccl
@@ -137,6 +137,21 @@ class BoundarySurfaceT {
   void attachVolumeArray(std::shared_ptr<const VolumeArray> volumes,
                          NavigationDirection navDir);
 
+  /// The single volume attached in the given direction
+  ///
+  /// @param navDir The navigation direction w.r.t. the surface normal
+  ///
+  /// @return The attached volume, nullptr if there is none
+  const volume_t* attachedVolume(NavigationDirection navDir) const;
+
+  /// The volume array attached in the given direction
+  ///
+  /// @param navDir The navigation direction w.r.t. the surface normal
+  ///
+  /// @return The attached volume array, nullptr if there is none
+  std::shared_ptr<const VolumeArray> attachedVolumeArray(
+      NavigationDirection navDir) const;
+
  protected:
   /// the represented surface by this
   std::shared_ptr<const Surface> m_surface;
@@ -177,6 +192,21 @@ void BoundarySurfaceT<volume_t>::attachVolumeArray(
   }
 }
 
+template <class volume_t>
+const volume_t* BoundarySurfaceT<volume_t>::attachedVolume(
+    NavigationDirection navDir) const {
+  return navDir == NavigationDirection::Backward ? m_oppositeVolume
+                                                 : m_alongVolume;
+}
+
+template <class volume_t>
+std::shared_ptr<const typename BoundarySurfaceT<volume_t>::VolumeArray>
+BoundarySurfaceT<volume_t>::attachedVolumeArray(
+    NavigationDirection navDir) const {
+  return navDir == NavigationDirection::Backward ? m_oppositeVolumeArray
+                                                 : m_alongVolumeArray;
+}
+
 template <class volume_t>
 const volume_t* BoundarySurfaceT<volume_t>::attachedVolume(
     const GeometryContext& gctx, const Vector3& pos, const Vector3& mom,
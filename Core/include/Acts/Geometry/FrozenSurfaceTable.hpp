@@ -0,0 +1,148 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Acts {
+
+class TrackingGeometry;
+
+/// @class FrozenSurfaceTable
+///
+/// Compact, read-only snapshot of the placement and bounds of a set of
+/// surfaces for one fixed geometry context, e.g. the nominal geometry.
+///
+/// The rotations, translations and bound values of all surfaces are stored in
+/// contiguous arrays (structure-of-arrays) and the intersection and
+/// inside-bounds checks for plane, disc and cylinder surfaces are evaluated
+/// directly on these arrays, without going through the detector element and
+/// the virtual surface interface. All other surfaces, and bounds or boundary
+/// check types without a dedicated kernel, fall back to the regular `Surface`
+/// methods and give identical results.
+///
+/// Surfaces are addressed by their index in the table, which follows the
+/// ordering of their geometry identifiers.
+///
+/// @note The table is only valid as long as the surfaces and the geometry
+///   context it was built from do not change, i.e. it must be rebuilt after
+///   alignment updates.
+class FrozenSurfaceTable {
+ public:
+  /// Build the table for all sensitive surfaces of a tracking geometry
+  ///
+  /// @param gctx The geometry context to freeze the placements in
+  /// @param trackingGeometry The geometry providing the sensitive surfaces
+  FrozenSurfaceTable(const GeometryContext& gctx,
+                     const TrackingGeometry& trackingGeometry);
+
+  /// Build the table for an explicit list of surfaces
+  ///
+  /// @param gctx The geometry context to freeze the placements in
+  /// @param surfaces The surfaces, must not contain duplicated identifiers
+  FrozenSurfaceTable(const GeometryContext& gctx,
+                     std::vector<const Surface*> surfaces);
+
+  /// Number of surfaces in the table
+  size_t size() const { return m_surfaces.size(); }
+
+  /// Access the surface at a given index
+  const Surface& surface(size_t index) const { return *m_surfaces[index]; }
+
+  /// Find the table index of a surface by its identifier
+  ///
+  /// @param geoId The geometry identifier of the surface
+  /// @return the index, or size() if the surface is not in the table
+  size_t index(GeometryIdentifier geoId) const;
+
+  /// The frozen center of the surface at a given index
+  Vector3 center(size_t index) const;
+
+  /// The frozen rotation (local to global) of the surface at a given index
+  RotationMatrix3 rotation(size_t index) const;
+
+  /// Transform a global position into the local 3D cartesian frame
+  ///
+  /// @param index The table index of the surface
+  /// @param position The global position
+  Vector3 globalToLocal3D(size_t index, const Vector3& position) const;
+
+  /// Straight line intersection with the surface at a given index
+  ///
+  /// Equivalent to `Surface::intersect` in the frozen geometry context.
+  ///
+  /// @param index The table index of the surface
+  /// @param position The start position of the straight line
+  /// @param direction The direction of the straight line
+  /// @param bcheck The boundary check directive
+  SurfaceIntersection intersect(size_t index, const Vector3& position,
+                                const Vector3& direction,
+                                const BoundaryCheck& bcheck) const;
+
+  /// Check whether a local position is inside the bounds
+  ///
+  /// Equivalent to `Surface::insideBounds`.
+  ///
+  /// @param index The table index of the surface
+  /// @param lposition The local bound position, e.g. (r, phi) for discs
+  /// @param bcheck The boundary check directive
+  bool insideBounds(size_t index, const Vector2& lposition,
+                    const BoundaryCheck& bcheck) const;
+
+ private:
+  /// Which kernel is used for a surface
+  enum class Kernel : std::uint8_t {
+    /// Fall back to the surface implementation
+    eGeneric = 0,
+    /// Plane surface, bounds checked through the surface
+    ePlane = 1,
+    /// Plane surface with rectangle bounds
+    ePlaneRectangle = 2,
+    /// Disc surface, bounds checked through the surface
+    eDisc = 3,
+    /// Disc surface with full azimuth radial bounds
+    eDiscRadial = 4,
+    /// Cylinder surface with full azimuth coverage
+    eCylinder = 5,
+  };
+
+  /// Number of bound values stored per surface
+  static constexpr size_t s_nBoundValues = 4;
+
+  /// Fill the arrays from the sorted surfaces
+  void fill();
+
+  SurfaceIntersection intersectPlanar(size_t index, const Vector3& position,
+                                      const Vector3& direction,
+                                      const BoundaryCheck& bcheck) const;
+
+  SurfaceIntersection intersectCylinder(size_t index, const Vector3& position,
+                                        const Vector3& direction,
+                                        const BoundaryCheck& bcheck) const;
+
+  GeometryContext m_gctx;
+  std::vector<const Surface*> m_surfaces;
+  std::vector<GeometryIdentifier::Value> m_geoIds;
+  std::vector<Kernel> m_kernels;
+  // column-major 3x3 rotation (local to global) per surface
+  std::vector<ActsScalar> m_rotations;
+  // 3 translation components per surface
+  std::vector<ActsScalar> m_translations;
+  // kernel-dependent bound values per surface
+  std::vector<ActsScalar> m_bounds;
+};
+
+}  // namespace Acts
@@ -54,6 +54,14 @@ namespace Acts {
 ///   or index-based access. Any apparent ordering must be considered an
 ///   implementation detail and might change.
 ///
+/// For hot paths with a known, fixed set of query identifiers, e.g. all
+/// sensitive surfaces of a tracking geometry, the lookup can be compiled
+///
+///     container.compile(trackingGeometry);
+///
+/// which precomputes the result of `find` for each of these identifiers and
+/// resolves them afterwards with a single hash table probe.
+///
 /// Adding elements is potentially expensive as the internal lookup structure
 /// must be updated. In addition, modifying an element in-place could change its
 /// identifier which would also break the lookup. Thus, the container can not be
@@ -113,6 +121,26 @@ class GeometryHierarchyMap {
   /// @retval `.end()` iterator if no matching element exists
   Iterator find(GeometryIdentifier id) const;
 
+  /// Precompute the lookup results for a fixed set of geometry identifiers.
+  ///
+  /// Afterwards, `find` resolves each of the given identifiers in constant
+  /// time. Any other identifier still uses the regular hierarchy search.
+  /// Calling this again replaces the previously compiled identifiers.
+  ///
+  /// @param ids geometry identifiers that will be queried frequently
+  void compile(const std::vector<GeometryIdentifier>& ids);
+
+  /// Precompute the lookup results for all sensitive surfaces of a geometry.
+  ///
+  /// @tparam geometry_t geometry type with a `visitSurfaces` method, e.g.
+  ///   `TrackingGeometry`
+  /// @param geometry the geometry whose sensitive surfaces are compiled
+  template <typename geometry_t>
+  void compile(const geometry_t& geometry);
+
+  /// Check if the lookup has been compiled for any identifiers.
+  bool isCompiled() const { return not m_lookupKeys.empty(); }
+
  private:
   // NOTE this class assumes that it knows the ordering of the levels within
   //      the geometry id. if the geometry id changes, this code has to be
@@ -137,6 +165,22 @@ class GeometryHierarchyMap {
   // validity bit masks for the ids: which parts to use for comparison
   std::vector<Identifier> m_masks;
   std::vector<Value> m_values;
+  // open-addressing hash table for compiled identifiers. the slots store
+  // the value index, or the number of values if no element matches.
+  std::vector<Identifier> m_lookupKeys;
+  std::vector<Size> m_lookupIndices;
+
+  /// Marker for an unused slot in the compiled lookup table.
+  static constexpr Size kEmptySlot = ~Size(0u);
+
+  /// Hash table slot for an identifier given the table size (power of two).
+  static constexpr Size lookupSlot(Identifier id, Size nSlots) {
+    // fibonacci hashing; the high bits are the best mixed
+    return static_cast<Size>((id * Identifier(0x9E3779B97F4A7C15u)) >> 32u) &
+           (nSlots - 1u);
+  }
+  /// Search the hierarchy for the best matching element index.
+  Size findInHierarchy(GeometryIdentifier id) const;
 
   /// Construct a mask where all leading non-zero levels are set.
   static constexpr Identifier makeLeadingLevelsMask(GeometryIdentifier id) {
@@ -238,8 +282,8 @@ inline void GeometryHierarchyMap<value_t>::fill(iterator_t beg,
 }
 
 template <typename value_t>
-inline auto GeometryHierarchyMap<value_t>::find(GeometryIdentifier id) const
-    -> Iterator {
+inline auto GeometryHierarchyMap<value_t>::findInHierarchy(
+    GeometryIdentifier id) const -> Size {
   assert((m_ids.size() == m_values.size()) and
          "Inconsistent container state: #ids != # values");
   assert((m_masks.size() == m_values.size()) and
@@ -274,9 +318,9 @@ inline auto GeometryHierarchyMap<value_t>::find(GeometryIdentifier id) const
     if (not equalWithinMask(id.value(), m_ids[i], makeHighestLevelMask())) {
       // check if a global default entry exists
       if (m_ids.front() == Identifier(0u)) {
-        return begin();
+        return 0u;
       } else {
-        return end();
+        return m_ids.size();
       }
     }
 
@@ -284,12 +328,64 @@ inline auto GeometryHierarchyMap<value_t>::find(GeometryIdentifier id) const
     // progresses from more specific to less specific elements. the first
     // match is automatically the appropriate one.
     if (equalWithinMask(id.value(), m_ids[i], m_masks[i])) {
-      return std::next(begin(), i);
+      return i;
     }
   }
 
   // all options are exhausted and no matching element was found.
-  return end();
+  return m_ids.size();
+}
+
+template <typename value_t>
+inline auto GeometryHierarchyMap<value_t>::find(GeometryIdentifier id) const
+    -> Iterator {
+  if (not m_lookupKeys.empty()) {
+    const Size nSlots = m_lookupKeys.size();
+    Size slot = lookupSlot(id.value(), nSlots);
+    // linear probing until either the identifier or an empty slot is found
+    while (m_lookupIndices[slot] != kEmptySlot) {
+      if (m_lookupKeys[slot] == id.value()) {
+        return std::next(begin(), m_lookupIndices[slot]);
+      }
+      slot = (slot + 1u) & (nSlots - 1u);
+    }
+  }
+  return std::next(begin(), findInHierarchy(id));
+}
+
+template <typename value_t>
+inline void GeometryHierarchyMap<value_t>::compile(
+    const std::vector<GeometryIdentifier>& ids) {
+  // keep the load factor at or below one half to have short probe sequences
+  Size nSlots = 1u;
+  while (nSlots < 2u * ids.size()) {
+    nSlots *= 2u;
+  }
+  m_lookupKeys.clear();
+  m_lookupIndices.clear();
+  if (ids.empty()) {
+    return;
+  }
+  m_lookupKeys.resize(nSlots, Identifier(0u));
+  m_lookupIndices.resize(nSlots, kEmptySlot);
+  for (GeometryIdentifier id : ids) {
+    Size slot = lookupSlot(id.value(), nSlots);
+    while (m_lookupIndices[slot] != kEmptySlot and
+           m_lookupKeys[slot] != id.value()) {
+      slot = (slot + 1u) & (nSlots - 1u);
+    }
+    m_lookupKeys[slot] = id.value();
+    m_lookupIndices[slot] = findInHierarchy(id);
+  }
+}
+
+template <typename value_t>
+template <typename geometry_t>
+inline void GeometryHierarchyMap<value_t>::compile(const geometry_t& geometry) {
+  std::vector<GeometryIdentifier> ids;
+  geometry.visitSurfaces(
+      [&ids](const auto* surface) { ids.push_back(surface->geometryId()); });
+  compile(ids);
 }
 
 }  // namespace Acts
@@ -269,6 +269,69 @@ class SurfaceArrayCreator {
     return false;
   }
 
+  /// SurfaceArrayCreator helper method
+  /// @brief Creates a SurfaceGridLookup instance within an any
+  /// This is essentially a factory which absorbs some if/else logic
+  /// that is required by the templating.
+  /// @tparam bdtA AxisBoundaryType of axis A
+  /// @tparam bdtB AxisBoundaryType of axis B
+  /// @tparam F1 type-deducted value of g2l lambda
+  /// @tparam F2 type-deducted value of l2g lambda
+  /// @param globalToLocal transform callable
+  /// @param localToGlobal transform callable
+  /// @param pAxisA ProtoAxis object for axis A
+  /// @param pAxisB ProtoAxis object for axis B
+  template <detail::AxisBoundaryType bdtA, detail::AxisBoundaryType bdtB,
+            typename F1, typename F2>
+  static std::unique_ptr<SurfaceArray::ISurfaceGridLookup>
+  makeSurfaceGridLookup2D(F1 globalToLocal, F2 localToGlobal, ProtoAxis pAxisA,
+                          ProtoAxis pAxisB) {
+    using ISGL = SurfaceArray::ISurfaceGridLookup;
+    std::unique_ptr<ISGL> ptr;
+
+    // this becomes completely unreadable otherwise
+    // clang-format off
+    if (pAxisA.bType == equidistant && pAxisB.bType == equidistant) {
+
+      detail::Axis<detail::AxisType::Equidistant, bdtA> axisA(pAxisA.min, pAxisA.max, pAxisA.nBins);
+      detail::Axis<detail::AxisType::Equidistant, bdtB> axisB(pAxisB.min, pAxisB.max, pAxisB.nBins);
+
+      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
+            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
+
+    } else if (pAxisA.bType == equidistant && pAxisB.bType == arbitrary) {
+
+      detail::Axis<detail::AxisType::Equidistant, bdtA> axisA(pAxisA.min, pAxisA.max, pAxisA.nBins);
+      detail::Axis<detail::AxisType::Variable, bdtB> axisB(pAxisB.binEdges);
+
+      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
+            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
+
+    } else if (pAxisA.bType == arbitrary && pAxisB.bType == equidistant) {
+
+      detail::Axis<detail::AxisType::Variable, bdtA> axisA(pAxisA.binEdges);
+      detail::Axis<detail::AxisType::Equidistant, bdtB> axisB(pAxisB.min, pAxisB.max, pAxisB.nBins);
+
+      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
+            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
+
+    } else /*if (pAxisA.bType == arbitrary && pAxisB.bType == arbitrary)*/ {
+
+      detail::Axis<detail::AxisType::Variable, bdtA> axisA(pAxisA.binEdges);
+      detail::Axis<detail::AxisType::Variable, bdtB> axisB(pAxisB.binEdges);
+
+      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
+            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
+    }
+    // clang-format on
+
+    return ptr;
+  }
+
   /// Set logging instance
   /// @param logger is the logging instance to be set
   void setLogger(std::unique_ptr<const Logger> logger) {
@@ -344,69 +407,6 @@ class SurfaceArrayCreator {
                                   Transform3& transform,
                                   size_t nBins = 0) const;
 
-  /// SurfaceArrayCreator internal method
-  /// @brief Creates a SurfaceGridLookup instance within an any
-  /// This is essentially a factory which absorbs some if/else logic
-  /// that is required by the templating.
-  /// @tparam bdtA AxisBoundaryType of axis A
-  /// @tparam bdtB AxisBoundaryType of axis B
-  /// @tparam F1 type-deducted value of g2l lambda
-  /// @tparam F2 type-deducted value of l2g lambda
-  /// @param globalToLocal transform callable
-  /// @param localToGlobal transform callable
-  /// @param pAxisA ProtoAxis object for axis A
-  /// @param pAxisB ProtoAxis object for axis B
-  template <detail::AxisBoundaryType bdtA, detail::AxisBoundaryType bdtB,
-            typename F1, typename F2>
-  static std::unique_ptr<SurfaceArray::ISurfaceGridLookup>
-  makeSurfaceGridLookup2D(F1 globalToLocal, F2 localToGlobal, ProtoAxis pAxisA,
-                          ProtoAxis pAxisB) {
-    using ISGL = SurfaceArray::ISurfaceGridLookup;
-    std::unique_ptr<ISGL> ptr;
-
-    // this becomes completely unreadable otherwise
-    // clang-format off
-    if (pAxisA.bType == equidistant && pAxisB.bType == equidistant) {
-
-      detail::Axis<detail::AxisType::Equidistant, bdtA> axisA(pAxisA.min, pAxisA.max, pAxisA.nBins);
-      detail::Axis<detail::AxisType::Equidistant, bdtB> axisB(pAxisB.min, pAxisB.max, pAxisB.nBins);
-
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
-      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
-
-    } else if (pAxisA.bType == equidistant && pAxisB.bType == arbitrary) {
-
-      detail::Axis<detail::AxisType::Equidistant, bdtA> axisA(pAxisA.min, pAxisA.max, pAxisA.nBins);
-      detail::Axis<detail::AxisType::Variable, bdtB> axisB(pAxisB.binEdges);
-
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
-      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
-
-    } else if (pAxisA.bType == arbitrary && pAxisB.bType == equidistant) {
-
-      detail::Axis<detail::AxisType::Variable, bdtA> axisA(pAxisA.binEdges);
-      detail::Axis<detail::AxisType::Equidistant, bdtB> axisB(pAxisB.min, pAxisB.max, pAxisB.nBins);
-
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
-      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
-
-    } else /*if (pAxisA.bType == arbitrary && pAxisB.bType == arbitrary)*/ {
-
-      detail::Axis<detail::AxisType::Variable, bdtA> axisA(pAxisA.binEdges);
-      detail::Axis<detail::AxisType::Variable, bdtB> axisB(pAxisB.binEdges);
-
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
-      ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB), {pAxisA.bValue, pAxisB.bValue})));
-    }
-    // clang-format on
-
-    return ptr;
-  }
-
   /// logging instance
   std::unique_ptr<const Logger> m_logger;
 
@@ -0,0 +1,63 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace Acts {
+
+class IMaterialDecorator;
+class TrackingGeometry;
+
+/// @brief Binary snapshot of a fully built tracking geometry
+///
+/// The snapshot stores the volume hierarchy, the layers with their surface
+/// arrays and approach surfaces, and the (glued) boundary surfaces of a
+/// closed TrackingGeometry. Reading it rebuilds the geometry directly from
+/// these records, i.e. without running the geometry builders or parsing the
+/// original detector description.
+///
+/// The geometry identifiers are assigned again when the restored geometry is
+/// closed; since the structure and ordering are preserved they are identical
+/// to the ones of the original geometry.
+///
+/// @note The material is not part of the snapshot, it is kept in the
+///   material map formats and attached through a material decorator when
+///   reading, e.g. from a file written with
+///   BinaryMaterialMap::write(fileName, BinaryMaterialMap::collect(geometry)).
+///
+/// @note Surfaces are restored with their transforms in the default geometry
+///   context and without detector elements; the snapshot is meant for
+///   workflows that run with the nominal alignment. Like the binary material
+///   map it uses the native byte order.
+namespace TrackingGeometrySnapshot {
+
+/// Write a tracking geometry snapshot
+///
+/// @param fileName is the name of the output file
+/// @param tGeometry is the closed tracking geometry
+///
+/// @throw std::invalid_argument for geometry content the snapshot can not
+///   represent, e.g. bounding volume hierarchies or dense volumes
+/// @throw std::runtime_error if the file can not be written
+void write(const std::string& fileName, const TrackingGeometry& tGeometry);
+
+/// Read a tracking geometry snapshot
+///
+/// @param fileName is the name of the input file
+/// @param materialDecorator is an optional decorator for the material
+///
+/// @throw std::runtime_error if the file can not be read or is invalid
+std::unique_ptr<const TrackingGeometry> read(
+    const std::string& fileName,
+    const IMaterialDecorator* materialDecorator = nullptr);
+
+}  // namespace TrackingGeometrySnapshot
+}  // namespace Acts
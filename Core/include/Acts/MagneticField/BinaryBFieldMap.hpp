@@ -0,0 +1,92 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/CompactBFieldGrid.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/detail/AxisFwd.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+
+#include <string>
+
+namespace Acts {
+
+/// Single precision r-z field map grid
+using CompactBFieldGridRZ =
+    CompactBFieldGrid<Vector2, detail::EquidistantAxis,
+                      detail::EquidistantAxis>;
+
+/// Single precision x-y-z field map grid
+using CompactBFieldGridXYZ =
+    CompactBFieldGrid<Vector3, detail::EquidistantAxis,
+                      detail::EquidistantAxis, detail::EquidistantAxis>;
+
+/// @brief Binary field map format
+///
+/// The file consists of a fixed header describing the equidistant axes of the
+/// grid, followed by the field values of all bins (including under- and
+/// overflow bins) as single precision components in the global bin order of
+/// the grid. Reading a file maps it read-only into memory and uses the values
+/// in place through a CompactBFieldGrid: nothing is parsed or copied, and the
+/// pages are shared by all processes on a node that read the same file.
+///
+/// The grids are the ones built by fieldMapRZ, fieldMapXYZ or
+/// solenoidFieldMap, i.e. a text or ROOT field map is converted once with
+/// write(fileName, map.getGrid()) and can afterwards be read directly.
+///
+/// @note The format uses the native byte order and is meant as a compiled
+///   cache of the field map; it is not a portable exchange format.
+namespace BinaryBFieldMap {
+
+/// Write an r-z field map grid into a binary field map file
+///
+/// @param fileName is the name of the output file
+/// @param grid is the field map grid, the values are stored in single
+///   precision
+///
+/// @throw std::runtime_error if the file can not be written
+void write(const std::string& fileName,
+           const detail::Grid<Vector2, detail::EquidistantAxis,
+                              detail::EquidistantAxis>& grid);
+
+/// Write an x-y-z field map grid into a binary field map file
+///
+/// @param fileName is the name of the output file
+/// @param grid is the field map grid, the values are stored in single
+///   precision
+///
+/// @throw std::runtime_error if the file can not be written
+void write(const std::string& fileName,
+           const detail::Grid<Vector3, detail::EquidistantAxis,
+                              detail::EquidistantAxis,
+                              detail::EquidistantAxis>& grid);
+
+/// Read an r-z field map from a binary field map file
+///
+/// The returned field map uses the same position and field transformations
+/// as the one created by fieldMapRZ.
+///
+/// @param fileName is the name of the input file
+///
+/// @throw std::runtime_error if the file can not be read, is invalid or
+///   does not contain an r-z field map
+InterpolatedBFieldMap<CompactBFieldGridRZ> readRZ(const std::string& fileName);
+
+/// Read an x-y-z field map from a binary field map file
+///
+/// @param fileName is the name of the input file
+///
+/// @throw std::runtime_error if the file can not be read, is invalid or
+///   does not contain an x-y-z field map
+InterpolatedBFieldMap<CompactBFieldGridXYZ> readXYZ(
+    const std::string& fileName);
+
+}  // namespace BinaryBFieldMap
+}  // namespace Acts
@@ -0,0 +1,242 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/IAxis.hpp"
+#include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
+
+#include <array>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @brief read-only magnetic field grid with single precision storage
+///
+/// Drop-in replacement for the detail::Grid used by InterpolatedBFieldMap.
+/// The field vectors of all bins (including under- and overflow bins) are
+/// stored as consecutive single precision components, which halves the
+/// memory footprint of a field map w.r.t. the double precision grid. The
+/// values are converted back to double precision on access, so the
+/// interpolation itself and the transformations of the field map are
+/// unchanged.
+///
+/// The storage is either owned by the grid (when converting a double
+/// precision grid) or external, e.g. a read-only memory mapping of a binary
+/// field map file which is then shared between all processes on a node.
+///
+/// @tparam value_t the (double precision) field vector type, e.g. Vector2
+///         for r-z maps or Vector3 for x-y-z maps
+/// @tparam Axes parameter pack of axis types defining the grid
+template <typename value_t, class... Axes>
+class CompactBFieldGrid final {
+ public:
+  /// number of dimensions of the grid
+  static constexpr size_t DIM = sizeof...(Axes);
+  /// number of field components stored per bin
+  static constexpr size_t NCOMP = value_t::RowsAtCompileTime;
+
+  static_assert(value_t::ColsAtCompileTime == 1 and NCOMP > 0,
+                "The field type must be a fixed size column vector");
+
+  /// type of the values returned by the grid
+  using value_type = value_t;
+  /// type for points in d-dimensional grid space
+  using point_t = std::array<ActsScalar, DIM>;
+  /// index type using local bin indices along each axis
+  using index_t = std::array<size_t, DIM>;
+
+  /// @brief constructor from external single precision storage
+  ///
+  /// @param [in] axes actual axis objects spanning the grid
+  /// @param [in] values storage of NCOMP * size() single precision values,
+  ///                    ordered by global bin; the pointer keeps the owner
+  ///                    of the storage (e.g. a file mapping) alive
+  CompactBFieldGrid(std::tuple<Axes...> axes,
+                    std::shared_ptr<const float> values)
+      : m_axes(std::move(axes)), m_values(std::move(values)) {
+    if (m_values == nullptr) {
+      throw std::invalid_argument("Missing field grid values");
+    }
+    m_size = size();
+  }
+
+  /// @brief constructor converting a double precision grid
+  ///
+  /// @param [in] grid the grid to convert, the values are rounded to single
+  ///                  precision
+  explicit CompactBFieldGrid(const detail::Grid<value_t, Axes...>& grid)
+      : m_axes(copyAxes(grid.axes(), std::index_sequence_for<Axes...>())) {
+    m_size = size();
+    auto storage = std::make_shared<std::vector<float>>(NCOMP * m_size);
+    for (size_t bin = 0; bin < m_size; ++bin) {
+      Eigen::Map<Eigen::Matrix<float, NCOMP, 1>>(storage->data() +
+                                                 bin * NCOMP) =
+          grid.at(bin).template cast<float>();
+    }
+    m_values = std::shared_ptr<const float>(storage, storage->data());
+  }
+
+  /// @brief access value stored in bin with given global bin number
+  ///
+  /// @param  [in] bin global bin number
+  /// @return value stored in the bin, converted to double precision
+  value_type at(size_t bin) const {
+    if (bin >= m_size) {
+      throw std::out_of_range("Global bin outside of the field grid");
+    }
+    return Eigen::Map<const Eigen::Matrix<float, NCOMP, 1>>(m_values.get() +
+                                                            bin * NCOMP)
+        .template cast<ActsScalar>();
+  }
+
+  /// @brief access value stored in bin with given local bin numbers
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return value stored in the bin, converted to double precision
+  value_type atLocalBins(const index_t& localBins) const {
+    return at(globalBinFromLocalBins(localBins));
+  }
+
+  /// @brief access value stored in bin for a given point
+  ///
+  /// @param [in] point point used to look up the corresponding bin
+  /// @return value stored in the bin, converted to double precision
+  template <class Point>
+  value_type atPosition(const Point& point) const {
+    return at(globalBinFromPosition(point));
+  }
+
+  /// @brief get global bin indices for closest points on grid
+  ///
+  /// @param [in] position point of interest
+  /// @return global bin indices of the 2^DIM closest grid points
+  template <class Point>
+  detail::GlobalNeighborHoodIndices<DIM> closestPointsIndices(
+      const Point& position) const {
+    return detail::grid_helper::closestPointsIndices(
+        localBinsFromPosition(position), m_axes);
+  }
+
+  /// @brief determine global index for bin containing the given point
+  template <class Point>
+  size_t globalBinFromPosition(const Point& point) const {
+    return globalBinFromLocalBins(localBinsFromPosition(point));
+  }
+
+  /// @brief determine global bin index from local bin indices along each axis
+  size_t globalBinFromLocalBins(const index_t& localBins) const {
+    return detail::grid_helper::getGlobalBin(localBins, m_axes);
+  }
+
+  /// @brief determine local bin indices for the bin containing given point
+  template <class Point>
+  index_t localBinsFromPosition(const Point& point) const {
+    return detail::grid_helper::getLocalBinIndices(point, m_axes);
+  }
+
+  /// @brief retrieve lower-left bin edge from set of local bin indices
+  point_t lowerLeftBinEdge(const index_t& localBins) const {
+    return detail::grid_helper::getLowerLeftBinEdge(localBins, m_axes);
+  }
+
+  /// @brief retrieve upper-right bin edge from set of local bin indices
+  point_t upperRightBinEdge(const index_t& localBins) const {
+    return detail::grid_helper::getUpperRightBinEdge(localBins, m_axes);
+  }
+
+  /// @brief get number of bins along each specific axis
+  ///
+  /// @note Not including under- and overflow bins
+  index_t numLocalBins() const { return detail::grid_helper::getNBins(m_axes); }
+
+  /// @brief get the minimum value of all axes of the grid
+  point_t minPosition() const { return detail::grid_helper::getMin(m_axes); }
+
+  /// @brief get the maximum value of all axes of the grid
+  point_t maxPosition() const { return detail::grid_helper::getMax(m_axes); }
+
+  /// @brief interpolate grid values to given position
+  ///
+  /// @param [in] point location to which to interpolate grid values. The
+  ///                   position must be within the grid dimensions and not
+  ///                   lie in an under-/overflow bin along any axis.
+  ///
+  /// @return interpolated value at given position
+  ///
+  /// @note Bin values are interpreted as being the field values at the
+  /// lower-left corner of the corresponding hyper-box.
+  template <class Point>
+  value_type interpolate(const Point& point) const {
+    constexpr size_t nCorners = 1 << DIM;
+    std::array<value_type, nCorners> neighbors;
+
+    const auto& llIndices = localBinsFromPosition(point);
+    size_t i = 0;
+    for (size_t index :
+         detail::grid_helper::closestPointsIndices(llIndices, m_axes)) {
+      neighbors.at(i++) = at(index);
+    }
+
+    return Acts::interpolate(point, lowerLeftBinEdge(llIndices),
+                             upperRightBinEdge(llIndices), neighbors);
+  }
+
+  /// @brief total number of bins
+  ///
+  /// @note This number contains under-and overflow bins along all axes.
+  size_t size() const {
+    index_t nBinsArray = numLocalBins();
+    return std::accumulate(
+        nBinsArray.begin(), nBinsArray.end(), size_t(1),
+        [](const size_t& a, const size_t& b) { return a * (b + 2); });
+  }
+
+  std::array<const IAxis*, DIM> axes() const {
+    return detail::grid_helper::getAxes(m_axes);
+  }
+
+  /// @brief the single precision values of all bins, NCOMP per bin
+  const float* data() const { return m_values.get(); }
+
+ private:
+  /// set of axis defining the multi-dimensional grid
+  std::tuple<Axes...> m_axes;
+  /// single precision value store, NCOMP values for each bin
+  std::shared_ptr<const float> m_values;
+  /// total number of bins
+  size_t m_size = 0;
+
+  template <typename axis_t>
+  static axis_t copyAxis(const IAxis& axis) {
+    if constexpr (std::is_constructible_v<axis_t, ActsScalar, ActsScalar,
+                                          size_t>) {
+      return axis_t(axis.getMin(), axis.getMax(), axis.getNBins());
+    } else {
+      return axis_t(axis.getBinEdges());
+    }
+  }
+
+  template <size_t... I>
+  static std::tuple<Axes...> copyAxes(
+      const std::array<const IAxis*, DIM>& axes,
+      std::index_sequence<I...> /*indices*/) {
+    return std::tuple<Axes...>(copyAxis<Axes>(*axes[I])...);
+  }
+};
+
+}  // namespace Acts
@@ -0,0 +1,102 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/BinaryMaterialMap.hpp"
+#include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Acts {
+
+/// @brief Material decorator from the binary material map format
+///
+/// The material map file is mapped into memory and the binned surface
+/// material is used in place, i.e. loading does not depend on the size of the
+/// maps. See BinaryMaterialMap for the format and the conversion from the
+/// other formats.
+class BinaryMaterialDecorator : public IMaterialDecorator {
+ public:
+  /// Constructor
+  ///
+  /// @param fileName is the binary material map file
+  /// @param level is the logging level
+  /// @param clearSurfaceMaterial removes surface material not in the map
+  /// @param clearVolumeMaterial removes volume material not in the map
+  BinaryMaterialDecorator(const std::string& fileName,
+                          Acts::Logging::Level level,
+                          bool clearSurfaceMaterial = true,
+                          bool clearVolumeMaterial = true)
+      : m_clearSurfaceMaterial(clearSurfaceMaterial),
+        m_clearVolumeMaterial(clearVolumeMaterial),
+        m_logger{getDefaultLogger("BinaryMaterialDecorator", level)} {
+    ACTS_VERBOSE("Mapping binary material description from: " << fileName);
+    auto maps = BinaryMaterialMap::read(fileName);
+    m_surfaceMaterialMap = std::move(maps.first);
+    m_volumeMaterialMap = std::move(maps.second);
+    ACTS_VERBOSE("Binary material description with "
+                 << m_surfaceMaterialMap.size() << " surfaces and "
+                 << m_volumeMaterialMap.size() << " volumes read");
+  }
+
+  /// Decorate a surface
+  ///
+  /// @param surface the non-cost surface that is decorated
+  void decorate(Surface& surface) const final {
+    ACTS_VERBOSE("Processing surface: " << surface.geometryId());
+    // Clear the material if registered to do so
+    if (m_clearSurfaceMaterial) {
+      ACTS_VERBOSE("-> Clearing surface material");
+      surface.assignSurfaceMaterial(nullptr);
+    }
+    // Try to find the surface in the map
+    auto sMaterial = m_surfaceMaterialMap.find(surface.geometryId());
+    if (sMaterial != m_surfaceMaterialMap.end()) {
+      ACTS_VERBOSE("-> Found material for surface, assigning");
+      surface.assignSurfaceMaterial(sMaterial->second);
+    }
+  }
+
+  /// Decorate a TrackingVolume
+  ///
+  /// @param volume the non-cost volume that is decorated
+  void decorate(TrackingVolume& volume) const final {
+    ACTS_VERBOSE("Processing volume: " << volume.geometryId());
+    // Clear the material if registered to do so
+    if (m_clearVolumeMaterial) {
+      ACTS_VERBOSE("-> Clearing volume material");
+      volume.assignVolumeMaterial(nullptr);
+    }
+    // Try to find the volume in the map
+    auto vMaterial = m_volumeMaterialMap.find(volume.geometryId());
+    if (vMaterial != m_volumeMaterialMap.end()) {
+      ACTS_VERBOSE("-> Found material for volume, assigning");
+      volume.assignVolumeMaterial(vMaterial->second);
+    }
+  }
+
+ private:
+  SurfaceMaterialMap m_surfaceMaterialMap;
+  VolumeMaterialMap m_volumeMaterialMap;
+
+  bool m_clearSurfaceMaterial{true};
+  bool m_clearVolumeMaterial{true};
+
+  std::unique_ptr<const Logger> m_logger;
+
+  const Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace Acts
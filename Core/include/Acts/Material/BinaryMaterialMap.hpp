@@ -0,0 +1,80 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Acts {
+
+class ISurfaceMaterial;
+class IVolumeMaterial;
+class TrackingGeometry;
+
+using SurfaceMaterialMap =
+    std::map<GeometryIdentifier, std::shared_ptr<const ISurfaceMaterial>>;
+
+using VolumeMaterialMap =
+    std::map<GeometryIdentifier, std::shared_ptr<const IVolumeMaterial>>;
+
+using DetectorMaterialMaps = std::pair<SurfaceMaterialMap, VolumeMaterialMap>;
+
+/// @brief Compact binary material map format
+///
+/// The file consists of a fixed header, one fixed-size record per surface and
+/// per volume, and a payload with the bin utilities and the material values.
+/// Binned surface material is stored as a flat array of MaterialSlab objects
+/// in the native memory layout, such that reading a file amounts to mapping
+/// it into memory and wrapping the slab arrays into
+/// BinnedSurfaceMaterialView objects without copying or parsing them.
+///
+/// The supported material types are the ones produced by the material
+/// mapping, i.e. proto, homogeneous and binned surface material, and proto,
+/// homogeneous and interpolated (2D/3D grid) volume material. Volume grids
+/// are copied into regular InterpolatedMaterialMap objects when reading.
+///
+/// @note The format uses the native byte order and is meant as a compiled
+///   cache of the material description, e.g. converted once from the JSON or
+///   ROOT maps and then shipped with the jobs; it is not a portable exchange
+///   format.
+namespace BinaryMaterialMap {
+
+/// Write material maps into a binary material map file
+///
+/// @param fileName is the name of the output file
+/// @param maps are the surface and volume material maps
+///
+/// @throw std::invalid_argument for unsupported material types
+/// @throw std::runtime_error if the file can not be written
+void write(const std::string& fileName, const DetectorMaterialMaps& maps);
+
+/// Read material maps from a binary material map file
+///
+/// The file is mapped into memory; the returned surface material shares the
+/// mapping, which stays alive as long as any of the material objects.
+///
+/// @param fileName is the name of the input file
+///
+/// @throw std::runtime_error if the file can not be read or is invalid
+DetectorMaterialMaps read(const std::string& fileName);
+
+/// Collect the material assigned to a tracking geometry
+///
+/// Together with write() this converts the material of a geometry decorated
+/// from any of the existing formats into the binary format.
+///
+/// @param tGeometry is the (decorated) tracking geometry
+DetectorMaterialMaps collect(const TrackingGeometry& tGeometry);
+
+}  // namespace BinaryMaterialMap
+}  // namespace Acts
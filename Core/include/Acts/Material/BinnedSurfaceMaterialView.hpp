@@ -0,0 +1,96 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+
+#include <iosfwd>
+#include <memory>
+
+namespace Acts {
+
+/// @class BinnedSurfaceMaterialView
+///
+/// Binned surface material that does not own its MaterialSlab array.
+///
+/// The slabs are stored contiguously with the bin in dimension 0 running
+/// fastest, e.g. inside a memory mapped material map file. The storage is kept
+/// alive through a type-erased shared pointer that is shared between all views
+/// into the same memory.
+class BinnedSurfaceMaterialView : public ISurfaceMaterial {
+ public:
+  /// Default Constructor - deleted
+  BinnedSurfaceMaterialView() = delete;
+
+  /// Constructor from an external slab array
+  ///
+  /// @param binUtility defines the binning structure on the surface (copied)
+  /// @param slabs points to the first of bins0 * bins1 material slabs
+  /// @param bins0 is the number of bins in dimension 0
+  /// @param bins1 is the number of bins in dimension 1
+  /// @param storage keeps the memory behind @p slabs alive
+  /// @param splitFactor is the pre/post splitting directive
+  /// @param mappingType is the type of surface mapping associated to the surface
+  BinnedSurfaceMaterialView(const BinUtility& binUtility, MaterialSlab* slabs,
+                            size_t bins0, size_t bins1,
+                            std::shared_ptr<void> storage,
+                            double splitFactor = 0.,
+                            MappingType mappingType = MappingType::Default);
+
+  /// Destructor
+  ~BinnedSurfaceMaterialView() override = default;
+
+  /// Scale operator
+  ///
+  /// @param scale is the scale factor for the full material
+  ///
+  /// @note This modifies the external storage, i.e. all views into the same
+  ///   slabs are affected.
+  BinnedSurfaceMaterialView& operator*=(double scale) final;
+
+  /// Return the BinUtility
+  const BinUtility& binUtility() const { return m_binUtility; }
+
+  /// Number of bins in dimension 0
+  size_t bins0() const { return m_bins0; }
+
+  /// Number of bins in dimension 1
+  size_t bins1() const { return m_bins1; }
+
+  /// @copydoc ISurfaceMaterial::materialSlab(const Vector2&) const
+  const MaterialSlab& materialSlab(const Vector2& lp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialSlab(const Vector3&) const
+  const MaterialSlab& materialSlab(const Vector3& gp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialSlab(size_t, size_t) const
+  const MaterialSlab& materialSlab(size_t bin0, size_t bin1) const final {
+    return m_slabs[bin1 * m_bins0 + bin0];
+  }
+
+  /// Output Method for std::ostream
+  std::ostream& toStream(std::ostream& sl) const final;
+
+ private:
+  /// The helper for the bin finding
+  BinUtility m_binUtility;
+
+  /// The external material slabs
+  MaterialSlab* m_slabs = nullptr;
+  size_t m_bins0 = 0;
+  size_t m_bins1 = 0;
+
+  /// Keeps the external storage alive
+  std::shared_ptr<void> m_storage;
+};
+
+}  // namespace Acts
@@ -29,6 +29,8 @@
 
 namespace Acts {
 
+class FrozenSurfaceTable;
+
 /// @brief struct for the Navigation options that are forwarded to
 ///        the geometry
 ///
@@ -60,6 +62,9 @@ struct NavigationOptions {
   /// External surface identifier for which the boundary check is ignored
   std::vector<GeometryIdentifier> externalSurfaces = {};
 
+  /// Optional frozen surface table used to intersect the surfaces it contains
+  const FrozenSurfaceTable* frozenSurfaces = nullptr;
+
   /// The maximum path limit for this navigation step
   double pathLimit = std::numeric_limits<double>::max();
 
@@ -156,6 +161,11 @@ class Navigator {
 
     /// The tolerance used to defined "reached"
     double tolerance = s_onSurfaceTolerance;
+
+    /// Optional frozen snapshot of the surfaces, used for the surface
+    /// candidate search on the layers instead of the `Surface` interface
+    /// @note opt-in, only valid for the geometry context it was built with
+    std::shared_ptr<const FrozenSurfaceTable> frozenSurfaces{nullptr};
   };
 
   /// Nested State struct
@@ -1116,6 +1126,7 @@ class Navigator {
         state.stepping.navDir, true, m_cfg.resolveSensitive,
         m_cfg.resolveMaterial, m_cfg.resolvePassive, startSurface,
         state.navigation.targetSurface);
+    navOpts.frozenSurfaces = m_cfg.frozenSurfaces.get();
 
     std::vector<GeometryIdentifier> externalSurfaces;
     if (!state.navigation.externalSurfaces.empty()) {
@@ -0,0 +1,329 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Common.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace Acts {
+namespace detail {
+
+/// Ordering of the surfaces of an `OrderedSurfaceNavigator`
+///
+/// Each specialisation maps surfaces and positions onto a scalar key that
+/// increases monotonically along the surface sequence and decides whether a
+/// direction points towards increasing keys.
+template <typename surface_t>
+struct SurfaceOrdering;
+
+/// Parallel planes, e.g. a telescope, ordered along their common normal
+template <>
+struct SurfaceOrdering<PlaneSurface> {
+  Vector3 axis;
+
+  SurfaceOrdering(const GeometryContext& gctx, const PlaneSurface& reference)
+      : axis(reference.transform(gctx).linear().col(2)) {}
+
+  double key(const GeometryContext& gctx, const PlaneSurface& surface) const {
+    return axis.dot(surface.center(gctx));
+  }
+  double key(const Vector3& position) const { return axis.dot(position); }
+  bool increasing(const Vector3& /*position*/,
+                  const Vector3& direction) const {
+    return 0 <= axis.dot(direction);
+  }
+};
+
+/// Coaxial cylinders, e.g. a barrel, ordered by radius
+template <>
+struct SurfaceOrdering<CylinderSurface> {
+  Transform3 toLocal;
+
+  SurfaceOrdering(const GeometryContext& gctx,
+                  const CylinderSurface& reference)
+      : toLocal(reference.transform(gctx).inverse()) {}
+
+  double key(const GeometryContext& /*gctx*/,
+             const CylinderSurface& surface) const {
+    return surface.bounds().get(CylinderBounds::eR);
+  }
+  double key(const Vector3& position) const {
+    return (toLocal * position).template head<2>().norm();
+  }
+  bool increasing(const Vector3& position, const Vector3& direction) const {
+    const Vector3 lposition = toLocal * position;
+    const Vector3 ldirection = toLocal.linear() * direction;
+    return 0 <= lposition.template head<2>().dot(ldirection.template head<2>());
+  }
+};
+
+}  // namespace detail
+
+/// OrderedSurfaceNavigator class
+///
+/// Lightweight navigator for geometries that consist of a single, fixed
+/// sequence of surfaces of the same type, e.g. the parallel planes of a
+/// telescope or the coaxial cylinders of a pure barrel. The surfaces are
+/// sorted once at construction and the navigation simply steps through them
+/// by index, starting from the position and direction at the first call.
+/// Surfaces that are missed, i.e. not reachable within their bounds, are
+/// skipped. There is no volume, layer, or boundary resolution and no
+/// allocation during the propagation.
+///
+/// @note Tracks that turn around, e.g. loopers in a barrel, are not followed
+///       back through the sequence; the navigation ends at the turning point.
+template <typename surface_t>
+class OrderedSurfaceNavigator {
+ public:
+  using SurfaceType = surface_t;
+
+  struct Config {
+    /// The surfaces to navigate through, in any order
+    std::vector<std::shared_ptr<const surface_t>> surfaces;
+    /// Optional volume reported as the current volume
+    std::shared_ptr<const TrackingVolume> volume = nullptr;
+  };
+
+  /// Nested State struct
+  ///
+  /// It acts as an internal state which is
+  /// created for every propagation/extrapolation step
+  /// and keep thread-local navigation information
+  struct State {
+    /// Index of the next surface in the sequence
+    std::ptrdiff_t nextIndex = 0;
+    /// Index step, +1 or -1 depending on the direction
+    std::ptrdiff_t indexStep = 1;
+    /// The sequence position has been established
+    bool initialized = false;
+
+    /// Navigation state - external interface: the start surface
+    const Surface* startSurface = nullptr;
+    /// Navigation state - external interface: the current surface
+    const Surface* currentSurface = nullptr;
+    /// Navigation state - external interface: the target surface
+    const Surface* targetSurface = nullptr;
+    /// Navigation state - starting layer
+    const Layer* startLayer = nullptr;
+    /// Navigation state - target layer
+    const Layer* targetLayer = nullptr;
+    /// Navigation state: the start volume
+    const TrackingVolume* startVolume = nullptr;
+    /// Navigation state: the current volume
+    const TrackingVolume* currentVolume = nullptr;
+    /// Navigation state: the target volume
+    const TrackingVolume* targetVolume = nullptr;
+
+    /// Navigation state - external interface: target is reached
+    bool targetReached = false;
+    /// Navigation state - external interface: a break has been detected
+    bool navigationBreak = false;
+
+    /// Reset state
+    ///
+    /// The position in the sequence is re-established at the next call.
+    ///
+    /// @param ssurface is the new starting surface
+    /// @param tsurface is the target surface
+    void reset(const GeometryContext& /*geoContext*/, const Vector3& /*pos*/,
+               const Vector3& /*dir*/, NavigationDirection /*navDir*/,
+               const Surface* ssurface, const Surface* tsurface) {
+      *this = State();
+      startSurface = ssurface;
+      currentSurface = ssurface;
+      targetSurface = tsurface;
+    }
+  };
+
+  /// Constructor
+  ///
+  /// @param gctx The geometry context used to order the surfaces
+  /// @param cfg The navigator configuration
+  OrderedSurfaceNavigator(const GeometryContext& gctx, Config cfg)
+      : m_cfg(std::move(cfg)) {
+    if (m_cfg.surfaces.empty()) {
+      throw std::invalid_argument("Missing surfaces");
+    }
+    for (const auto& surface : m_cfg.surfaces) {
+      if (not surface) {
+        throw std::invalid_argument("Invalid surface");
+      }
+    }
+    m_ordering.emplace(gctx, *m_cfg.surfaces.front());
+
+    // sort once by the ordering key
+    std::vector<double> keys;
+    keys.reserve(m_cfg.surfaces.size());
+    for (const auto& surface : m_cfg.surfaces) {
+      keys.push_back(m_ordering->key(gctx, *surface));
+    }
+    std::vector<std::size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](auto lhs, auto rhs) { return keys[lhs] < keys[rhs]; });
+    for (auto i : order) {
+      m_surfaces.push_back(m_cfg.surfaces[i].get());
+      m_keys.push_back(keys[i]);
+    }
+  }
+
+  /// The surfaces in navigation order
+  const std::vector<const surface_t*>& surfaces() const { return m_surfaces; }
+
+  /// @brief Navigator status call
+  ///
+  /// @tparam propagator_state_t is the type of Propagatgor state
+  /// @tparam stepper_t is the used type of the Stepper by the Propagator
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper Stepper in use
+  template <typename propagator_state_t, typename stepper_t>
+  void status(propagator_state_t& state, const stepper_t& stepper) const {
+    const auto& logger = state.options.logger;
+    ACTS_VERBOSE("Entering navigator::status.");
+
+    auto& navigation = state.navigation;
+    if (not navigation.initialized) {
+      initialize(state, stepper);
+      return;
+    }
+
+    // Navigator status always resets the current surface
+    navigation.currentSurface = nullptr;
+    if (not hasNext(navigation)) {
+      return;
+    }
+    const surface_t* surface = m_surfaces[navigation.nextIndex];
+    auto surfaceStatus =
+        stepper.updateSurfaceStatus(state.stepping, *surface, true);
+    if (surfaceStatus == Intersection3D::Status::onSurface) {
+      navigation.currentSurface = surface;
+      ACTS_VERBOSE("Current surface set to " << surface->geometryId());
+      navigation.nextIndex += navigation.indexStep;
+      if (hasNext(navigation)) {
+        stepper.releaseStepSize(state.stepping);
+      }
+    }
+  }
+
+  /// @brief Navigator target call
+  ///
+  /// @tparam propagator_state_t is the type of Propagatgor state
+  /// @tparam stepper_t is the used type of the Stepper by the Propagator
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper Stepper in use
+  template <typename propagator_state_t, typename stepper_t>
+  void target(propagator_state_t& state, const stepper_t& stepper) const {
+    const auto& logger = state.options.logger;
+    ACTS_VERBOSE("Entering navigator::target.");
+
+    auto& navigation = state.navigation;
+    if (not navigation.initialized) {
+      initialize(state, stepper);
+    }
+    if (navigation.navigationBreak) {
+      return;
+    }
+
+    // Skip all surfaces that can not be reached within their bounds
+    while (hasNext(navigation)) {
+      const surface_t* surface = m_surfaces[navigation.nextIndex];
+      auto surfaceStatus =
+          stepper.updateSurfaceStatus(state.stepping, *surface, true);
+      if (surfaceStatus == Intersection3D::Status::reachable) {
+        ACTS_VERBOSE("Next surface " << surface->geometryId()
+                                     << " reachable, step size set to "
+                                     << stepper.outputStepSize(state.stepping));
+        return;
+      }
+      ACTS_VERBOSE("Surface " << surface->geometryId()
+                              << " not reachable, skip it.");
+      navigation.nextIndex += navigation.indexStep;
+    }
+
+    // End of the sequence
+    navigation.navigationBreak = true;
+    // If no externally provided target is given, the target is reached
+    if (navigation.targetSurface == nullptr) {
+      navigation.targetReached = true;
+      ACTS_VERBOSE("No target Surface, job done.");
+    }
+  }
+
+ private:
+  using Ordering = detail::SurfaceOrdering<surface_t>;
+
+  template <typename navigation_state_t>
+  bool hasNext(const navigation_state_t& navigation) const {
+    return (0 <= navigation.nextIndex) and
+           (navigation.nextIndex <
+            static_cast<std::ptrdiff_t>(m_surfaces.size()));
+  }
+
+  /// Establish the position in the sequence and the stepping direction
+  template <typename propagator_state_t, typename stepper_t>
+  void initialize(propagator_state_t& state, const stepper_t& stepper) const {
+    const auto& logger = state.options.logger;
+    auto& navigation = state.navigation;
+
+    const Vector3 position = stepper.position(state.stepping);
+    const Vector3 direction = static_cast<int>(state.stepping.navDir) *
+                              stepper.direction(state.stepping);
+    const double key = m_ordering->key(position);
+    // surfaces the track already sits on are not considered again
+    if (m_ordering->increasing(position, direction)) {
+      auto it = std::upper_bound(m_keys.begin(), m_keys.end(),
+                                 key + s_onSurfaceTolerance);
+      navigation.nextIndex = std::distance(m_keys.begin(), it);
+      navigation.indexStep = 1;
+    } else {
+      auto it = std::lower_bound(m_keys.begin(), m_keys.end(),
+                                 key - s_onSurfaceTolerance);
+      navigation.nextIndex = std::distance(m_keys.begin(), it) - 1;
+      navigation.indexStep = -1;
+    }
+    ACTS_VERBOSE("Initialization: next surface index "
+                 << navigation.nextIndex << " with step "
+                 << navigation.indexStep);
+
+    navigation.startVolume = m_cfg.volume.get();
+    navigation.currentVolume = m_cfg.volume.get();
+    navigation.currentSurface = navigation.startSurface;
+    navigation.initialized = true;
+  }
+
+  Config m_cfg;
+  std::optional<Ordering> m_ordering;
+  std::vector<const surface_t*> m_surfaces;
+  std::vector<double> m_keys;
+};
+
+/// Navigator for parallel planes, e.g. a telescope
+using TelescopeNavigator = OrderedSurfaceNavigator<PlaneSurface>;
+/// Navigator for coaxial cylinders, e.g. a pure barrel
+using BarrelNavigator = OrderedSurfaceNavigator<CylinderSurface>;
+
+}  // namespace Acts
@@ -57,6 +57,17 @@ struct PropagatorResult : private detail::Extendable<result_list...> {
 
   /// Signed distance over which the parameters were propagated
   double pathLength = 0.;
+
+  /// Reset the result for the re-use in another propagation
+  ///
+  /// The additional propagation quantities are reset to their default state.
+  /// The allocated storage of the end parameters and the transport jacobian
+  /// is kept and overwritten by the next propagation.
+  void reset() {
+    detail::Extendable<result_list...>::tuple() = std::tuple<result_list...>();
+    steps = 0;
+    pathLength = 0.;
+  }
 };
 
 /// @brief Class holding the trivial options in propagator options
@@ -335,10 +346,22 @@ class Propagator final {
   /// @tparam propagator_state_t Type of of propagator state with options
   ///
   /// @param [in,out] state the propagator state object
+  /// @param [in,out] result the reset result object to be filled
   ///
-  /// @return Propagation result
+  /// @return Propagation status
+  template <typename result_t, typename propagator_state_t>
+  Result<void> propagate_impl(propagator_state_t& state,
+                              result_t& result) const;
+
+  /// Store the curvilinear end state in the result re-using its storage
+  template <typename result_t, typename propagator_state_t>
+  void fillCurvilinearResult(propagator_state_t& state,
+                             result_t& result) const;
+
+  /// Store the bound end state in the result re-using its storage
   template <typename result_t, typename propagator_state_t>
-  Result<result_t> propagate_impl(propagator_state_t& state) const;
+  Result<void> fillBoundResult(propagator_state_t& state,
+                               const Surface& target, result_t& result) const;
 
  public:
   /// @brief Propagate track parameters
@@ -394,6 +417,61 @@ class Propagator final {
   propagate(const parameters_t& start, const Surface& target,
             const propagator_options_t& options) const;
 
+  /// @brief Type of the propagation result
+  ///
+  /// @tparam parameters_t Type of the final track parameters, i.e.
+  ///         CurvilinearTrackParameters or BoundTrackParameters
+  /// @tparam propagator_options_t Type of the propagator options
+  template <typename parameters_t, typename propagator_options_t>
+  using ResultType =
+      action_list_t_result_t<parameters_t,
+                             typename propagator_options_t::action_list_type>;
+
+  /// @brief Propagate track parameters - User method re-using the result
+  ///
+  /// Identical to the propagation without target surface, but the output is
+  /// written into an existing result object that is reset first. The storage
+  /// of the end parameters and transport jacobian held by the result is
+  /// re-used, i.e. keeping one result object per thread alive across many
+  /// short propagations avoids their repeated allocation.
+  ///
+  /// @param [in] start initial track parameters to propagate
+  /// @param [in] options Propagation options, type Options<,>
+  /// @param [in,out] result Result object to be filled
+  ///
+  /// @return Propagation status
+  template <typename parameters_t, typename propagator_options_t,
+            typename path_aborter_t = PathLimitReached>
+  Result<void> propagate(
+      const parameters_t& start, const propagator_options_t& options,
+      action_list_t_result_t<CurvilinearTrackParameters,
+                             typename propagator_options_t::action_list_type>&
+          result) const;
+
+  /// @brief Propagate track parameters - User method re-using the result
+  ///
+  /// Identical to the propagation to a target surface, but the output is
+  /// written into an existing result object that is reset first. The storage
+  /// of the end parameters and transport jacobian held by the result is
+  /// re-used, i.e. keeping one result object per thread alive across many
+  /// short propagations avoids their repeated allocation.
+  ///
+  /// @param [in] start Initial track parameters to propagate
+  /// @param [in] target Target surface of to propagate to
+  /// @param [in] options Propagation options
+  /// @param [in,out] result Result object to be filled
+  ///
+  /// @return Propagation status
+  template <typename parameters_t, typename propagator_options_t,
+            typename target_aborter_t = SurfaceReached,
+            typename path_aborter_t = PathLimitReached>
+  Result<void> propagate(
+      const parameters_t& start, const Surface& target,
+      const propagator_options_t& options,
+      action_list_t_result_t<BoundTrackParameters,
+                             typename propagator_options_t::action_list_type>&
+          result) const;
+
  private:
   /// Implementation of propagation algorithm
   stepper_t m_stepper;
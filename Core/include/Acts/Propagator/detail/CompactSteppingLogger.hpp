@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Acts {
+namespace detail {
+
+/// @brief Compact record of the steps of a single propagation
+///
+/// Stores the same information as a sequence of `Step`s, but as one single
+/// precision array per quantity (structure-of-arrays) and with the geometry
+/// identifiers instead of shared surface pointers.
+struct CompactSteps {
+  /// Global position components
+  std::vector<float> x, y, z;
+  /// Global direction components
+  std::vector<float> dx, dy, dz;
+  /// Step size constraints
+  std::vector<float> stepAccuracy, stepActor, stepAborter, stepUser;
+  /// Number of step size trials of the stepper
+  std::vector<uint16_t> nStepTrials;
+  /// Geometry identifier of the current surface; zero if there is none
+  std::vector<GeometryIdentifier::Value> surfaceId;
+  /// Geometry identifier of the current volume; zero if there is none
+  std::vector<GeometryIdentifier::Value> volumeId;
+  /// Flag if the current surface carries material
+  std::vector<uint8_t> material;
+  /// Number of steps that were not recorded due to sampling or capacity
+  std::size_t nSkipped = 0;
+
+  std::size_t size() const { return x.size(); }
+  bool empty() const { return x.empty(); }
+
+  void reserve(std::size_t n) {
+    for (auto* v : {&x, &y, &z, &dx, &dy, &dz, &stepAccuracy, &stepActor,
+                    &stepAborter, &stepUser}) {
+      v->reserve(n);
+    }
+    nStepTrials.reserve(n);
+    surfaceId.reserve(n);
+    volumeId.reserve(n);
+    material.reserve(n);
+  }
+};
+
+/// @brief Memory-lean alternative to the SteppingLogger
+///
+/// Records the steps into a `CompactSteps` record. To limit the memory for
+/// large scans, only every n-th step is recorded and the number of recorded
+/// steps per propagation is capped. Steps on a surface are always recorded
+/// as long as the capacity is not exhausted.
+struct CompactSteppingLogger {
+  using result_type = CompactSteps;
+
+  /// Set the Logger to sterile
+  bool sterile = false;
+  /// Record every n-th step that is not on a surface
+  std::size_t sampling = 1;
+  /// Maximum number of recorded steps per propagation
+  std::size_t maxSteps = std::numeric_limits<std::size_t>::max();
+
+  /// CompactSteppingLogger action for the ActionList of the Propagator
+  ///
+  /// @tparam stepper_t is the type of the Stepper
+  /// @tparam propagator_state_t is the type of Propagator state
+  ///
+  /// @param [in,out] state is the mutable stepper state object
+  /// @param [in,out] result is the mutable result object
+  template <typename propagator_state_t, typename stepper_t>
+  void operator()(propagator_state_t& state, const stepper_t& stepper,
+                  result_type& result) const {
+    // don't log if you have reached the target
+    if (sterile or state.navigation.targetReached) {
+      return;
+    }
+    const Surface* surface = state.navigation.currentSurface;
+    const TrackingVolume* volume = state.navigation.currentVolume;
+    const std::size_t nSeen = result.size() + result.nSkipped;
+    if ((maxSteps <= result.size()) or
+        ((surface == nullptr) and (1 < sampling) and (nSeen % sampling != 0))) {
+      ++result.nSkipped;
+      return;
+    }
+
+    const Vector3 position = stepper.position(state.stepping);
+    const Vector3 direction = stepper.direction(state.stepping);
+    const ConstrainedStep& stepSize = state.stepping.stepSize;
+    result.x.push_back(position.x());
+    result.y.push_back(position.y());
+    result.z.push_back(position.z());
+    result.dx.push_back(direction.x());
+    result.dy.push_back(direction.y());
+    result.dz.push_back(direction.z());
+    result.stepAccuracy.push_back(stepSize.value(ConstrainedStep::accuracy));
+    result.stepActor.push_back(stepSize.value(ConstrainedStep::actor));
+    result.stepAborter.push_back(stepSize.value(ConstrainedStep::aborter));
+    result.stepUser.push_back(stepSize.value(ConstrainedStep::user));
+    result.nStepTrials.push_back(static_cast<uint16_t>(std::min<std::size_t>(
+        stepSize.nStepTrials, std::numeric_limits<uint16_t>::max())));
+    result.surfaceId.push_back(
+        (surface != nullptr) ? surface->geometryId().value() : 0u);
+    result.volumeId.push_back(
+        (volume != nullptr) ? volume->geometryId().value() : 0u);
+    result.material.push_back(
+        (surface != nullptr) and (surface->surfaceMaterial() != nullptr));
+  }
+
+  /// Pure observer interface
+  /// - this does not apply to the logger
+  template <typename propagator_state_t, typename stepper_t>
+  void operator()(propagator_state_t& /*unused*/,
+                  const stepper_t& /*unused*/) const {}
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -0,0 +1,151 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace Acts {
+
+/// A seed candidate for a fixed middle space point, stored by value.
+template <typename external_spacepoint_t>
+struct TripletCandidate {
+  TripletCandidate() = default;
+
+  /// @param b bottom space point
+  /// @param m middle space point
+  /// @param t top space point
+  /// @param w weight of the candidate
+  /// @param z z-origin of the candidate
+  /// @param q whether the candidate is a quality confirmed seed
+  TripletCandidate(InternalSpacePoint<external_spacepoint_t>& b,
+                   InternalSpacePoint<external_spacepoint_t>& m,
+                   InternalSpacePoint<external_spacepoint_t>& t, float w,
+                   float z, bool q)
+      : bottom(&b), middle(&m), top(&t), weight(w), zOrigin(z), isQuality(q) {}
+
+  InternalSpacePoint<external_spacepoint_t>* bottom = nullptr;
+  InternalSpacePoint<external_spacepoint_t>* middle = nullptr;
+  InternalSpacePoint<external_spacepoint_t>* top = nullptr;
+  float weight = 0.;
+  float zOrigin = 0.;
+  bool isQuality = false;
+};
+
+/// Collector of the seed candidates for one middle space point.
+///
+/// Quality confirmed and regular candidates are kept in two separate
+/// fixed-capacity min-heaps, i.e. once a heap is full a new candidate only
+/// enters by replacing the worst candidate stored so far. The storage is
+/// reused between middle space points, so that no allocations are needed
+/// once the buffers have grown to their working size.
+template <typename external_spacepoint_t>
+class CandidatesForMiddleSp {
+ public:
+  using value_type = TripletCandidate<external_spacepoint_t>;
+
+  /// Set the capacities and remove all candidates
+  ///
+  /// @param nLow maximum number of regular candidates
+  /// @param nHigh maximum number of quality confirmed candidates
+  void setMaxElements(size_t nLow, size_t nHigh) {
+    m_maxSizeLow = nLow;
+    m_maxSizeHigh = nHigh;
+    clear();
+  }
+
+  /// Remove all candidates, keeping the allocated storage
+  void clear() {
+    m_storageLow.clear();
+    m_storageHigh.clear();
+    m_sorted.clear();
+  }
+
+  /// Add a candidate, possibly replacing the worst candidate of its kind
+  ///
+  /// @return true if the candidate was stored
+  bool push(InternalSpacePoint<external_spacepoint_t>& bottom,
+            InternalSpacePoint<external_spacepoint_t>& middle,
+            InternalSpacePoint<external_spacepoint_t>& top, float weight,
+            float zOrigin, bool isQuality) {
+    value_type candidate(bottom, middle, top, weight, zOrigin, isQuality);
+    if (isQuality) {
+      return push(m_storageHigh, m_maxSizeHigh, candidate);
+    }
+    return push(m_storageLow, m_maxSizeLow, candidate);
+  }
+
+  /// Number of stored regular candidates
+  size_t nLowQualityCandidates() const { return m_storageLow.size(); }
+
+  /// Number of stored quality confirmed candidates
+  size_t nHighQualityCandidates() const { return m_storageHigh.size(); }
+
+  /// All stored candidates ordered by descending quality
+  ///
+  /// @note The returned vector is owned by the collector and may be modified,
+  ///   e.g. by experiment specific cuts. It is invalidated by the next call to
+  ///   clear() or setMaxElements().
+  std::vector<value_type>& sortedCandidates() {
+    m_sorted.clear();
+    m_sorted.insert(m_sorted.end(), m_storageHigh.begin(), m_storageHigh.end());
+    m_sorted.insert(m_sorted.end(), m_storageLow.begin(), m_storageLow.end());
+    std::sort(m_sorted.begin(), m_sorted.end(), descendingByQuality);
+    return m_sorted;
+  }
+
+  /// Ordering by descending weight
+  ///
+  /// Candidates with the same weight are ordered by the positions of their
+  /// space points, which makes the ordering independent of the order in which
+  /// the candidates were created.
+  static bool descendingByQuality(const value_type& i1, const value_type& i2) {
+    if (i1.weight != i2.weight) {
+      return i1.weight > i2.weight;
+    }
+    float seed1_sum = 0;
+    float seed2_sum = 0;
+    for (const auto* sp : {i1.bottom, i1.middle, i1.top}) {
+      seed1_sum += sp->sp().y() * sp->sp().y() + sp->sp().z() * sp->sp().z();
+    }
+    for (const auto* sp : {i2.bottom, i2.middle, i2.top}) {
+      seed2_sum += sp->sp().y() * sp->sp().y() + sp->sp().z() * sp->sp().z();
+    }
+    return seed1_sum > seed2_sum;
+  }
+
+ private:
+  /// Push into one of the heaps; the front of a heap is its worst candidate
+  static bool push(std::vector<value_type>& heap, size_t maxSize,
+                   const value_type& candidate) {
+    if (heap.size() < maxSize) {
+      heap.push_back(candidate);
+      std::push_heap(heap.begin(), heap.end(), descendingByQuality);
+      return true;
+    }
+    if (heap.empty() or not descendingByQuality(candidate, heap.front())) {
+      return false;
+    }
+    std::pop_heap(heap.begin(), heap.end(), descendingByQuality);
+    heap.back() = candidate;
+    std::push_heap(heap.begin(), heap.end(), descendingByQuality);
+    return true;
+  }
+
+  size_t m_maxSizeLow = std::numeric_limits<size_t>::max();
+  size_t m_maxSizeHigh = std::numeric_limits<size_t>::max();
+  std::vector<value_type> m_storageLow;
+  std::vector<value_type> m_storageHigh;
+  std::vector<value_type> m_sorted;
+};
+
+}  // namespace Acts
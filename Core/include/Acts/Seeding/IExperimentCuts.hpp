@@ -8,9 +8,11 @@
 
 #pragma once
 
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
 #include "Acts/Seeding/InternalSeed.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace Acts {
 /// @c IExperimentCuts can be used to increase or decrease seed weights
@@ -51,5 +53,36 @@ class IExperimentCuts {
       std::vector<
           std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
           seeds) const = 0;
+
+  /// In-place variant of cutPerMiddleSP for the seed candidates stored by
+  /// value, as used by the default seed filter.
+  ///
+  /// The default implementation converts the candidates and forwards to
+  /// cutPerMiddleSP. Implementations should override it to avoid the
+  /// conversion.
+  ///
+  /// @param candidates contains the seed candidates created for one middle
+  /// space point ordered by descending weight; only the candidates that pass
+  /// the cut are kept
+  virtual void cutPerMiddleSPCandidates(
+      std::vector<TripletCandidate<SpacePoint>>& candidates) const {
+    std::vector<
+        std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
+        seeds;
+    seeds.reserve(candidates.size());
+    for (const auto& candidate : candidates) {
+      seeds.emplace_back(candidate.weight,
+                         std::make_unique<const InternalSeed<SpacePoint>>(
+                             *candidate.bottom, *candidate.middle,
+                             *candidate.top, candidate.zOrigin,
+                             candidate.isQuality));
+    }
+    seeds = cutPerMiddleSP(std::move(seeds));
+    candidates.clear();
+    for (const auto& [weight, seed] : seeds) {
+      candidates.emplace_back(*seed->sp[0], *seed->sp[1], *seed->sp[2], weight,
+                              seed->z(), seed->qualitySeed());
+    }
+  }
 };
 }  // namespace Acts
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
 #include "Acts/Seeding/IExperimentCuts.hpp"
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/Seed.hpp"
@@ -53,6 +54,30 @@ class SeedFilter {
           float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>&
           outCont) const;
 
+  /// Create seed candidates for the all seeds with the same bottom and middle
+  /// space point and discard all others.
+  ///
+  /// Same as above, but the candidates are stored by value in a reusable
+  /// collector that only keeps the best candidates of each kind.
+  /// @param bottomSP fixed bottom space point
+  /// @param middleSP fixed middle space point
+  /// @param topSpVec vector containing all space points that may be compatible
+  ///                 with both bottom and middle space point
+  /// @param invHelixDiameterVec vector containing 1/(2*r) values where r is the helix radius
+  /// @param impactParametersVec vector containing the impact parameters
+  /// @param zOrigin on the z axis as defined by bottom and middle space point
+  /// @param numQualitySeeds number of high quality seeds in seed confirmation
+  /// @param numSeeds number of seeds that did not pass the quality confirmation but were still accepted, if quality confirmation is not used this is the total number of seeds
+  /// @param candidatesCollector collector for the seed candidates
+  virtual void filterSeeds_2SpFixed(
+      InternalSpacePoint<external_spacepoint_t>& bottomSP,
+      InternalSpacePoint<external_spacepoint_t>& middleSP,
+      std::vector<InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+      std::vector<float>& invHelixDiameterVec,
+      std::vector<float>& impactParametersVec, float zOrigin,
+      int& numQualitySeeds, int& numSeeds,
+      CandidatesForMiddleSp<external_spacepoint_t>& candidatesCollector) const;
+
   /// Filter seeds once all seeds for one middle space point have been created
   /// @param seedsPerSpM vector of pairs containing weight and seed for all
   /// @param numQualitySeeds number of high quality seeds in seed confirmation
@@ -66,6 +91,17 @@ class SeedFilter {
       std::back_insert_iterator<std::vector<Seed<external_spacepoint_t>>> outIt)
       const;
 
+  /// Filter seeds once all seed candidates for one middle space point have
+  /// been collected
+  /// @param candidatesCollector collector holding the seed candidates
+  /// @param numQualitySeeds number of high quality seeds in seed confirmation
+  /// @param outIt Output iterator for the seeds
+  virtual void filterSeeds_1SpFixed(
+      CandidatesForMiddleSp<external_spacepoint_t>& candidatesCollector,
+      int& numQualitySeeds,
+      std::back_insert_iterator<std::vector<Seed<external_spacepoint_t>>> outIt)
+      const;
+
   /// Check if there is a lower quality seed that can be replaced
   /// @param bottomSP fixed bottom space point
   /// @param middleSP fixed middle space point
@@ -89,6 +125,20 @@ class SeedFilter {
   }
 
  private:
+  /// Common implementation of filterSeeds_2SpFixed
+  ///
+  /// @param storeSeed callable invoked as (topSP, weight, isQualitySeed,
+  ///        replace) for every accepted seed, where replace indicates that the
+  ///        maximum number of seeds of this kind has been reached
+  template <typename store_seed_t>
+  void filterSeeds_2SpFixedImpl(
+      InternalSpacePoint<external_spacepoint_t>& bottomSP,
+      InternalSpacePoint<external_spacepoint_t>& middleSP,
+      std::vector<InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+      std::vector<float>& invHelixDiameterVec,
+      std::vector<float>& impactParametersVec, float zOrigin,
+      int& numQualitySeeds, int& numSeeds, store_seed_t&& storeSeed) const;
+
   const SeedFilterConfig m_cfg;
   const IExperimentCuts<external_spacepoint_t>* m_experimentCuts;
 };
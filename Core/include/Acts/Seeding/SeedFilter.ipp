@@ -32,6 +32,53 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
     std::vector<std::pair<
         float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>&
         outCont) const {
+  filterSeeds_2SpFixedImpl(
+      bottomSP, middleSP, topSpVec, invHelixDiameterVec, impactParametersVec,
+      zOrigin, numQualitySeeds, numSeeds,
+      [&](InternalSpacePoint<external_spacepoint_t>& topSP, float weight,
+          bool isQualitySeed, bool replace) {
+        if (replace) {
+          // check if there is a lower quality seed to remove
+          checkReplaceSeeds(bottomSP, middleSP, topSP, zOrigin, isQualitySeed,
+                            weight, outCont);
+        } else {
+          outCont.push_back(std::make_pair(
+              weight,
+              std::make_unique<const InternalSeed<external_spacepoint_t>>(
+                  bottomSP, middleSP, topSP, zOrigin, isQualitySeed)));
+        }
+      });
+}
+
+template <typename external_spacepoint_t>
+void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
+    InternalSpacePoint<external_spacepoint_t>& bottomSP,
+    InternalSpacePoint<external_spacepoint_t>& middleSP,
+    std::vector<InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+    std::vector<float>& invHelixDiameterVec,
+    std::vector<float>& impactParametersVec, float zOrigin,
+    int& numQualitySeeds, int& numSeeds,
+    CandidatesForMiddleSp<external_spacepoint_t>& candidatesCollector) const {
+  filterSeeds_2SpFixedImpl(
+      bottomSP, middleSP, topSpVec, invHelixDiameterVec, impactParametersVec,
+      zOrigin, numQualitySeeds, numSeeds,
+      [&](InternalSpacePoint<external_spacepoint_t>& topSP, float weight,
+          bool isQualitySeed, bool /*replace*/) {
+        // the collector replaces its worst candidate once it is full
+        candidatesCollector.push(bottomSP, middleSP, topSP, weight, zOrigin,
+                                 isQualitySeed);
+      });
+}
+
+template <typename external_spacepoint_t>
+template <typename store_seed_t>
+void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixedImpl(
+    InternalSpacePoint<external_spacepoint_t>& bottomSP,
+    InternalSpacePoint<external_spacepoint_t>& middleSP,
+    std::vector<InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+    std::vector<float>& invHelixDiameterVec,
+    std::vector<float>& impactParametersVec, float zOrigin,
+    int& numQualitySeeds, int& numSeeds, store_seed_t&& storeSeed) const {
   // seed confirmation
   int nTopSeedConf = 0;
   if (m_cfg.seedConfirmation) {
@@ -56,7 +103,9 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
   std::vector<size_t> idx(topSpVec.size());
   std::iota(idx.begin(), idx.end(), 0);
 
-  if (m_cfg.curvatureSortingInFilter and topSpVec.size() > 2) {
+  const bool sortedByCurvature =
+      m_cfg.curvatureSortingInFilter and topSpVec.size() > 2;
+  if (sortedByCurvature) {
     // sort indexes based on comparing values in invHelixDiameterVec
     std::sort(idx.begin(), idx.end(),
               [&invHelixDiameterVec](size_t i1, size_t i2) {
@@ -64,11 +113,21 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
               });
   }
 
+  // if two compatible seeds with high distance in r are found, compatible
+  // seeds span 5 layers
+  // -> weaker requirement for a good seed
+  // the buffer is shared by all top SP and never exceeds compatSeedLimit
+  std::vector<float> compatibleSeedR;
+  compatibleSeedR.reserve(
+      std::min<size_t>(m_cfg.compatSeedLimit, topSpVec.size()));
+
+  // first index in idx that can be compatible with the current top SP; for
+  // sorted curvatures the lower curvature limit only grows, so the window of
+  // compatible top SP only moves forward
+  size_t beginCompatible = 0;
+
   for (auto& i : idx) {
-    // if two compatible seeds with high distance in r are found, compatible
-    // seeds span 5 layers
-    // -> weaker requirement for a good seed
-    std::vector<float> compatibleSeedR;
+    compatibleSeedR.clear();
 
     float invHelixDiameter = invHelixDiameterVec[i];
     float lowerLimitCurv = invHelixDiameter - m_cfg.deltaInvHelixDiameter;
@@ -78,8 +137,16 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
                                                     : topSpVec[i]->radius();
     float impact = impactParametersVec[i];
 
+    if (sortedByCurvature) {
+      while (beginCompatible < idx.size() and
+             invHelixDiameterVec[idx[beginCompatible]] < lowerLimitCurv) {
+        ++beginCompatible;
+      }
+    }
+
     float weight = -(impact * m_cfg.impactWeightFactor);
-    for (auto& j : idx) {
+    for (auto jt = idx.begin() + beginCompatible; jt != idx.end(); ++jt) {
+      size_t j = *jt;
       if (i == j) {
         continue;
       }
@@ -166,19 +233,15 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
       }
 
       if (deltaSeedConf > 0) {
-        // if we have not yet reached our max number of quality seeds we add the
-        // new seed to outCont
+        // if we have not yet reached our max number of quality seeds we store
+        // the new seed
         if (numQualitySeeds < m_cfg.maxQualitySeedsPerSpMConf) {
           // fill high quality seed
           ++numQualitySeeds;
-          outCont.push_back(std::make_pair(
-              weight,
-              std::make_unique<const InternalSeed<external_spacepoint_t>>(
-                  bottomSP, middleSP, *topSpVec[i], zOrigin, true)));
+          storeSeed(*topSpVec[i], weight, true, false);
         } else {
           // otherwise we check if there is a lower quality seed to remove
-          checkReplaceSeeds(bottomSP, middleSP, *topSpVec[i], zOrigin, true,
-                            weight, outCont);
+          storeSeed(*topSpVec[i], weight, true, true);
         }
 
       } else if (weight > weightMax) {
@@ -189,38 +252,29 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
       }
     } else {
       // keep the normal behavior without seed quality confirmation
-      // if we have not yet reached our max number of seeds we add the new seed
-      // to outCont
+      // if we have not yet reached our max number of seeds we store the new
+      // seed
       if (numSeeds < m_cfg.maxSeedsPerSpMConf) {
         // fill seed
         ++numSeeds;
-        outCont.push_back(std::make_pair(
-            weight, std::make_unique<const InternalSeed<external_spacepoint_t>>(
-                        bottomSP, middleSP, *topSpVec[i], zOrigin, false)));
+        storeSeed(*topSpVec[i], weight, false, false);
       } else {
         // otherwise we check if there is a lower quality seed to remove
-        checkReplaceSeeds(bottomSP, middleSP, *topSpVec[i], zOrigin, false,
-                          weight, outCont);
+        storeSeed(*topSpVec[i], weight, false, true);
       }
     }
   }
   // if no high quality seed was found for a certain middle+bottom SP pair,
   // lower quality seeds can be accepted
   if (m_cfg.seedConfirmation and maxWeightSeed and !numQualitySeeds) {
-    // if we have not yet reached our max number of seeds we add the new seed to
-    // outCont
+    // if we have not yet reached our max number of seeds we store the new seed
     if (numSeeds < m_cfg.maxSeedsPerSpMConf) {
       // fill seed
       ++numSeeds;
-      outCont.push_back(std::make_pair(
-          weightMax,
-          std::make_unique<const InternalSeed<external_spacepoint_t>>(
-              bottomSP, middleSP, *topSpVec[maxWeightSeedIndex], zOrigin,
-              false)));
+      storeSeed(*topSpVec[maxWeightSeedIndex], weightMax, false, false);
     } else {
       // otherwise we check if there is a lower quality seed to remove
-      checkReplaceSeeds(bottomSP, middleSP, *topSpVec[maxWeightSeedIndex],
-                        zOrigin, false, weightMax, outCont);
+      storeSeed(*topSpVec[maxWeightSeedIndex], weightMax, false, true);
     }
   }
 }
@@ -303,6 +357,59 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_1SpFixed(
   }
 }
 
+// after creating all seeds with a common middle space point, filter again
+template <typename external_spacepoint_t>
+void SeedFilter<external_spacepoint_t>::filterSeeds_1SpFixed(
+    CandidatesForMiddleSp<external_spacepoint_t>& candidatesCollector,
+    int& numQualitySeeds,
+    std::back_insert_iterator<std::vector<Seed<external_spacepoint_t>>> outIt)
+    const {
+  // the collector only holds the best candidates, sorted by weight
+  auto& candidates = candidatesCollector.sortedCandidates();
+  if (m_experimentCuts != nullptr) {
+    m_experimentCuts->cutPerMiddleSPCandidates(candidates);
+  }
+  unsigned int maxSeeds = candidates.size();
+
+  if (maxSeeds > m_cfg.maxSeedsPerSpM) {
+    maxSeeds = m_cfg.maxSeedsPerSpM + 1;
+  }
+  // default filter removes the last seeds if maximum amount exceeded
+  // ordering by weight by filterSeeds_2SpFixed means these are the lowest
+  // weight seeds
+  unsigned int numTotalSeeds = 0;
+  for (const auto& candidate : candidates) {
+    // stop if we reach the maximum number of seeds
+    if (numTotalSeeds >= maxSeeds) {
+      break;
+    }
+
+    float bestSeedQuality = candidate.weight;
+
+    if (m_cfg.seedConfirmation) {
+      // continue if higher-quality seeds were found
+      if (numQualitySeeds > 0 and candidate.isQuality == false) {
+        continue;
+      }
+      if (bestSeedQuality < candidate.bottom->quality() and
+          bestSeedQuality < candidate.middle->quality() and
+          bestSeedQuality < candidate.top->quality()) {
+        continue;
+      }
+    }
+
+    // set quality of seed components
+    candidate.bottom->setQuality(bestSeedQuality);
+    candidate.middle->setQuality(bestSeedQuality);
+    candidate.top->setQuality(bestSeedQuality);
+
+    outIt = Seed<external_spacepoint_t>{
+        candidate.bottom->sp(), candidate.middle->sp(), candidate.top->sp(),
+        candidate.zOrigin, bestSeedQuality};
+    numTotalSeeds += 1;
+  }
+}
+
 template <typename external_spacepoint_t>
 void SeedFilter<external_spacepoint_t>::checkReplaceSeeds(
     InternalSpacePoint<external_spacepoint_t>& bottomSP,
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
+#include "Acts/Seeding/SeedFinderUtils.hpp"
+#include "Acts/Utilities/KDTree.hpp"
 
 #include <array>
 #include <list>
@@ -120,6 +123,40 @@ class SeedFinderOrthogonal {
   std::vector<seed_t> createSeeds(const input_container_t &spacePoints) const;
 
  private:
+  /**
+   * @brief Buffers shared by all middle spacepoints of one call to
+   * createSeeds, so that they are not reallocated for every middle
+   * spacepoint.
+   */
+  struct CandidateBuffers {
+    /**
+     * @brief Candidate bottom and top spacepoints for increasing (lh) and
+     * decreasing (hl) z tracks.
+     */
+    std::vector<internal_sp_t *> bottom_lh_v, bottom_hl_v, top_lh_v, top_hl_v;
+
+    /**
+     * @brief Top spacepoints compatible with a bottom spacepoint, and their
+     * curvatures and impact parameters.
+     */
+    std::vector<internal_sp_t *> top_valid;
+    std::vector<float> curvatures;
+    std::vector<float> impactParameters;
+
+    /**
+     * @brief Transformed coordinates and angles of the candidates.
+     */
+    std::vector<LinCircle> linCircleBottom;
+    std::vector<LinCircle> linCircleTop;
+    std::vector<float> tanLM;
+    std::vector<float> tanMT;
+
+    /**
+     * @brief Seed candidates of the current middle spacepoint.
+     */
+    CandidatesForMiddleSp<external_spacepoint_t> candidates;
+  };
+
   /**
    * @brief Enumeration of the different dimensions in which we can apply cuts.
    */
@@ -187,22 +224,18 @@ class SeedFinderOrthogonal {
   tree_t createTree(const std::vector<internal_sp_t *> &spacePoints) const;
 
   /**
-   * @brief Filter potential candidate pairs, and output seeds into an
-   * iterator.
-   *
-   * @tparam output_container_t The type of the output container.
+   * @brief Filter potential candidate pairs, and collect the seed candidates.
    *
    * @param middle The (singular) middle spacepoint.
    * @param bottom The (vector of) candidate bottom spacepoints.
    * @param top The (vector of) candidate top spacepoints.
    * @param numQualitySeeds number of high quality seeds in seed confirmation.
-   * @param cont The container to write the resulting seeds to.
+   * @param buffers The reusable buffers, also collecting the seed candidates.
    */
-  template <typename output_container_t>
   void filterCandidates(internal_sp_t &middle,
                         std::vector<internal_sp_t *> &bottom,
                         std::vector<internal_sp_t *> &top, int numQualitySeeds,
-                        output_container_t &cont) const;
+                        CandidateBuffers &buffers) const;
 
   /**
    * @brief Search for seeds starting from a given middle space point.
@@ -213,10 +246,12 @@ class SeedFinderOrthogonal {
    * @param tree The k-d tree to use for searching.
    * @param out_cont The container write output seeds to.
    * @param middle_p The middle spacepoint to find seeds for.
+   * @param buffers The reusable buffers.
    */
   template <typename output_container_t>
   void processFromMiddleSP(const tree_t &tree, output_container_t &out_cont,
-                           const typename tree_t::pair_t &middle_p) const;
+                           const typename tree_t::pair_t &middle_p,
+                           CandidateBuffers &buffers) const;
 
   /**
    * @brief The configuration for the seeding algorithm.
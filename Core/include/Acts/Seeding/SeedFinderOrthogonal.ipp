@@ -199,35 +199,34 @@ SeedFinderOrthogonal<external_spacepoint_t>::SeedFinderOrthogonal(
 }
 
 template <typename external_spacepoint_t>
-template <typename output_container_t>
 void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
     internal_sp_t &middle, std::vector<internal_sp_t *> &bottom,
     std::vector<internal_sp_t *> &top, int numQualitySeeds,
-    output_container_t &cont) const {
+    CandidateBuffers &buffers) const {
   float rM = middle.radius();
   float varianceRM = middle.varianceR();
   float varianceZM = middle.varianceZ();
 
-  std::vector<internal_sp_t *> top_valid;
-  std::vector<float> curvatures;
-  std::vector<float> impactParameters;
+  std::vector<internal_sp_t *> &top_valid = buffers.top_valid;
+  std::vector<float> &curvatures = buffers.curvatures;
+  std::vector<float> &impactParameters = buffers.impactParameters;
 
   // contains parameters required to calculate circle with linear equation
   // ...for bottom-middle
-  std::vector<LinCircle> linCircleBottom;
-  linCircleBottom.reserve(bottom.size());
+  std::vector<LinCircle> &linCircleBottom = buffers.linCircleBottom;
+  linCircleBottom.clear();
   // ...for middle-top
-  std::vector<LinCircle> linCircleTop;
-  linCircleTop.reserve(top.size());
+  std::vector<LinCircle> &linCircleTop = buffers.linCircleTop;
+  linCircleTop.clear();
 
   transformCoordinates(bottom, middle, true, linCircleBottom);
   transformCoordinates(top, middle, false, linCircleTop);
 
-  std::vector<float> tanLM;
-  std::vector<float> tanMT;
+  std::vector<float> &tanLM = buffers.tanLM;
+  std::vector<float> &tanMT = buffers.tanMT;
 
-  tanLM.reserve(bottom.size());
-  tanMT.reserve(top.size());
+  tanLM.clear();
+  tanMT.clear();
 
   size_t numBotSP = bottom.size();
   size_t numTopSP = top.size();
@@ -351,7 +350,7 @@ void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
     if (!top_valid.empty()) {
       m_config.seedFilter->filterSeeds_2SpFixed(
           *bottom[b], middle, top_valid, curvatures, impactParameters, Zob,
-          numQualitySeeds, numSeeds, cont);
+          numQualitySeeds, numSeeds, buffers.candidates);
     }
   }
 }
@@ -360,7 +359,7 @@ template <typename external_spacepoint_t>
 template <typename output_container_t>
 void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
     const tree_t &tree, output_container_t &out_cont,
-    const typename tree_t::pair_t &middle_p) const {
+    const typename tree_t::pair_t &middle_p, CandidateBuffers &buffers) const {
   using range_t = typename tree_t::range_t;
   internal_sp_t &middle = *middle_p.second;
 
@@ -374,7 +373,10 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
    * increasing z track, and top_hl_v are the candidate top points for a
    * decreasing z track.
    */
-  std::vector<internal_sp_t *> bottom_lh_v, bottom_hl_v, top_lh_v, top_hl_v;
+  std::vector<internal_sp_t *> &bottom_lh_v = buffers.bottom_lh_v;
+  std::vector<internal_sp_t *> &bottom_hl_v = buffers.bottom_hl_v;
+  std::vector<internal_sp_t *> &top_lh_v = buffers.top_lh_v;
+  std::vector<internal_sp_t *> &top_hl_v = buffers.top_hl_v;
 
   /*
    * Cut: Ensure that the middle spacepoint lies within a valid r-region for
@@ -503,11 +505,12 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
   }
 
   /*
-   * Create a vector to contain protoseeds.
+   * Reset the collector of seed candidates for this middle spacepoint.
    */
-  std::vector<std::pair<
-      float, std::unique_ptr<const InternalSeed<ActsExamples::SimSpacePoint>>>>
-      protoseeds;
+  const SeedFilterConfig filterConfig =
+      m_config.seedFilter->getSeedFilterConfig();
+  buffers.candidates.setMaxElements(filterConfig.maxSeedsPerSpMConf,
+                                    filterConfig.maxQualitySeedsPerSpMConf);
 
   int numQualitySeeds = 0;
 
@@ -515,29 +518,28 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
    * If we have candidates for increasing z tracks, we try to combine them.
    */
   if (!bottom_lh_v.empty() && !top_lh_v.empty()) {
-    filterCandidates(middle, bottom_lh_v, top_lh_v, numQualitySeeds,
-                     protoseeds);
+    filterCandidates(middle, bottom_lh_v, top_lh_v, numQualitySeeds, buffers);
   }
 
   /*
    * Try to combine candidates for decreasing z tracks.
    */
   if (!bottom_hl_v.empty() && !top_hl_v.empty()) {
-    filterCandidates(middle, bottom_hl_v, top_hl_v, numQualitySeeds,
-                     protoseeds);
+    filterCandidates(middle, bottom_hl_v, top_hl_v, numQualitySeeds, buffers);
   }
 
   /*
    * Run a seed filter, just like in other seeding algorithms.
    */
-  m_config.seedFilter->filterSeeds_1SpFixed(protoseeds, numQualitySeeds,
-                                            std::back_inserter(out_cont));
+  m_config.seedFilter->filterSeeds_1SpFixed(
+      buffers.candidates, numQualitySeeds, std::back_inserter(out_cont));
 }
 
 template <typename external_spacepoint_t>
 auto SeedFinderOrthogonal<external_spacepoint_t>::createTree(
     const std::vector<internal_sp_t *> &spacePoints) const -> tree_t {
   std::vector<typename tree_t::pair_t> points;
+  points.reserve(spacePoints.size());
 
   /*
    * For every input point, we create a coordinate-pointer pair, which we then
@@ -574,16 +576,18 @@ void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
                 "Input container must contain external spacepoints.");
 
   /*
-   * Sadly, for the time being, we will need to construct our internal space
-   * points on the heap. This adds some additional overhead and work. Here we
-   * take each external spacepoint, allocate a corresponding internal space
-   * point, and save it in a vector.
+   * Construct the internal space points in one contiguous block, which is
+   * reserved up front so that the pointers to the internal space points stay
+   * valid. This avoids one heap allocation per space point.
    */
+  std::vector<internal_sp_t> internalSpacePointStorage;
+  internalSpacePointStorage.reserve(spacePoints.size());
   std::vector<internal_sp_t *> internalSpacePoints;
+  internalSpacePoints.reserve(spacePoints.size());
   for (const external_spacepoint_t *p : spacePoints) {
-    internalSpacePoints.push_back(new InternalSpacePoint<external_spacepoint_t>(
-        *p, {p->x(), p->y(), p->z()}, {0.0, 0.0},
-        {p->varianceR(), p->varianceZ()}));
+    internalSpacePoints.push_back(&internalSpacePointStorage.emplace_back(
+        *p, Vector3{p->x(), p->y(), p->z()}, Vector2{0.0, 0.0},
+        Vector2{p->varianceR(), p->varianceZ()}));
   }
 
   /*
@@ -594,17 +598,12 @@ void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
 
   /*
    * Run the seeding algorithm by iterating over all the points in the tree and
-   * seeing what happens if we take them to be our middle spacepoint.
+   * seeing what happens if we take them to be our middle spacepoint. The
+   * candidate buffers are shared by all middle spacepoints.
    */
+  CandidateBuffers buffers;
   for (const typename tree_t::pair_t &middle_p : tree) {
-    processFromMiddleSP(tree, out_cont, middle_p);
-  }
-
-  /*
-   * Don't forget to get rid of all the spacepoints we just allocated!
-   */
-  for (const internal_sp_t *p : internalSpacePoints) {
-    delete p;
+    processFromMiddleSP(tree, out_cont, middle_p, buffers);
   }
 }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/SeedFinderUtils.hpp"
@@ -49,9 +50,8 @@ class Seedfinder {
     std::vector<float> etaVec;
     std::vector<float> ptVec;
 
-    std::vector<std::pair<
-        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-        seedsPerSpM;
+    // seed candidates of the current middle space point
+    CandidatesForMiddleSp<external_spacepoint_t> candidatesCollector;
   };
 
   /// The only constructor. Requires a config object.
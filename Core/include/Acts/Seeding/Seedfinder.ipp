@@ -43,6 +43,18 @@ void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
     sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs,
     Extent rRangeSPExtent) const {
+  const SeedFilterConfig filterConfig =
+      m_config.seedFilter->getSeedFilterConfig();
+  // without seed confirmation and experiment specific cuts only the best
+  // maxSeedsPerSpM + 1 candidates can be selected for a middle SP, so there
+  // is no need to keep more of them
+  size_t seedCollectorCapacity = filterConfig.maxSeedsPerSpMConf;
+  if (not filterConfig.seedConfirmation and
+      m_config.seedFilter->getExperimentCuts() == nullptr) {
+    seedCollectorCapacity = std::min<size_t>(seedCollectorCapacity,
+                                             filterConfig.maxSeedsPerSpM + 1);
+  }
+
   for (auto spM : middleSPs) {
     float rM = spM->radius();
     float zM = spM->z();
@@ -245,7 +257,8 @@ void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     state.topSpVec.clear();
     state.curvatures.clear();
     state.impactParameters.clear();
-    state.seedsPerSpM.clear();
+    state.candidatesCollector.setMaxElements(
+        seedCollectorCapacity, filterConfig.maxQualitySeedsPerSpMConf);
 
     size_t numBotSP = state.compatBottomSP.size();
     size_t numTopSP = state.compatTopSP.size();
@@ -511,10 +524,10 @@ void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
         m_config.seedFilter->filterSeeds_2SpFixed(
             *state.compatBottomSP[b], *spM, state.topSpVec, state.curvatures,
             state.impactParameters, Zob, numQualitySeeds, numSeeds,
-            state.seedsPerSpM);
+            state.candidatesCollector);
       }
     }
-    m_config.seedFilter->filterSeeds_1SpFixed(state.seedsPerSpM,
+    m_config.seedFilter->filterSeeds_1SpFixed(state.candidatesCollector,
                                               numQualitySeeds, outIt);
   }
 }
@@ -84,6 +84,16 @@ class AnnulusBounds : public DiscBounds {
   virtual bool inside(const Vector2& lposition,
                       const BoundaryCheck& bcheck) const final;
 
+  /// Inside check for many local positions at once, the coordinate
+  /// transformations are vectorised over the positions
+  ///
+  /// @param lpositions Local positions, one per row
+  /// @param bcheck boundary check directive
+  /// @param [out] inside Result of the check for each position
+  void insideBatch(const BoundaryCheck::LocalPositions& lpositions,
+                   const BoundaryCheck& bcheck,
+                   BoundaryCheck::InsideMask& inside) const final;
+
   /// Outstream operator
   ///
   /// @param sl is the ostream to be dumped into
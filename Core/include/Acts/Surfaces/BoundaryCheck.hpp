@@ -35,6 +35,17 @@ namespace Acts {
 /// distance induced by the the covariance.
 class BoundaryCheck {
  public:
+  /// Local positions for the batched checks, one position per row.
+  ///
+  /// The column-major storage keeps the first and the second coordinates of
+  /// all positions contiguous, such that the checks can be vectorised over
+  /// the positions.
+  using LocalPositions = Eigen::Matrix<double, Eigen::Dynamic, 2>;
+  /// Result of the batched inside checks, one entry per position
+  using InsideMask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+  /// Result of the batched distance calculations, one entry per position
+  using Distances = Eigen::ArrayXd;
+
   /// Construct either hard cut in both dimensions or no cut at all.
   BoundaryCheck(bool check);
 
@@ -106,6 +117,48 @@ class BoundaryCheck {
   double distance(const Vector2& point, const Vector2& lowerLeft,
                   const Vector2& upperRight) const;
 
+  /// Check if many points are inside a polygon.
+  ///
+  /// @param points   Test points, one per row
+  /// @param vertices Forward iterable container of convex polygon vertices.
+  /// @param [out] inside Result of the check for each point
+  ///
+  /// Identical to the single point check, but vectorised over the points.
+  template <typename Vector2Container>
+  void isInside(const LocalPositions& points, const Vector2Container& vertices,
+                InsideMask& inside) const;
+
+  /// Check if many points are inside a box aligned with the local axes.
+  ///
+  /// @param points   Test points, one per row
+  /// @param lowerLeft Minimal vertex of the box
+  /// @param upperRight Maximal vertex of the box
+  /// @param [out] inside Result of the check for each point
+  ///
+  /// Identical to the single point check, but vectorised over the points.
+  void isInside(const LocalPositions& points, const Vector2& lowerLeft,
+                const Vector2& upperRight, InsideMask& inside) const;
+
+  /// Calculate the signed, weighted, closest distances of many points to a
+  /// polygonal boundary.
+  ///
+  /// @param points   Test points, one per row
+  /// @param vertices Forward iterable container of convex polygon vertices.
+  /// @param [out] distances Negative value if inside, positive if outside
+  template <typename Vector2Container>
+  void distance(const LocalPositions& points, const Vector2Container& vertices,
+                Distances& distances) const;
+
+  /// Calculate the signed, weighted, closest distances of many points to an
+  /// aligned box.
+  ///
+  /// @param points   Test points, one per row
+  /// @param lowerLeft Minimal vertex of the box
+  /// @param upperRight Maximal vertex of the box
+  /// @param [out] distances Negative value if inside, positive if outside
+  void distance(const LocalPositions& points, const Vector2& lowerLeft,
+                const Vector2& upperRight, Distances& distances) const;
+
   enum class Type {
     eNone,      ///< disable boundary check
     eAbsolute,  ///< absolute cut
@@ -131,9 +184,28 @@ class BoundaryCheck {
   /// Check if the distance vector is within the absolute or relative limits.
   bool isTolerated(const Vector2& delta) const;
 
+  /// Check if the distance vectors are within the absolute or relative
+  /// limits. The result is combined with the existing content of @p inside.
+  void isTolerated(const LocalPositions& deltas, InsideMask& inside) const;
+
   /// Compute vector norm based on the covariance.
   double squaredNorm(const Vector2& x) const;
 
+  /// Compute vector norms based on the covariance, one vector per row.
+  Distances squaredNorms(const LocalPositions& x) const;
+
+  /// Check if the points are inside a convex polygon w/o any tolerances.
+  template <typename Vector2Container>
+  static void isInsidePolygon(const LocalPositions& points,
+                              const Vector2Container& vertices,
+                              InsideMask& inside);
+
+  /// Calculate the closest points on the polygon.
+  template <typename Vector2Container>
+  void computeClosestPointsOnPolygon(const LocalPositions& points,
+                                     const Vector2Container& vertices,
+                                     LocalPositions& closest) const;
+
   /// Calculate the closest point on the polygon.
   template <typename Vector2Container>
   Vector2 computeClosestPointOnPolygon(const Vector2& point,
@@ -144,8 +216,16 @@ class BoundaryCheck {
       const Vector2& point, const Vector2& lowerLeft,
       const Vector2& upperRight) const;
 
+  /// Calculate the closest points on the box for points outside of it.
+  static void computeEuclideanClosestPointsOutsideRectangle(
+      const LocalPositions& points, const Vector2& lowerLeft,
+      const Vector2& upperRight, LocalPositions& closest);
+
   /// metric weight matrix: identity for absolute mode or inverse covariance
   SymMatrix2 m_weight;
+  /// covariance matrix kept alongside the weight so that neither
+  /// `covariance()` nor `transformed()` has to invert the weight again
+  SymMatrix2 m_covariance;
 
   /// dual use: absolute tolerances or relative chi2/ sigma cut.
   Vector2 m_tolerance;
@@ -172,17 +252,19 @@ inline const Acts::Vector2& Acts::BoundaryCheck::tolerance() const {
 }
 
 inline Acts::SymMatrix2 Acts::BoundaryCheck::covariance() const {
-  return m_weight.inverse();
+  return m_covariance;
 }
 
 inline Acts::BoundaryCheck::BoundaryCheck(bool check)
     : m_weight(SymMatrix2::Identity()),
+      m_covariance(SymMatrix2::Identity()),
       m_tolerance(0, 0),
       m_type(check ? Type::eAbsolute : Type::eNone) {}
 
 inline Acts::BoundaryCheck::BoundaryCheck(bool checkLocal0, bool checkLocal1,
                                           double tolerance0, double tolerance1)
     : m_weight(SymMatrix2::Identity()),
+      m_covariance(SymMatrix2::Identity()),
       m_tolerance(checkLocal0 ? tolerance0 : DBL_MAX,
                   checkLocal1 ? tolerance1 : DBL_MAX),
       m_type(Type::eAbsolute) {}
@@ -190,6 +272,7 @@ inline Acts::BoundaryCheck::BoundaryCheck(bool checkLocal0, bool checkLocal1,
 inline Acts::BoundaryCheck::BoundaryCheck(const SymMatrix2& localCovariance,
                                           double sigmaMax)
     : m_weight(localCovariance.inverse()),
+      m_covariance(localCovariance),
       m_tolerance(sigmaMax, 0),
       m_type(Type::eChi2) {}
 
@@ -201,8 +284,8 @@ inline Acts::BoundaryCheck Acts::BoundaryCheck::transformed(
     // to check both tolerances, even when the initial check does not.
     bc.m_tolerance = (jacobian * m_tolerance).cwiseAbs();
   } else /* Type::eChi2 */ {
-    bc.m_weight =
-        (jacobian * m_weight.inverse() * jacobian.transpose()).inverse();
+    bc.m_covariance = jacobian * m_covariance * jacobian.transpose();
+    bc.m_weight = bc.m_covariance.inverse();
   }
   return bc;
 }
@@ -427,3 +510,219 @@ Acts::BoundaryCheck::computeEuclideanClosestPointOnRectangle(
     }
   }
 }
+
+template <typename Vector2Container>
+inline void Acts::BoundaryCheck::isInside(const LocalPositions& points,
+                                          const Vector2Container& vertices,
+                                          InsideMask& inside) const {
+  if (m_type == Type::eNone) {
+    // The null boundary check always succeeds
+    inside.setConstant(points.rows(), true);
+    return;
+  }
+  isInsidePolygon(points, vertices, inside);
+  // Outside of the polygon we always fail if the tolerance is zero, see the
+  // single point check.
+  if (m_tolerance == Vector2(0., 0.) or inside.all()) {
+    return;
+  }
+  LocalPositions closest;
+  computeClosestPointsOnPolygon(points, vertices, closest);
+  isTolerated(closest - points, inside);
+}
+
+inline void Acts::BoundaryCheck::isInside(const LocalPositions& points,
+                                          const Vector2& lowerLeft,
+                                          const Vector2& upperRight,
+                                          InsideMask& inside) const {
+  const auto x = points.col(0).array();
+  const auto y = points.col(1).array();
+  inside = (lowerLeft[0] <= x) && (x < upperRight[0]) && (lowerLeft[1] <= y) &&
+           (y < upperRight[1]);
+  if (inside.all()) {
+    return;
+  }
+
+  LocalPositions closest;
+  if (m_type == Type::eNone || m_type == Type::eAbsolute) {
+    // absolute, can calculate directly
+    computeEuclideanClosestPointsOutsideRectangle(points, lowerLeft,
+                                                  upperRight, closest);
+  } else /* Type::eChi2 */ {
+    // need to calculate by projection and squarednorm
+    Vector2 vertices[] = {{lowerLeft[0], lowerLeft[1]},
+                          {upperRight[0], lowerLeft[1]},
+                          {upperRight[0], upperRight[1]},
+                          {lowerLeft[0], upperRight[1]}};
+    computeClosestPointsOnPolygon(points, vertices, closest);
+  }
+  isTolerated(closest - points, inside);
+}
+
+template <typename Vector2Container>
+inline void Acts::BoundaryCheck::distance(const LocalPositions& points,
+                                          const Vector2Container& vertices,
+                                          Distances& distances) const {
+  LocalPositions closest;
+  computeClosestPointsOnPolygon(points, vertices, closest);
+  distances = squaredNorms(points - closest).sqrt();
+  InsideMask inside;
+  isInsidePolygon(points, vertices, inside);
+  distances = inside.select(-distances, distances);
+}
+
+inline void Acts::BoundaryCheck::distance(const LocalPositions& points,
+                                          const Vector2& lowerLeft,
+                                          const Vector2& upperRight,
+                                          Distances& distances) const {
+  if (m_type == Type::eNone || m_type == Type::eAbsolute) {
+    const auto x = points.col(0).array();
+    const auto y = points.col(1).array();
+    const InsideMask inside = (lowerLeft[0] <= x) && (x < upperRight[0]) &&
+                              (lowerLeft[1] <= y) && (y < upperRight[1]);
+    // inside the box the closest point is on the closest edge
+    const Distances edge = (upperRight[0] - x)
+                               .abs()
+                               .cwiseMin((lowerLeft[0] - x).abs())
+                               .cwiseMin((upperRight[1] - y).abs())
+                               .cwiseMin((lowerLeft[1] - y).abs());
+    LocalPositions closest;
+    computeEuclideanClosestPointsOutsideRectangle(points, lowerLeft,
+                                                  upperRight, closest);
+    const LocalPositions delta = points - closest;
+    distances = inside.select(-edge, delta.rowwise().norm().array());
+  } else /* Type::eChi2 */ {
+    Vector2 vertices[] = {{lowerLeft[0], lowerLeft[1]},
+                          {upperRight[0], lowerLeft[1]},
+                          {upperRight[0], upperRight[1]},
+                          {lowerLeft[0], upperRight[1]}};
+    distance(points, vertices, distances);
+  }
+}
+
+inline void Acts::BoundaryCheck::isTolerated(const LocalPositions& deltas,
+                                             InsideMask& inside) const {
+  if (m_type == Type::eNone) {
+    inside.setConstant(deltas.rows(), true);
+  } else if (m_type == Type::eAbsolute) {
+    inside = inside || ((deltas.col(0).array().abs() <= m_tolerance[0]) &&
+                        (deltas.col(1).array().abs() <= m_tolerance[1]));
+  } else /* Type::eChi2 */ {
+    // Mahalanobis distances mean is 2 in 2-dim. cut is 1-d sigma.
+    inside = inside || (squaredNorms(deltas) < (2 * m_tolerance[0]));
+  }
+}
+
+inline Acts::BoundaryCheck::Distances Acts::BoundaryCheck::squaredNorms(
+    const LocalPositions& x) const {
+  const auto x0 = x.col(0).array();
+  const auto x1 = x.col(1).array();
+  return (x0 * m_weight(0, 0) + x1 * m_weight(1, 0)) * x0 +
+         (x0 * m_weight(0, 1) + x1 * m_weight(1, 1)) * x1;
+}
+
+template <typename Vector2Container>
+inline void Acts::BoundaryCheck::isInsidePolygon(
+    const LocalPositions& points, const Vector2Container& vertices,
+    InsideMask& inside) {
+  // same algorithm as `detail::VerticesHelper::isInsidePolygon`, but
+  // evaluated for all points at once for each edge
+  const auto x = points.col(0).array();
+  const auto y = points.col(1).array();
+  auto lineSide = [&](const Vector2& ll0, const Vector2& ll1) {
+    const Vector2 normal = ll1 - ll0;
+    return ((normal[0] * (y - ll0[1])) - (normal[1] * (x - ll0[0])))
+        .unaryExpr([](double v) { return std::signbit(v); });
+  };
+
+  auto iv = std::begin(vertices);
+  Vector2 l0 = *iv;
+  Vector2 l1 = *(++iv);
+  // use vertex0 to vertex1 to define reference sign and compare w/ all edges
+  const InsideMask reference = lineSide(l0, l1);
+  inside.setConstant(points.rows(), true);
+  for (++iv; iv != std::end(vertices); ++iv) {
+    l0 = l1;
+    l1 = *iv;
+    inside = inside && (lineSide(l0, l1) == reference);
+  }
+  // manual check for last edge from last vertex back to the first vertex
+  inside = inside && (lineSide(l1, *std::begin(vertices)) == reference);
+}
+
+template <typename Vector2Container>
+inline void Acts::BoundaryCheck::computeClosestPointsOnPolygon(
+    const LocalPositions& points, const Vector2Container& vertices,
+    LocalPositions& closest) const {
+  const Eigen::Index n = points.rows();
+  const auto x = points.col(0).array();
+  const auto y = points.col(1).array();
+  // calculate the closest positions on the segment between `ll0` and `ll1`
+  // to the points as measured by the metric induced by the weight matrix
+  LocalPositions current(n, 2);
+  auto closestOnSegment = [&](const Vector2& ll0, const Vector2& ll1) {
+    // normal vector and position of the closest point along the normal
+    const Vector2 normal = ll1 - ll0;
+    const Vector2 weighted_n = m_weight * normal;
+    const double f = normal.dot(weighted_n);
+    if (std::isnormal(f)) {
+      // u must be in [0, 1] to still be on the polygon segment
+      const Distances u =
+          (((x - ll0[0]) * weighted_n[0] + (y - ll0[1]) * weighted_n[1]) / f)
+              .cwiseMax(0.0)
+              .cwiseMin(1.0);
+      current.col(0) = (ll0[0] + u * normal[0]).matrix();
+      current.col(1) = (ll0[1] + u * normal[1]).matrix();
+    } else {
+      // ll0 and ll1 are so close it doesn't matter
+      current.rowwise() = (ll0 + 0.5 * normal).transpose();
+    }
+  };
+
+  auto iv = std::begin(vertices);
+  Vector2 l0 = *iv;
+  Vector2 l1 = *(++iv);
+  closestOnSegment(l0, l1);
+  closest = current;
+  Distances closestDist = squaredNorms(closest - points);
+  // Calculate the closest points on other connecting lines and compare
+  auto update = [&]() {
+    const Distances currentDist = squaredNorms(current - points);
+    const InsideMask closer = currentDist < closestDist;
+    closest.col(0) = closer.select(current.col(0), closest.col(0));
+    closest.col(1) = closer.select(current.col(1), closest.col(1));
+    closestDist = closer.select(currentDist, closestDist);
+  };
+  for (++iv; iv != std::end(vertices); ++iv) {
+    l0 = l1;
+    l1 = *iv;
+    closestOnSegment(l0, l1);
+    update();
+  }
+  // final edge from last vertex back to the first vertex
+  closestOnSegment(l1, *std::begin(vertices));
+  update();
+}
+
+inline void
+Acts::BoundaryCheck::computeEuclideanClosestPointsOutsideRectangle(
+    const LocalPositions& points, const Vector2& lowerLeft,
+    const Vector2& upperRight, LocalPositions& closest) {
+  // vectorised version of the outside sectors of
+  // `computeEuclideanClosestPointOnRectangle`; the result is only meaningful
+  // for points outside of the box
+  const auto x = points.col(0).array();
+  const auto y = points.col(1).array();
+  const double loc0Min = lowerLeft[0], loc0Max = upperRight[0];
+  const double loc1Min = lowerLeft[1], loc1Max = upperRight[1];
+  const InsideMask above = (y > loc1Max);
+  const InsideMask centralColumn = (x <= loc0Max) && (x >= loc0Min);
+  closest.resize(points.rows(), 2);
+  // sectors I, II, VI and III, IV, VIII
+  closest.col(0) =
+      (x > loc0Max).select(loc0Max, (x < loc0Min).select(loc0Min, x));
+  // sectors V and VII in the central column
+  closest.col(1) = centralColumn.select(
+      above.select(loc1Max, Distances::Constant(points.rows(), loc1Min)),
+      above.select(loc1Max, (y <= loc1Min).select(loc1Min, y)));
+}
@@ -104,6 +104,13 @@ bool Acts::ConvexPolygonBounds<N>::inside(
   return bcheck.isInside(lposition, m_vertices);
 }
 
+template <int N>
+void Acts::ConvexPolygonBounds<N>::insideBatch(
+    const BoundaryCheck::LocalPositions& lpositions,
+    const BoundaryCheck& bcheck, BoundaryCheck::InsideMask& inside) const {
+  bcheck.isInside(lpositions, m_vertices, inside);
+}
+
 template <int N>
 std::vector<Acts::Vector2> Acts::ConvexPolygonBounds<N>::vertices(
     unsigned int /*lseg*/) const {
@@ -85,6 +85,16 @@ class DiamondBounds : public PlanarBounds {
   bool inside(const Vector2& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Inside check for many local positions at once, vectorised over the
+  /// positions
+  ///
+  /// @param lpositions Local positions, one per row
+  /// @param bcheck boundary check directive
+  /// @param [out] inside Result of the check for each position
+  void insideBatch(const BoundaryCheck::LocalPositions& lpositions,
+                   const BoundaryCheck& bcheck,
+                   BoundaryCheck::InsideMask& inside) const final;
+
   /// Return the vertices
   ///
   /// @param lseg the number of segments used to approximate
@@ -499,7 +499,9 @@ class SurfaceArray {
   /// @brief Get the center of the bin identified by global bin index @p bin
   /// @param bin the global bin index
   /// @return Center position of the bin in global coordinates
-  Vector3 getBinCenter(size_t bin) { return p_gridLookup->getBinCenter(bin); }
+  Vector3 getBinCenter(size_t bin) const {
+    return p_gridLookup->getBinCenter(bin);
+  }
 
   /// @brief Get all surfaces attached to this @c SurfaceArray
   /// @return Reference to @c SurfaceVector containing all surfaces
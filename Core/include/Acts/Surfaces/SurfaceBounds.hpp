@@ -68,6 +68,23 @@ class SurfaceBounds {
   virtual bool inside(const Vector2& lposition,
                       const BoundaryCheck& bcheck) const = 0;
 
+  /// Inside check for many local positions at once
+  ///
+  /// The default implementation calls `inside` for each position, bounds
+  /// types with a vectorised check override it.
+  ///
+  /// @param lpositions Local positions, one per row
+  /// @param bcheck boundary check directive
+  /// @param [out] inside Result of the check for each position
+  virtual void insideBatch(const BoundaryCheck::LocalPositions& lpositions,
+                           const BoundaryCheck& bcheck,
+                           BoundaryCheck::InsideMask& inside) const {
+    inside.resize(lpositions.rows());
+    for (Eigen::Index i = 0; i < lpositions.rows(); ++i) {
+      inside[i] = this->inside(lpositions.row(i).transpose(), bcheck);
+    }
+  }
+
   /// Output Method for std::ostream, to be overloaded by child classes
   ///
   /// @param os is the outstream in which the string dump is done
@@ -0,0 +1,102 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+
+#include <vector>
+
+namespace Acts {
+namespace detail {
+/// Helper methods to check one local position against many bounds.
+namespace BoundsBatchHelper {
+
+/// Check one local position against many bounds of the same type
+///
+/// The bounds type is known at compile time, hence the checks are
+/// dispatched statically.
+///
+/// @tparam bounds_t The bounds type
+///
+/// @param bounds The bounds to check against
+/// @param lposition Local position (assumed to be in the frame of all bounds)
+/// @param bcheck boundary check directive
+/// @param [out] inside Result of the check for each bounds
+template <typename bounds_t>
+void insideBounds(const std::vector<const bounds_t*>& bounds,
+                  const Vector2& lposition, const BoundaryCheck& bcheck,
+                  BoundaryCheck::InsideMask& inside) {
+  inside.resize(bounds.size());
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    inside[i] = bounds[i]->bounds_t::inside(lposition, bcheck);
+  }
+}
+
+/// Check one local position against many rectangles
+///
+/// The rectangle limits are gathered into arrays such that the check is
+/// vectorised over the rectangles. Only the covariance based check falls back
+/// to the single rectangle check for the rectangles that do not contain the
+/// position.
+///
+/// @param bounds The bounds to check against
+/// @param lposition Local position (assumed to be in the frame of all bounds)
+/// @param bcheck boundary check directive
+/// @param [out] inside Result of the check for each bounds
+inline void insideBounds(const std::vector<const RectangleBounds*>& bounds,
+                         const Vector2& lposition, const BoundaryCheck& bcheck,
+                         BoundaryCheck::InsideMask& inside) {
+  const Eigen::Index n = bounds.size();
+  Eigen::ArrayXd loc0Min(n), loc0Max(n), loc1Min(n), loc1Max(n);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    loc0Min[i] = bounds[i]->min()[0];
+    loc1Min[i] = bounds[i]->min()[1];
+    loc0Max[i] = bounds[i]->max()[0];
+    loc1Max[i] = bounds[i]->max()[1];
+  }
+  const double l0 = lposition[0];
+  const double l1 = lposition[1];
+  inside = (loc0Min <= l0) && (l0 < loc0Max) && (loc1Min <= l1) &&
+           (l1 < loc1Max);
+  if (inside.all()) {
+    return;
+  }
+
+  if (bcheck.type() == BoundaryCheck::Type::eNone) {
+    inside.setConstant(n, true);
+  } else if (bcheck.type() == BoundaryCheck::Type::eAbsolute) {
+    // closest point on the rectangles, same sectors as in the single
+    // position check of the `BoundaryCheck`
+    const Eigen::ArrayXd l0s = Eigen::ArrayXd::Constant(n, l0);
+    const Eigen::ArrayXd l1s = Eigen::ArrayXd::Constant(n, l1);
+    const BoundaryCheck::InsideMask above = (l1 > loc1Max);
+    const BoundaryCheck::InsideMask centralColumn =
+        (l0 <= loc0Max) && (l0 >= loc0Min);
+    const Eigen::ArrayXd closest0 =
+        (l0 > loc0Max).select(loc0Max, (l0 < loc0Min).select(loc0Min, l0s));
+    const Eigen::ArrayXd closest1 = centralColumn.select(
+        above.select(loc1Max, loc1Min),
+        above.select(loc1Max, (l1 <= loc1Min).select(loc1Min, l1s)));
+    inside = inside ||
+             (((closest0 - l0).abs() <= bcheck.tolerance()[eBoundLoc0]) &&
+              ((closest1 - l1).abs() <= bcheck.tolerance()[eBoundLoc1]));
+  } else /* Type::eChi2 */ {
+    for (Eigen::Index i = 0; i < n; ++i) {
+      if (not inside[i]) {
+        inside[i] = bounds[i]->inside(lposition, bcheck);
+      }
+    }
+  }
+}
+
+}  // namespace BoundsBatchHelper
+}  // namespace detail
+}  // namespace Acts
@@ -209,16 +209,11 @@ struct GaussianSumFitter {
       return GsfError::StartParametersNotOnStartSurface;
     }
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
+    // To be able to find measurements later, we put them into a flat lookup
+    // sorted by geometry identifier
     ACTS_VERBOSE("Preparing " << std::distance(begin, end)
                               << " input measurements");
-    std::map<GeometryIdentifier, std::reference_wrapper<const SourceLink>>
-        inputMeasurements;
-    for (auto it = begin; it != end; ++it) {
-      const SourceLink& sl = *it;
-      inputMeasurements.emplace(sl.geometryId(), *it);
-    }
+    const detail::SourceLinkLookup inputMeasurements(begin, end);
 
     ACTS_VERBOSE(
         "Gsf: Final measuerement map size: " << inputMeasurements.size());
@@ -237,7 +232,7 @@ struct GaussianSumFitter {
 
       // Catch the actor and set the measurements
       auto& actor = fwdPropOptions.actionList.template get<GsfActor>();
-      actor.m_cfg.inputMeasurements = inputMeasurements;
+      actor.m_cfg.inputMeasurements = &inputMeasurements;
       actor.m_cfg.maxComponents = options.maxComponents;
       actor.m_cfg.extensions = options.extensions;
       actor.m_cfg.abortOnError = options.abortOnError;
@@ -298,7 +293,7 @@ struct GaussianSumFitter {
       auto bwdPropOptions = bwdPropInitializer(options, logger);
 
       auto& actor = bwdPropOptions.actionList.template get<GsfActor>();
-      actor.m_cfg.inputMeasurements = inputMeasurements;
+      actor.m_cfg.inputMeasurements = &inputMeasurements;
       actor.m_cfg.maxComponents = options.maxComponents;
       actor.m_cfg.abortOnError = options.abortOnError;
       actor.m_cfg.disableAllMaterialHandling =
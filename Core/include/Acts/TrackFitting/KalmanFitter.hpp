@@ -31,6 +31,7 @@
 #include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
 #include "Acts/TrackFitting/KalmanFitterError.hpp"
 #include "Acts/TrackFitting/detail/KalmanUpdateHelpers.hpp"
+#include "Acts/TrackFitting/detail/SourceLinkLookup.hpp"
 #include "Acts/TrackFitting/detail/VoidKalmanComponents.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Delegate.hpp"
@@ -277,9 +278,7 @@ class KalmanFitter {
     const Surface* targetSurface = nullptr;
 
     /// Allows retrieving measurements for a surface
-    const std::map<GeometryIdentifier,
-                   std::reference_wrapper<const SourceLink>>*
-        inputMeasurements = nullptr;
+    const detail::SourceLinkLookup* inputMeasurements = nullptr;
 
     /// Whether to consider multiple scattering.
     bool multipleScattering = true;
@@ -998,17 +997,11 @@ class KalmanFitter {
       -> std::enable_if_t<!_isdn, Result<KalmanFitterResult>> {
     const auto& logger = kfOptions.logger;
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
+    // To be able to find measurements later, we put them into a flat lookup
+    // sorted by geometry identifier
     ACTS_VERBOSE("Preparing " << std::distance(it, end)
                               << " input measurements");
-    std::map<GeometryIdentifier, std::reference_wrapper<const SourceLink>>
-        inputMeasurements;
-    // for (const auto& sl : sourcelinks) {
-    for (; it != end; ++it) {
-      const SourceLink& sl = *it;
-      inputMeasurements.emplace(sl.geometryId(), sl);
-    }
+    detail::SourceLinkLookup inputMeasurements(it, end);
 
     // Create the ActionList and AbortList
     using KalmanAborter = Aborter<parameters_t>;
@@ -1096,16 +1089,11 @@ class KalmanFitter {
       -> std::enable_if_t<_isdn, Result<KalmanFitterResult>> {
     const auto& logger = kfOptions.logger;
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
+    // To be able to find measurements later, we put them into a flat lookup
+    // sorted by geometry identifier
     ACTS_VERBOSE("Preparing " << std::distance(it, end)
                               << " input measurements");
-    std::map<GeometryIdentifier, std::reference_wrapper<const SourceLink>>
-        inputMeasurements;
-    for (; it != end; ++it) {
-      const SourceLink& sl = *it;
-      inputMeasurements.emplace(sl.geometryId(), sl);
-    }
+    detail::SourceLinkLookup inputMeasurements(it, end);
 
     // Create the ActionList and AbortList
     using KalmanAborter = Aborter<parameters_t>;
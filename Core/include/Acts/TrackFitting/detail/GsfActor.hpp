@@ -23,6 +23,7 @@
 #include "Acts/TrackFitting/detail/GsfUtils.hpp"
 #include "Acts/TrackFitting/detail/KLMixtureReduction.hpp"
 #include "Acts/TrackFitting/detail/KalmanUpdateHelpers.hpp"
+#include "Acts/TrackFitting/detail/SourceLinkLookup.hpp"
 #include "Acts/Utilities/Zip.hpp"
 
 #include <ios>
@@ -82,9 +83,8 @@ struct GsfActor {
     /// Maximum number of components which the GSF should handle
     std::size_t maxComponents = 16;
 
-    /// Input measurements
-    std::map<GeometryIdentifier, std::reference_wrapper<const SourceLink>>
-        inputMeasurements;
+    /// Input measurements, no measurements are used if not set
+    const SourceLinkLookup* inputMeasurements = nullptr;
 
     /// Bethe Heitler Approximator pointer. The fitter holds the approximator
     /// instance TODO if we somehow could initialize a reference here...
@@ -228,13 +228,17 @@ struct GsfActor {
       removeMissedComponents(state, stepper, result.parentTips);
 
       // Check what we have on this surface
-      const auto found_source_link =
-          m_cfg.inputMeasurements.find(surface.geometryId());
+      const SourceLink* found_source_link = nullptr;
+      if (m_cfg.inputMeasurements != nullptr) {
+        const auto slIt = m_cfg.inputMeasurements->find(surface.geometryId());
+        if (slIt != m_cfg.inputMeasurements->end()) {
+          found_source_link = &slIt->second.get();
+        }
+      }
       const bool haveMaterial =
           state.navigation.currentSurface->surfaceMaterial() &&
           !m_cfg.disableAllMaterialHandling;
-      const bool haveMeasurement =
-          found_source_link != m_cfg.inputMeasurements.end();
+      const bool haveMeasurement = found_source_link != nullptr;
 
       ACTS_VERBOSE(std::boolalpha << "haveMaterial " << haveMaterial
                                   << ", haveMeasurement: " << haveMeasurement);
@@ -273,7 +277,7 @@ struct GsfActor {
       // state with the filtered components.
       // NOTE because of early return before we know that we have a measurement
       if (not haveMaterial) {
-        kalmanUpdate(state, stepper, result, found_source_link->second);
+        kalmanUpdate(state, stepper, result, *found_source_link);
 
         result.parentTips = updateStepper(state, stepper, result);
 
@@ -285,7 +289,7 @@ struct GsfActor {
         std::vector<ComponentCache> componentCache;
 
         if (haveMeasurement) {
-          kalmanUpdate(state, stepper, result, found_source_link->second);
+          kalmanUpdate(state, stepper, result, *found_source_link);
 
           convoluteComponents(state, stepper, result, componentCache);
         } else {
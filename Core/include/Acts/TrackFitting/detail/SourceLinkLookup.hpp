@@ -0,0 +1,129 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+namespace detail {
+
+/// Flat lookup of the input source links of a single track by geometry id.
+///
+/// Replaces a `std::map` from geometry identifier to source link in the
+/// fitters: the source links are stored in a single sorted vector, i.e. there
+/// are no per-node allocations. Since the surfaces along the trajectory are
+/// usually visited in the order of their geometry identifiers (or in reverse
+/// order for backward propagation), the lookup first checks the neighbourhood
+/// of the previously found entry before falling back to a binary search.
+///
+/// As for the map, only the first source link is kept if several source links
+/// are given for the same surface.
+///
+/// @note The lookup cursor is updated in const lookups. The object is intended
+///       to be owned by a single fit and must not be shared between threads.
+class SourceLinkLookup {
+ public:
+  using Entry =
+      std::pair<GeometryIdentifier, std::reference_wrapper<const SourceLink>>;
+  using const_iterator = std::vector<Entry>::const_iterator;
+
+  SourceLinkLookup() = default;
+
+  /// Construct from a range of source links.
+  ///
+  /// @tparam source_link_iterator_t Iterator type dereferencing to a type
+  ///         convertible to `const SourceLink&`
+  template <typename source_link_iterator_t>
+  SourceLinkLookup(source_link_iterator_t begin, source_link_iterator_t end) {
+    assign(begin, end);
+  }
+
+  /// Replace the content with the given range of source links.
+  ///
+  /// Input that is already sorted by geometry identifier is not sorted again.
+  template <typename source_link_iterator_t>
+  void assign(source_link_iterator_t begin, source_link_iterator_t end) {
+    m_entries.clear();
+    m_cursor = 0;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<
+                                        source_link_iterator_t>::
+                                        iterator_category>) {
+      m_entries.reserve(std::distance(begin, end));
+    }
+    for (; begin != end; ++begin) {
+      const SourceLink& sl = *begin;
+      m_entries.emplace_back(sl.geometryId(), sl);
+    }
+
+    auto compareIds = [](const Entry& lhs, const Entry& rhs) {
+      return lhs.first < rhs.first;
+    };
+    if (not std::is_sorted(m_entries.begin(), m_entries.end(), compareIds)) {
+      // stable to keep the first source link for duplicated identifiers
+      std::stable_sort(m_entries.begin(), m_entries.end(), compareIds);
+    }
+    auto sameIds = [](const Entry& lhs, const Entry& rhs) {
+      return lhs.first == rhs.first;
+    };
+    m_entries.erase(std::unique(m_entries.begin(), m_entries.end(), sameIds),
+                    m_entries.end());
+  }
+
+  std::size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  /// Find the source link for the given geometry identifier.
+  ///
+  /// @return iterator to the entry or the end iterator if there is none
+  const_iterator find(GeometryIdentifier geoId) const {
+    if (m_entries.empty()) {
+      return end();
+    }
+    // check the previous match and its direct neighbours first
+    const std::size_t first = (0 < m_cursor) ? (m_cursor - 1) : 0;
+    const std::size_t last = std::min(m_cursor + 2, m_entries.size());
+    for (std::size_t i = first; i < last; ++i) {
+      if (m_entries[i].first == geoId) {
+        m_cursor = i;
+        return begin() + i;
+      }
+    }
+    auto it = std::lower_bound(
+        begin(), end(), geoId,
+        [](const Entry& entry, GeometryIdentifier id) {
+          return entry.first < id;
+        });
+    if ((it == end()) or (it->first != geoId)) {
+      return end();
+    }
+    m_cursor = std::distance(begin(), it);
+    return it;
+  }
+
+ private:
+  std::vector<Entry> m_entries;
+  // index of the last match
+  mutable std::size_t m_cursor = 0;
+};
+
+}  // namespace detail
+}  // namespace Acts
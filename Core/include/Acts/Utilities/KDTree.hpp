@@ -13,6 +13,11 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace Acts {
 /// @brief A general k-d tree with fast range search.
@@ -71,21 +76,26 @@ class KDTree {
   ///
   /// @param d The vector of position-value pairs to construct the k-d tree
   /// from.
-  KDTree(vector_t &&d) : m_elems(d) {
+  KDTree(vector_t &&d) : m_elems(std::move(d)) {
+    // All nodes live in one flat array and refer to each other, and to their
+    // range in the element vector, by index. One interesting thing to note is
+    // that all of the nodes in the k-d tree have a range in the element
+    // vector of the tree. They simply make in-place changes to this array,
+    // and they hold no memory of their own.
+    //
+    // A tree with n elements has fewer than 2 * n / LeafSize + 1 nodes in
+    // practice, so reserving this avoids reallocation during construction.
+    m_nodes.reserve(2 * m_elems.size() / LeafSize + 1);
+
     // To start out, we need to check whether we need to construct a leaf node
     // or an internal node. We create a leaf only if we have at most as many
     // elements as the number of elements that can fit into a leaf node.
     // Hopefully most invocations of this constructor will have more than a few
     // elements!
-    //
-    // One interesting thing to note is that all of the nodes in the k-d tree
-    // have a range in the element vector of the outermost node. They simply
-    // make in-place changes to this array, and they hold no memory of their
-    // own.
     if (m_elems.size() > LeafSize) {
-      m_root = std::make_unique<KDTreeNode>(m_elems.begin(), m_elems.end());
+      buildNode(0, m_elems.size());
     } else {
-      m_root = std::make_unique<KDTreeLeaf>(m_elems.begin(), m_elems.end());
+      buildLeaf(0, m_elems.size());
     }
   }
 
@@ -244,26 +254,30 @@ class KDTree {
   ///
   /// Functional programmers will know this method as mapM_.
   ///
+  /// The function is called directly, i.e. it is not wrapped into a
+  /// `std::function`, so that lambdas writing into caller-provided buffers
+  /// can be inlined into the search.
+  ///
+  /// @tparam Callable The type of the function, callable with a coordinate
+  /// and a value.
+  ///
   /// @param r The range to search for.
   /// @param f The mapping function to apply to key-value pairs.
-  void rangeSearchMapDiscard(
-      const range_t &r,
-      std::function<void(const coordinate_t &, const Type &)> f) const {
-    m_root->rangeSearchMapDiscard(r, f);
+  template <typename Callable>
+  void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
+    rangeSearchNode(0, r, f);
   }
 
   /// @brief Return the number of elements in the k-d tree.
   ///
-  /// We simply defer this method to the root node of the k-d tree.
-  ///
   /// @return The number of elements in the k-d tree.
-  std::size_t size(void) const { return m_root->size(); }
+  std::size_t size(void) const { return m_elems.size(); }
 
   /// @brief Return a string representing the structure of the k-d tree.
   ///
   /// Used mostly for debugging purposes. You probably do not want to call this
   /// in actual code.
-  std::string toString(void) const { return m_root->toString(0); }
+  std::string toString(void) const { return toString(0, 0); }
 
   const_iterator_t begin(void) const { return m_elems.begin(); }
 
@@ -284,7 +298,7 @@ class KDTree {
     }
   }
 
-  static range_t boundingBox(iterator_t b, iterator_t e) {
+  static range_t boundingBox(const_iterator_t b, const_iterator_t e) {
     // Firstly, we find the minimum and maximum value in each dimension to
     // construct a bounding box around this node's values.
     std::array<Scalar, Dims> min_v, max_v;
@@ -294,7 +308,7 @@ class KDTree {
       max_v[i] = std::numeric_limits<Scalar>::lowest();
     }
 
-    for (iterator_t i = b; i != e; ++i) {
+    for (const_iterator_t i = b; i != e; ++i) {
       for (std::size_t j = 0; j < Dims; ++j) {
         min_v[j] = std::min(min_v[j], i->first[j]);
         max_v[j] = std::max(max_v[j], i->first[j]);
@@ -312,375 +326,329 @@ class KDTree {
     return r;
   }
 
-  /// @brief An abstract class containing common features of k-d tree node
-  /// types.
+  /// @brief Marker for a missing child node.
+  static constexpr std::size_t s_noNode =
+      std::numeric_limits<std::size_t>::max();
+
+  /// @brief A node in the k-d tree.
   ///
   /// A k-d tree consists of two different node types: leaf nodes and inner
-  /// nodes. These nodes have some common functionality, which is captured by
-  /// this common parent node type.
-  class KDTreeAbstractNode {
-   public:
-    /// @brief Construct the common data for all node types.
-    ///
-    /// The node types share a few concepts, like an n-dimensional range, and a
-    /// begin and end of the range of elements managed. This constructor
-    /// calculates these things so that the individual child constructors don't
-    /// have to.
-    KDTreeAbstractNode(iterator_t _b, iterator_t _e)
-        : m_begin_it(_b),
-          m_end_it(_e),
-          m_range(boundingBox(m_begin_it, m_end_it)) {}
-
-    /// @brief Destroy this node in the k-d tree, and indirectly all of its
-    /// children.
-    virtual ~KDTreeAbstractNode(void) = default;
-
-    /// @brief Perform a range search in the k-d tree, mapping the key-value
-    /// pairs to a side-effecting function.
-    ///
-    /// This is the most powerful range search method we have, assuming that we
-    /// can use arbitrary side effects, which we can. All other range search
-    /// methods are implemented in terms of this particular function.
-    ///
-    /// @param r The range to search for.
-    /// @param f The mapping function to apply to matching elements.
-    virtual void rangeSearchMapDiscard(
-        const range_t &r,
-        std::function<void(const coordinate_t &, const Type &)> f) const = 0;
-
-    /// @brief Debugging method that gives a textual representation of a k-d
-    /// tree.
-    ///
-    /// It is probably best not to use this method in real code. It is designed
-    /// for debugging purposes only.
-    ///
-    /// @param d The depth of this node (for indentation).
-    virtual std::string toString(std::size_t d) const = 0;
-
-    /// @brief Determine the number of elements managed by this node.
-    ///
-    /// Conveniently, this number is always equal to the distance between the
-    /// begin iterator and the end iterator, so we can simply delegate to the
-    /// relevant standard library method.
-    ///
-    /// @return The number of elements below this node.
-    std::size_t size(void) const { return std::distance(m_begin_it, m_end_it); }
-
-    /// @brief The axis-aligned bounding box containing all elements in this
-    /// node.
-    ///
-    /// @return The minimal axis-aligned bounding box that contains all the
-    /// elements under this node.
-    const range_t &range(void) const { return m_range; }
-
-   protected:
-    /// @brief The start and end of the range of coordinate-value pairs under
-    /// this node.
-    const iterator_t m_begin_it, m_end_it;
-
+  /// nodes. Both are stored in the same flat array, and refer to their
+  /// children and their elements by index.
+  struct Node {
     /// @brief The axis-aligned bounding box of the coordinates under this
     /// node.
-    const range_t m_range;
-  };
-
-  /// @brief A non-leaf node in the k-d tree.
-  ///
-  /// These nodes are not the direct parents of any coordinate-value pairs, but
-  /// rather they are the parents of two other nodes. This means that this type
-  /// of node represents a split of the candidate space across a particular
-  /// dimension.
-  class KDTreeNode final : public KDTreeAbstractNode {
-   public:
-    /// @brief Constract an internal node from a range of coordinate-value
-    /// pairs.
-    ///
-    /// The element range passed to this constructor is a subrange of the set
-    /// of coordinate-value pairs owned by the outer-most parent node. The
-    /// constructor rearranges the elements of this range.
-    ///
-    /// @param _b The iterator for the start of the range of elements.
-    /// @param _e The iterator for the end of the range of elements.
-    KDTreeNode(iterator_t _b, iterator_t _e) : KDTreeAbstractNode(_b, _e) {
-      // This constant determines the maximum number of elements where we still
-      // calculate the exact median of the values for the purposes of
-      // splitting. In general, the closer the pivot value is to the true
-      // median, the more balanced the tree will be. However, calculating the
-      // median exactly is an O(n log n) operation, while approximating it is
-      // an O(1) time.
-      constexpr std::size_t max_exact_median = 128;
-
-      // The following set of operations is designed to find the variance (of
-      // normalized values) of the values in each of the dimensions. We do this
-      // because the optimal way of constructing a k-d tree is to select the
-      // pivot dimension as the dimension with the highest variance. To this
-      // end, we first start by calculating the sum of all the values.
-      std::array<Scalar, Dims> sum_v;
-
-      sum_v.fill(0.0);
-
-      for (iterator_t i = this->m_begin_it; i != this->m_end_it; ++i) {
-        for (std::size_t j = 0; j < Dims; ++j) {
-          // We normalize the values to be in the [0, 1] range, because
-          // otherwise the dimension with the higher valued elements would
-          // always win.
-          Scalar value = (i->first[j] - this->m_range[j].min()) /
-                         (this->m_range[j].max() - this->m_range[j].min());
-          sum_v[j] += value;
-        }
-      }
+    range_t range;
 
-      // Using the sum in each dimension, we can now calculate the mean in each
-      // dimension.
-      std::array<Scalar, Dims> mean_v;
+    /// @brief The start and end of the range of coordinate-value pairs under
+    /// this node, as indices into the element vector.
+    std::size_t begin = 0, end = 0;
 
-      for (std::size_t j = 0; j < Dims; ++j) {
-        mean_v[j] = sum_v[j] / this->size();
-      }
+    /// @brief The indices of the left and right children, if any.
+    std::size_t lhs = s_noNode, rhs = s_noNode;
 
-      // Next, we calculate the summed squared error from the mean in each
-      // dimension, again with the normalized values.
-      std::array<Scalar, Dims> sqe_v;
-      sqe_v.fill(0);
+    /// @brief The index of the pivot dimension.
+    std::size_t dim = 0;
 
-      for (iterator_t i = this->m_begin_it; i != this->m_end_it; ++i) {
-        for (std::size_t j = 0; j < Dims; ++j) {
-          Scalar value = (i->first[j] - this->m_range[j].min()) /
-                         (this->m_range[j].max() - this->m_range[j].min());
-          sqe_v[j] += std::pow(value - mean_v[j], 2.0);
-        }
-      }
+    /// @brief The value of the pivot in the pivot dimension.
+    Scalar mid = 0;
 
-      // Finally, we calculate the variance of the elements in each dimension.
-      std::array<Scalar, Dims> var_v;
+    /// @brief Whether the node is a leaf, i.e. holds elements directly.
+    bool leaf = true;
 
-      for (std::size_t j = 0; j < Dims; ++j) {
-        var_v[j] = sqe_v[j] / this->size();
-      }
+    /// @brief Determine the number of elements managed by this node.
+    std::size_t size(void) const { return end - begin; }
+  };
 
-      // Next, we find the dimension with the highest variance, and we will
-      // keep that as our pivot dimension.
-      m_dim = 0;
+  /// @brief Construct a leaf node from a range of elements.
+  ///
+  /// @param b The index of the first element of the leaf.
+  /// @param e The index past the last element of the leaf.
+  ///
+  /// @return The index of the new node.
+  std::size_t buildLeaf(std::size_t b, std::size_t e) {
+    Node node;
+    node.begin = b;
+    node.end = e;
+    node.range = boundingBox(m_elems.begin() + b, m_elems.begin() + e);
+    node.leaf = true;
+    m_nodes.push_back(node);
+    return m_nodes.size() - 1;
+  }
 
+  /// @brief Construct an internal node from a range of coordinate-value
+  /// pairs, and recursively all of its children.
+  ///
+  /// The element range passed to this method is a subrange of the set of
+  /// coordinate-value pairs owned by the tree. This method rearranges the
+  /// elements of this range.
+  ///
+  /// @param b The index of the first element of the node.
+  /// @param e The index past the last element of the node.
+  ///
+  /// @return The index of the new node.
+  std::size_t buildNode(std::size_t b, std::size_t e) {
+    // This constant determines the maximum number of elements where we still
+    // calculate the exact median of the values for the purposes of
+    // splitting. In general, the closer the pivot value is to the true
+    // median, the more balanced the tree will be. However, calculating the
+    // median exactly is an O(n) operation, while approximating it is an O(1)
+    // time.
+    constexpr std::size_t max_exact_median = 128;
+
+    const iterator_t begin_it = m_elems.begin() + b;
+    const iterator_t end_it = m_elems.begin() + e;
+    const std::size_t size = e - b;
+    const range_t range = boundingBox(begin_it, end_it);
+
+    // The following set of operations is designed to find the variance (of
+    // normalized values) of the values in each of the dimensions. We do this
+    // because the optimal way of constructing a k-d tree is to select the
+    // pivot dimension as the dimension with the highest variance. To this
+    // end, we first start by calculating the sum of all the values.
+    std::array<Scalar, Dims> sum_v;
+
+    sum_v.fill(0.0);
+
+    for (iterator_t i = begin_it; i != end_it; ++i) {
       for (std::size_t j = 0; j < Dims; ++j) {
-        if (var_v[j] > var_v[m_dim]) {
-          m_dim = j;
-        }
+        // We normalize the values to be in the [0, 1] range, because
+        // otherwise the dimension with the higher valued elements would
+        // always win.
+        Scalar value =
+            (i->first[j] - range[j].min()) / (range[j].max() - range[j].min());
+        sum_v[j] += value;
       }
+    }
 
-      // Next, we need to determine the pivot point of this node, that is to
-      // say the point in the selected pivot dimension along which point we
-      // will split the range. To do this, we check how large the set of
-      // elements is. If it is sufficiently small, we use the median. Otherwise
-      // we use the mean.
-      if (this->size() > max_exact_median) {
-        // In this case, we have a lot of elemenents, and sorting the range to
-        // find the true median might be too expensive. Therefore, we will just
-        // use the middle value between the minimum and maximum. This is not
-        // nearly as accurate as using the median, but it's a nice cheat.
-        m_mid = 0.5 * (this->m_range[m_dim].max() + this->m_range[m_dim].min());
-      } else {
-        // If the number of elements is fairly small, we will just calculate
-        // the median exactly. We do this by finding the values in the
-        // dimension, sorting it, and then taking the middle one.
-        std::vector<Scalar> idxs;
-        idxs.reserve(this->size());
-
-        for (iterator_t i = this->m_begin_it; i != this->m_end_it; ++i) {
-          idxs.push_back(i->first[m_dim]);
-        }
-
-        std::sort(idxs.begin(), idxs.end());
-        m_mid = idxs[idxs.size() / 2];
-      }
+    // Using the sum in each dimension, we can now calculate the mean in each
+    // dimension.
+    std::array<Scalar, Dims> mean_v;
 
-      // This is the meat of the pudding of our tree creation algorithm. We
-      // partition the range using `std::partition`, which means we put all the
-      // values lower than the midpoint on the left side of the range, and all
-      // the values that are higher on the right. Then we get the pivot
-      // iterator, which gives us the middle point.
-      auto pivot = std::partition(
-          this->m_begin_it, this->m_end_it,
-          [=](const pair_t &i) { return i.first[m_dim] < m_mid; });
-
-      // This should never really happen, but in very select cases where there
-      // are a lot of equal values in the range, the pivot can end up all the
-      // way at the end of the array and we end up in an infinite loop. We
-      // check for pivot points which would not split the range, and fix them
-      // if they occur.
-      if (pivot == this->m_begin_it || pivot == std::prev(this->m_end_it)) {
-        pivot = std::next(this->m_begin_it, LeafSize);
-      }
+    for (std::size_t j = 0; j < Dims; ++j) {
+      mean_v[j] = sum_v[j] / size;
+    }
 
-      // Calculate the number of elements on the left-hand side, as well as the
-      // right-hand side. We do this by calculating the difference from the
-      // begin and end of the array to the pivot point.
-      std::size_t lhs_size = std::distance(this->m_begin_it, pivot);
-      std::size_t rhs_size = std::distance(pivot, this->m_end_it);
-
-      // Next, we check whether the left-hand node should be another internal
-      // node or a leaf node, and we construct the node recursively.
-      if (lhs_size > LeafSize) {
-        m_lhs = std::make_unique<KDTreeNode>(this->m_begin_it, pivot);
-      } else if (lhs_size > 0) {
-        m_lhs = std::make_unique<KDTreeLeaf>(this->m_begin_it, pivot);
-      }
+    // Next, we calculate the summed squared error from the mean in each
+    // dimension, again with the normalized values.
+    std::array<Scalar, Dims> sqe_v;
+    sqe_v.fill(0);
 
-      // Same on the right hand side.
-      if (rhs_size > LeafSize) {
-        m_rhs = std::make_unique<KDTreeNode>(pivot, this->m_end_it);
-      } else if (rhs_size > 0) {
-        m_rhs = std::make_unique<KDTreeLeaf>(pivot, this->m_end_it);
+    for (iterator_t i = begin_it; i != end_it; ++i) {
+      for (std::size_t j = 0; j < Dims; ++j) {
+        Scalar value =
+            (i->first[j] - range[j].min()) / (range[j].max() - range[j].min());
+        sqe_v[j] += std::pow(value - mean_v[j], 2.0);
       }
     }
 
-    /// @brief Perform a range search in this (sub-)k-d tree.
-    ///
-    /// Performing a range search on an inner node is essentially the same as
-    /// performing that same range search on both its children and appending
-    /// them. However, we can also do some optimisations.
-    ///
-    /// @param r The orthogonal range to search for.
-    /// @param f The mapping function to execute.
-    virtual void rangeSearchMapDiscard(
-        const range_t &r,
-        std::function<void(const coordinate_t &, const Type &)> f)
-        const override {
-      // Firstly, we can check if the range completely contains the bounding
-      // box of this node. If that is the case, we know for certain that any
-      // value contained below this node should end up in the output, and we
-      // can stop recursively looking for them.
-      if (r >= this->m_range) {
-        // We can also pre-allocate space for the number of elements, since we
-        // are inserting all of them anyway.
-        for (iterator_t i = this->m_begin_it; i != this->m_end_it; ++i) {
-          f(i->first, i->second);
-        }
+    // Finally, we calculate the variance of the elements in each dimension.
+    std::array<Scalar, Dims> var_v;
 
-        return;
-      }
+    for (std::size_t j = 0; j < Dims; ++j) {
+      var_v[j] = sqe_v[j] / size;
+    }
 
-      // If we have a left-hand node (which we should!), then we check if there
-      // is any overlap between the target range and the bounding box of the
-      // left-hand node. If there is, we recursively search in that node.
-      if (m_lhs && (m_lhs->range() && r)) {
-        m_lhs->rangeSearchMapDiscard(r, f);
-      }
+    // Next, we find the dimension with the highest variance, and we will
+    // keep that as our pivot dimension.
+    std::size_t dim = 0;
 
-      // Then, we perform exactly the same procedure for the right hand side.
-      if (m_rhs && (m_rhs->range() && r)) {
-        m_rhs->rangeSearchMapDiscard(r, f);
+    for (std::size_t j = 0; j < Dims; ++j) {
+      if (var_v[j] > var_v[dim]) {
+        dim = j;
       }
     }
 
-    /// @brief Debugging string method for this (sub-)k-d tree.
-    ///
-    /// This prints information to stdout about the structure of the (sub-)tree
-    /// defined by this node. Not designed for use in real code.
-    ///
-    /// @param i The amount of indentation to use.
-    virtual std::string toString(std::size_t i) const override {
-      std::stringstream out;
-
-      // First, we print some indentation to make the output look nicer.
-      for (std::size_t j = 0; j < i; ++j) {
-        out << " ";
-      }
-
-      // Print some information about the node.
-      out << "Node with range " << this->m_range[m_dim].min() << " to "
-          << this->m_mid << " to " << this->m_range[m_dim].max()
-          << " (total size " << this->size() << ")" << std::endl;
+    // Next, we need to determine the pivot point of this node, that is to
+    // say the point in the selected pivot dimension along which point we
+    // will split the range. To do this, we check how large the set of
+    // elements is. If it is sufficiently small, we use the median. Otherwise
+    // we use the mean.
+    Scalar mid;
+
+    if (size > max_exact_median) {
+      // In this case, we have a lot of elemenents, and finding the true
+      // median might be too expensive. Therefore, we will just use the middle
+      // value between the minimum and maximum. This is not nearly as accurate
+      // as using the median, but it's a nice cheat.
+      mid = 0.5 * (range[dim].max() + range[dim].min());
+    } else {
+      // If the number of elements is fairly small, we will just calculate
+      // the median exactly. We do this by copying the values in the
+      // dimension into a fixed-size buffer, and selecting the middle one.
+      std::array<Scalar, max_exact_median> idxs;
 
-      // Then, recursively print the left-hand side...
-      if (m_lhs) {
-        out << m_lhs->toString(i + 1);
+      for (std::size_t i = 0; i < size; ++i) {
+        idxs[i] = m_elems[b + i].first[dim];
       }
 
-      // ...and the right-hand side.
-      if (m_rhs) {
-        out << m_rhs->toString(i + 1);
-      }
+      std::nth_element(idxs.begin(), idxs.begin() + size / 2,
+                       idxs.begin() + size);
+      mid = idxs[size / 2];
+    }
 
-      return out.str();
+    // This is the meat of the pudding of our tree creation algorithm. We
+    // partition the range using `std::partition`, which means we put all the
+    // values lower than the midpoint on the left side of the range, and all
+    // the values that are higher on the right. Then we get the pivot
+    // iterator, which gives us the middle point.
+    auto pivot = std::partition(
+        begin_it, end_it, [=](const pair_t &i) { return i.first[dim] < mid; });
+
+    // This should never really happen, but in very select cases where there
+    // are a lot of equal values in the range, the pivot can end up all the
+    // way at the end of the array and we end up in an infinite loop. We
+    // check for pivot points which would not split the range, and fix them
+    // if they occur.
+    if (pivot == begin_it || pivot == std::prev(end_it)) {
+      pivot = std::next(begin_it, LeafSize);
     }
 
-   private:
-    /// @brief Pointers to the left and right children.
-    std::unique_ptr<KDTreeAbstractNode> m_lhs, m_rhs;
+    const std::size_t p = std::distance(m_elems.begin(), pivot);
+
+    // The node is added before its children, so that the children of a node
+    // always come after it in the node array. Note that references into the
+    // node array are invalidated by the construction of the children.
+    Node node;
+    node.begin = b;
+    node.end = e;
+    node.range = range;
+    node.dim = dim;
+    node.mid = mid;
+    node.leaf = false;
+    m_nodes.push_back(node);
+    const std::size_t index = m_nodes.size() - 1;
+
+    // Calculate the number of elements on the left-hand side, as well as the
+    // right-hand side.
+    const std::size_t lhs_size = p - b;
+    const std::size_t rhs_size = e - p;
+
+    // Next, we check whether the left-hand node should be another internal
+    // node or a leaf node, and we construct the node recursively.
+    std::size_t lhs = s_noNode;
+    if (lhs_size > LeafSize) {
+      lhs = buildNode(b, p);
+    } else if (lhs_size > 0) {
+      lhs = buildLeaf(b, p);
+    }
+    m_nodes[index].lhs = lhs;
+
+    // Same on the right hand side.
+    std::size_t rhs = s_noNode;
+    if (rhs_size > LeafSize) {
+      rhs = buildNode(p, e);
+    } else if (rhs_size > 0) {
+      rhs = buildLeaf(p, e);
+    }
+    m_nodes[index].rhs = rhs;
 
-    /// @brief The index of the pivot dimension.
-    std::size_t m_dim;
+    return index;
+  }
 
-    /// @brief The value of the pivot in the pivot dimension.
-    Scalar m_mid;
-  };
+  /// @brief Perform a range search in a (sub-)k-d tree.
+  ///
+  /// Performing a range search on an inner node is essentially the same as
+  /// performing that same range search on both its children and appending
+  /// them. However, we can also do some optimisations.
+  ///
+  /// @param n The index of the node to search in.
+  /// @param r The orthogonal range to search for.
+  /// @param f The mapping function to execute.
+  template <typename Callable>
+  void rangeSearchNode(std::size_t n, const range_t &r, Callable &f) const {
+    const Node &node = m_nodes[n];
 
-  class KDTreeLeaf final : public KDTreeAbstractNode {
-   public:
-    /// @brief Construct a leaf node from a range of elements.
-    ///
-    /// This doesn't actually do anything that the abstract base constructor
-    /// doesn't do.
-    ///
-    /// @param _b The begin iterator of the range of values.
-    /// @param _e The end iterator of the range of values.
-    KDTreeLeaf(iterator_t _b, iterator_t _e) : KDTreeAbstractNode(_b, _e) {}
-
-    /// @brief Perform a range on this leaf node.
-    ///
-    /// Performing a range search on a leaf node is rather simple, because we
-    /// just need to check whether each of the elements in the node is actually
-    /// inside the range.
-    ///
-    /// @param r The range to search for.
-    /// @param f The mapping function to apply.
-    virtual void rangeSearchMapDiscard(
-        const range_t &r,
-        std::function<void(const coordinate_t &, const Type &)> f)
-        const override {
-      // Determine whether the range completely covers the bounding box of this
-      // leaf node. If it is, we can copy all values without having to check
-      // for them being inside the range again.
-      bool contained = r >= this->m_range;
+    if (node.leaf) {
+      // Determine whether the range completely covers the bounding box of
+      // this leaf node. If it is, we can copy all values without having to
+      // check for them being inside the range again.
+      bool contained = r >= node.range;
 
       // Iterate over all the elements in this leaf node. This should be a
       // relatively small number (the LeafSize template parameter).
-      for (iterator_t i = this->m_begin_it; i != this->m_end_it; ++i) {
+      for (std::size_t i = node.begin; i != node.end; ++i) {
         // We need to check whether the element is actually inside the range.
         // In case this node's bounding box is fully contained within the
         // range, we don't actually need to check this.
-        if (contained || r.contains(i->first)) {
-          f(i->first, i->second);
+        if (contained || r.contains(m_elems[i].first)) {
+          f(m_elems[i].first, m_elems[i].second);
         }
       }
+
+      return;
     }
 
-    /// @brief Debugging string method for this (sub-)k-d tree.
-    ///
-    /// This prints information to stdout about the structure of the (sub-)tree
-    /// defined by this node. Not designed for use in real code.
-    ///
-    /// @param i The amount of indentation to use.
-    virtual std::string toString(std::size_t i) const override {
-      std::stringstream out;
-
-      // Again, we start out by printing some nice indentation.
-      for (std::size_t j = 0; j < i; ++j) {
-        out << " ";
+    // Firstly, we can check if the range completely contains the bounding
+    // box of this node. If that is the case, we know for certain that any
+    // value contained below this node should end up in the output, and we
+    // can stop recursively looking for them.
+    if (r >= node.range) {
+      for (std::size_t i = node.begin; i != node.end; ++i) {
+        f(m_elems[i].first, m_elems[i].second);
       }
 
-      // There isn't much to say about leaf nodes...
-      out << "Leaf with " << this->size() << " objects" << std::endl;
+      return;
+    }
+
+    // If we have a left-hand node (which we should!), then we check if there
+    // is any overlap between the target range and the bounding box of the
+    // left-hand node. If there is, we recursively search in that node.
+    if (node.lhs != s_noNode && (m_nodes[node.lhs].range && r)) {
+      rangeSearchNode(node.lhs, r, f);
+    }
 
+    // Then, we perform exactly the same procedure for the right hand side.
+    if (node.rhs != s_noNode && (m_nodes[node.rhs].range && r)) {
+      rangeSearchNode(node.rhs, r, f);
+    }
+  }
+
+  /// @brief Debugging string method for a (sub-)k-d tree.
+  ///
+  /// This prints information to stdout about the structure of the (sub-)tree
+  /// defined by a node. Not designed for use in real code.
+  ///
+  /// @param n The index of the node.
+  /// @param i The amount of indentation to use.
+  std::string toString(std::size_t n, std::size_t i) const {
+    std::stringstream out;
+    const Node &node = m_nodes[n];
+
+    // First, we print some indentation to make the output look nicer.
+    for (std::size_t j = 0; j < i; ++j) {
+      out << " ";
+    }
+
+    if (node.leaf) {
+      // There isn't much to say about leaf nodes...
+      out << "Leaf with " << node.size() << " objects" << std::endl;
       return out.str();
     }
-  };
+
+    // Print some information about the node.
+    out << "Node with range " << node.range[node.dim].min() << " to "
+        << node.mid << " to " << node.range[node.dim].max() << " (total size "
+        << node.size() << ")" << std::endl;
+
+    // Then, recursively print the left-hand side...
+    if (node.lhs != s_noNode) {
+      out << toString(node.lhs, i + 1);
+    }
+
+    // ...and the right-hand side.
+    if (node.rhs != s_noNode) {
+      out << toString(node.rhs, i + 1);
+    }
+
+    return out.str();
+  }
 
   /// @brief Vector containing all of the elements in this k-d tree, including
   /// the elements managed by the nodes inside of it.
   vector_t m_elems;
 
-  /// @brief Pointer to the root node of this k-d tree.
-  std::unique_ptr<KDTreeAbstractNode> m_root;
+  /// @brief Flat array of all nodes, the root node is the first one.
+  std::vector<Node> m_nodes;
 };
 }  // namespace Acts
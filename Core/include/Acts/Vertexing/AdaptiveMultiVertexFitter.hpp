@@ -261,6 +261,19 @@ class AdaptiveMultiVertexFitter {
       State& state, Vertex<InputTrack_t>* vtx,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
+  /// @brief Estimates the `ip3dParams` of a batch of tracks w.r.t. a common
+  /// reference position and stores them in the vertex info
+  ///
+  /// @param state The state to operate on
+  /// @param vtxInfo The vertex info to store the parameters in
+  /// @param tracks The tracks
+  /// @param refPos The reference position
+  /// @param vertexingOptions Vertexing options
+  Result<void> setImpactParameters(
+      State& state, VertexInfo<InputTrack_t>& vtxInfo,
+      const std::vector<const InputTrack_t*>& tracks, const Vector3& refPos,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+
   /// @brief Sets vertexCompatibility for all TrackAtVertex objects
   /// at current vertex
   ///
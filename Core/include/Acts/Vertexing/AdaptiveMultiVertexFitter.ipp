@@ -199,16 +199,39 @@ Acts::Result<void> Acts::
   // The seed position
   const Vector3& seedPos = currentVtxInfo.seedPosition.template head<3>();
 
-  // Loop over all tracks at current vertex
-  for (const auto& trk : currentVtxInfo.trackLinks) {
-    auto res = m_cfg.ipEst.estimate3DImpactParameters(
-        vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_extractParameters(*trk), seedPos, state.ipState);
+  // Estimate the impact parameters of all tracks at current vertex at once
+  return setImpactParameters(state, currentVtxInfo,
+                             currentVtxInfo.trackLinks, seedPos,
+                             vertexingOptions);
+}
+
+template <typename input_track_t, typename linearizer_t>
+Acts::Result<void> Acts::
+    AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::setImpactParameters(
+        State& state, VertexInfo<input_track_t>& vtxInfo,
+        const std::vector<const input_track_t*>& tracks,
+        const Vector3& refPos,
+        const VertexingOptions<input_track_t>& vertexingOptions) const {
+  std::vector<BoundTrackParameters> params;
+  params.reserve(tracks.size());
+  std::vector<const BoundTrackParameters*> paramPointers;
+  paramPointers.reserve(tracks.size());
+  for (const input_track_t* trk : tracks) {
+    params.push_back(m_extractParameters(*trk));
+    paramPointers.push_back(&params.back());
+  }
+
+  auto results = m_cfg.ipEst.estimate3DImpactParameters(
+      vertexingOptions.geoContext, vertexingOptions.magFieldContext,
+      paramPointers, refPos, state.ipState);
+
+  for (size_t iTrack = 0; iTrack < tracks.size(); ++iTrack) {
+    auto& res = results[iTrack];
     if (!res.ok()) {
       return res.error();
     }
     // Set ip3dParams for current trackAtVertex
-    currentVtxInfo.ip3dParams.emplace(trk, *(res.value()));
+    vtxInfo.ip3dParams.emplace(tracks[iTrack], *(res.value()));
   }
   return {};
 }
@@ -221,25 +244,29 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[currentVtx];
 
+  // Recover from cases where linearization point != 0 but
+  // more tracks were added later on
+  std::vector<const input_track_t*> missingTracks;
+  for (const auto& trk : currentVtxInfo.trackLinks) {
+    if (currentVtxInfo.ip3dParams.find(trk) ==
+        currentVtxInfo.ip3dParams.end()) {
+      missingTracks.push_back(trk);
+    }
+  }
+  if (not missingTracks.empty()) {
+    auto res = setImpactParameters(
+        state, currentVtxInfo, missingTracks,
+        VectorHelpers::position(currentVtxInfo.linPoint), vertexingOptions);
+    if (!res.ok()) {
+      return res.error();
+    }
+  }
+
   // Loop over tracks at current vertex and
   // estimate compatibility with vertex
   for (const auto& trk : currentVtxInfo.trackLinks) {
     auto& trkAtVtx =
         state.tracksAtVerticesMap.at(std::make_pair(trk, currentVtx));
-    // Recover from cases where linearization point != 0 but
-    // more tracks were added later on
-    if (currentVtxInfo.ip3dParams.find(trk) ==
-        currentVtxInfo.ip3dParams.end()) {
-      auto res = m_cfg.ipEst.estimate3DImpactParameters(
-          vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-          m_extractParameters(*trk),
-          VectorHelpers::position(currentVtxInfo.linPoint), state.ipState);
-      if (!res.ok()) {
-        return res.error();
-      }
-      // Set ip3dParams for current trackAtVertex
-      currentVtxInfo.ip3dParams.emplace(trk, *(res.value()));
-    }
     // Set compatibility with current vertex
     auto compRes = m_cfg.ipEst.get3dVertexCompatibility(
         vertexingOptions.geoContext, &(currentVtxInfo.ip3dParams.at(trk)),
@@ -259,6 +286,13 @@ Acts::Result<void> Acts::
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   for (auto vtx : state.vertexCollection) {
     VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[vtx];
+
+    // Set the track weights and collect the tracks that need to be
+    // (re-)linearized
+    std::vector<const input_track_t*> linTracks;
+    std::vector<BoundTrackParameters> linParams;
+    linParams.reserve(currentVtxInfo.trackLinks.size());
+    std::vector<const BoundTrackParameters*> linParamPointers;
     for (const auto& trk : currentVtxInfo.trackLinks) {
       auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
 
@@ -268,19 +302,34 @@ Acts::Result<void> Acts::
           collectTrackToVertexCompatibilities(state, trk));
       trkAtVtx.trackWeight = currentTrkWeight;
 
+      // Check if linearization state exists or need to be relinearized
+      if (trkAtVtx.trackWeight > m_cfg.minWeight and
+          (not trkAtVtx.isLinearized || currentVtxInfo.relinearize)) {
+        linTracks.push_back(trk);
+        linParams.push_back(m_extractParameters(*trk));
+        linParamPointers.push_back(&linParams.back());
+      }
+    }
+
+    // Linearize all of them at once
+    auto linResults = Acts::linearizeTracks(
+        linearizer, linParamPointers, currentVtxInfo.oldPosition,
+        vertexingOptions.geoContext, vertexingOptions.magFieldContext,
+        state.linearizerState);
+
+    size_t iLinTrack = 0;
+    for (const auto& trk : currentVtxInfo.trackLinks) {
+      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
-        // Check if linearization state exists or need to be relinearized
-        if (not trkAtVtx.isLinearized || state.vtxInfoMap[vtx].relinearize) {
-          auto result = linearizer.linearizeTrack(
-              m_extractParameters(*trk), state.vtxInfoMap[vtx].oldPosition,
-              vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-              state.linearizerState);
+        if (iLinTrack < linTracks.size() and linTracks[iLinTrack] == trk) {
+          auto& result = linResults[iLinTrack++];
           if (!result.ok()) {
             return result.error();
           }
 
           if (trkAtVtx.isLinearized) {
-            state.vtxInfoMap[vtx].linPoint = state.vtxInfoMap[vtx].oldPosition;
+            currentVtxInfo.linPoint = currentVtxInfo.oldPosition;
           }
 
           trkAtVtx.linearizedState = *result;
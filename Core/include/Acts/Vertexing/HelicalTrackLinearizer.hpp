@@ -16,9 +16,12 @@
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/LinearizedTrack.hpp"
 
+#include <vector>
+
 namespace Acts {
 
 /// @class HelicalTrackLinearizer
@@ -55,6 +58,10 @@ class HelicalTrackLinearizer {
         : fieldCache(std::move(fieldCacheIn)) {}
     /// Magnetic field cache
     MagneticFieldProvider::Cache fieldCache;
+    /// Propagation result re-used for all linearizations with this state
+    typename propagator_t::template ResultType<BoundTrackParameters,
+                                               propagator_options_t>
+        propagationResult;
   };
 
   /// @brief Configuration struct
@@ -105,9 +112,46 @@ class HelicalTrackLinearizer {
                                          const Acts::MagneticFieldContext& mctx,
                                          State& state) const;
 
+  /// @brief Function that linearizes a collection of BoundTrackParameters
+  /// at a common linearization point
+  ///
+  /// Equivalent to calling linearizeTrack for every track, but the perigee
+  /// surface at the linearization point and the propagator options are
+  /// created only once and shared by all tracks. All propagations write into
+  /// the propagation result held by the state.
+  ///
+  /// @param params Parameters to linearize
+  /// @param linPoint Linearization point
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  /// @param state The state object
+  ///
+  /// @return Linearized tracks, in the same order as the input parameters
+  std::vector<Result<LinearizedTrack>> linearizeTracks(
+      const std::vector<const BoundTrackParameters*>& params,
+      const Vector4& linPoint, const Acts::GeometryContext& gctx,
+      const Acts::MagneticFieldContext& mctx, State& state) const;
+
  private:
   /// Configuration object
   const Config m_cfg;
+
+  /// @brief Linearize BoundTrackParameters using an existing perigee
+  /// surface at the linearization point
+  ///
+  /// @param params Parameters to linearize
+  /// @param linPoint Linearization point
+  /// @param perigeeSurface Perigee surface at the linearization point
+  /// @param pOptions Propagator options for the propagation to the surface
+  /// @param gctx The geometry context
+  /// @param state The state object
+  ///
+  /// @return Linearized track
+  Result<LinearizedTrack> linearizeTrackAtSurface(
+      const BoundTrackParameters& params, const Vector4& linPoint,
+      const PerigeeSurface& perigeeSurface,
+      const propagator_options_t& pOptions, const Acts::GeometryContext& gctx,
+      State& state) const;
 };
 
 }  // namespace Acts
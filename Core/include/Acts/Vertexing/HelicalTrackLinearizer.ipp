@@ -24,15 +24,55 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
   pOptions.direction = NavigationDirection::Backward;
 
-  const BoundTrackParameters* endParams = nullptr;
-  // Do the propagation to linPointPos
-  auto result = m_cfg.propagator->propagate(params, *perigeeSurface, pOptions);
-  if (result.ok()) {
-    endParams = (*result).endParameters.get();
+  return linearizeTrackAtSurface(params, linPoint, *perigeeSurface, pOptions,
+                                 gctx, state);
+}
 
-  } else {
-    return result.error();
+template <typename propagator_t, typename propagator_options_t>
+std::vector<Acts::Result<Acts::LinearizedTrack>>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeTracks(const std::vector<const BoundTrackParameters*>& params,
+                    const Vector4& linPoint, const Acts::GeometryContext& gctx,
+                    const Acts::MagneticFieldContext& mctx,
+                    State& state) const {
+  std::vector<Result<LinearizedTrack>> linTracks;
+  linTracks.reserve(params.size());
+
+  // The perigee surface, the logger and the propagator options only depend
+  // on the linearization point and are shared by all tracks
+  const std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(VectorHelpers::position(linPoint));
+
+  auto logger = getDefaultLogger("HelTrkLinProp", Logging::INFO);
+  propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
+  pOptions.direction = NavigationDirection::Backward;
+
+  for (const BoundTrackParameters* trkParams : params) {
+    linTracks.push_back(linearizeTrackAtSurface(
+        *trkParams, linPoint, *perigeeSurface, pOptions, gctx, state));
+  }
+  return linTracks;
+}
+
+template <typename propagator_t, typename propagator_options_t>
+Acts::Result<Acts::LinearizedTrack>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeTrackAtSurface(const BoundTrackParameters& params,
+                            const Vector4& linPoint,
+                            const PerigeeSurface& perigeeSurface,
+                            const propagator_options_t& pOptions,
+                            const Acts::GeometryContext& gctx,
+                            State& state) const {
+  Vector3 linPointPos = VectorHelpers::position(linPoint);
+
+  // Do the propagation to linPointPos
+  auto status = m_cfg.propagator->propagate(params, perigeeSurface, pOptions,
+                                            state.propagationResult);
+  if (not status.ok()) {
+    return status.error();
   }
+  const BoundTrackParameters* endParams =
+      state.propagationResult.endParameters.get();
 
   BoundVector paramsAtPCA = endParams->parameters();
   Vector4 positionAtPCA = Vector4::Zero();
@@ -14,10 +14,14 @@
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/TrackAtVertex.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace Acts {
 
 struct ImpactParametersAndSigma {
@@ -39,6 +43,11 @@ template <typename input_track_t, typename propagator_t,
           typename propagator_options_t = PropagatorOptions<>>
 class ImpactPointEstimator {
  public:
+  /// Result of the propagations to the impact point
+  using PropagationResult =
+      typename propagator_t::template ResultType<BoundTrackParameters,
+                                                 propagator_options_t>;
+
   /// State struct
   struct State {
     /// @brief The state constructor
@@ -48,6 +57,8 @@ class ImpactPointEstimator {
         : fieldCache(std::move(fieldCacheIn)) {}
     /// Magnetic field cache
     MagneticFieldProvider::Cache fieldCache;
+    /// Propagation result re-used for all propagations with this state
+    PropagationResult propagationResult;
   };
 
   struct Config {
@@ -97,6 +108,25 @@ class ImpactPointEstimator {
                                      const BoundTrackParameters& trkParams,
                                      const Vector3& vtxPos, State& state) const;
 
+  /// @brief Batched version of estimate3DImpactParameters for a collection
+  /// of tracks and a common vertex position
+  ///
+  /// The propagator options are created once and shared by all tracks and
+  /// all propagations re-use the propagation result held by the state.
+  ///
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  /// @param trkParams Track parameters
+  /// @param vtxPos Reference position (vertex)
+  /// @param state The state object
+  ///
+  /// @return New track params, in the same order as the input parameters
+  std::vector<Result<std::unique_ptr<const BoundTrackParameters>>>
+  estimate3DImpactParameters(
+      const GeometryContext& gctx, const Acts::MagneticFieldContext& mctx,
+      const std::vector<const BoundTrackParameters*>& trkParams,
+      const Vector3& vtxPos, State& state) const;
+
   /// @brief Creates track parameters bound to plane
   /// at point of closest approach in 3d to given
   /// reference position. The parameters and errors
@@ -144,10 +174,54 @@ class ImpactPointEstimator {
       const BoundTrackParameters& track, const Vertex<input_track_t>& vtx,
       const GeometryContext& gctx, const MagneticFieldContext& mctx) const;
 
+  /// @brief Batched version of estimateImpactParameters for a collection
+  /// of tracks w.r.t. a common vertex
+  ///
+  /// The perigee surface at the vertex position, the propagator options and
+  /// the propagation result are created once and shared by all tracks.
+  ///
+  /// @param tracks Tracks to estimate IP from
+  /// @param vtx Vertex the tracks belong to
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  ///
+  /// @return Impact parameters, in the same order as the input tracks
+  std::vector<Result<ImpactParametersAndSigma>> estimateImpactParameters(
+      const std::vector<const BoundTrackParameters*>& tracks,
+      const Vertex<input_track_t>& vtx, const GeometryContext& gctx,
+      const MagneticFieldContext& mctx) const;
+
  private:
   /// Configuration object
   const Config m_cfg;
 
+  /// @brief Propagates the track parameters to the plane through the
+  /// reference position that is perpendicular to the track momentum
+  ///
+  /// @param trkParams Track parameters
+  /// @param vtxPos Reference position (vertex)
+  /// @param pOptions Propagator options
+  /// @param gctx The geometry context
+  /// @param state The state object
+  Result<std::unique_ptr<const BoundTrackParameters>> propagateToPlane(
+      const BoundTrackParameters& trkParams, const Vector3& vtxPos,
+      const propagator_options_t& pOptions, const GeometryContext& gctx,
+      State& state) const;
+
+  /// @brief Estimates the impact parameters using an existing perigee
+  /// surface at the vertex position
+  ///
+  /// @param track Track to estimate IP from
+  /// @param vtx Vertex the track belongs to
+  /// @param perigeeSurface Perigee surface at the vertex position
+  /// @param pOptions Propagator options
+  /// @param propagationResult Propagation result to be re-used
+  Result<ImpactParametersAndSigma> estimateImpactParametersAtSurface(
+      const BoundTrackParameters& track, const Vertex<input_track_t>& vtx,
+      const PerigeeSurface& perigeeSurface,
+      const propagator_options_t& pOptions,
+      PropagationResult& propagationResult) const;
+
   /// @brief Performs a Newton approximation to retrieve a point
   /// of closest approach in 3D to a reference position
   ///
@@ -41,6 +41,45 @@ Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
                                const Acts::MagneticFieldContext& mctx,
                                const BoundTrackParameters& trkParams,
                                const Vector3& vtxPos, State& state) const {
+  // Create propagator options
+  auto logger = getDefaultLogger("IPEstProp", Logging::INFO);
+  propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
+  pOptions.direction = NavigationDirection::Backward;
+
+  return propagateToPlane(trkParams, vtxPos, pOptions, gctx, state);
+}
+
+template <typename input_track_t, typename propagator_t,
+          typename propagator_options_t>
+std::vector<Acts::Result<std::unique_ptr<const Acts::BoundTrackParameters>>>
+Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
+    estimate3DImpactParameters(
+        const GeometryContext& gctx, const Acts::MagneticFieldContext& mctx,
+        const std::vector<const BoundTrackParameters*>& trkParams,
+        const Vector3& vtxPos, State& state) const {
+  std::vector<Result<std::unique_ptr<const BoundTrackParameters>>> results;
+  results.reserve(trkParams.size());
+
+  // The propagator options are shared by all tracks
+  auto logger = getDefaultLogger("IPEstProp", Logging::INFO);
+  propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
+  pOptions.direction = NavigationDirection::Backward;
+
+  for (const BoundTrackParameters* params : trkParams) {
+    results.push_back(
+        propagateToPlane(*params, vtxPos, pOptions, gctx, state));
+  }
+  return results;
+}
+
+template <typename input_track_t, typename propagator_t,
+          typename propagator_options_t>
+Acts::Result<std::unique_ptr<const Acts::BoundTrackParameters>>
+Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
+    propagateToPlane(const BoundTrackParameters& trkParams,
+                     const Vector3& vtxPos,
+                     const propagator_options_t& pOptions,
+                     const GeometryContext& gctx, State& state) const {
   Vector3 deltaR;
   Vector3 momDir;
 
@@ -71,18 +110,15 @@ Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
   std::shared_ptr<PlaneSurface> planeSurface =
       Surface::makeShared<PlaneSurface>(thePlane);
 
-  // Create propagator options
-  auto logger = getDefaultLogger("IPEstProp", Logging::INFO);
-  propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
-  pOptions.direction = NavigationDirection::Backward;
-
   // Do the propagation to linPointPos
-  auto result = m_cfg.propagator->propagate(trkParams, *planeSurface, pOptions);
-  if (result.ok()) {
-    return std::move((*result).endParameters);
-  } else {
-    return result.error();
+  auto status = m_cfg.propagator->propagate(trkParams, *planeSurface, pOptions,
+                                            state.propagationResult);
+  if (not status.ok()) {
+    return status.error();
   }
+  // Copy the end parameters to keep their storage for the next propagation
+  return std::make_unique<const BoundTrackParameters>(
+      *state.propagationResult.endParameters);
 }
 
 template <typename input_track_t, typename propagator_t,
@@ -271,14 +307,57 @@ Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
   propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
   pOptions.direction = NavigationDirection::Backward;
 
+  PropagationResult propagationResult;
+  return estimateImpactParametersAtSurface(track, vtx, *perigeeSurface,
+                                           pOptions, propagationResult);
+}
+
+template <typename input_track_t, typename propagator_t,
+          typename propagator_options_t>
+std::vector<Acts::Result<Acts::ImpactParametersAndSigma>>
+Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
+    estimateImpactParameters(
+        const std::vector<const BoundTrackParameters*>& tracks,
+        const Vertex<input_track_t>& vtx, const GeometryContext& gctx,
+        const Acts::MagneticFieldContext& mctx) const {
+  std::vector<Result<ImpactParametersAndSigma>> results;
+  results.reserve(tracks.size());
+
+  // The perigee surface at the vertex, the propagator options and the
+  // propagation result are shared by all tracks
+  const std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(vtx.position());
+
+  auto logger = getDefaultLogger("IPEstProp", Logging::INFO);
+  propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
+  pOptions.direction = NavigationDirection::Backward;
+
+  PropagationResult propagationResult;
+  for (const BoundTrackParameters* track : tracks) {
+    results.push_back(estimateImpactParametersAtSurface(
+        *track, vtx, *perigeeSurface, pOptions, propagationResult));
+  }
+  return results;
+}
+
+template <typename input_track_t, typename propagator_t,
+          typename propagator_options_t>
+Acts::Result<Acts::ImpactParametersAndSigma>
+Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
+    estimateImpactParametersAtSurface(
+        const BoundTrackParameters& track, const Vertex<input_track_t>& vtx,
+        const PerigeeSurface& perigeeSurface,
+        const propagator_options_t& pOptions,
+        PropagationResult& propagationResult) const {
   // Do the propagation to linPoint
-  auto result = m_cfg.propagator->propagate(track, *perigeeSurface, pOptions);
+  auto status = m_cfg.propagator->propagate(track, perigeeSurface, pOptions,
+                                            propagationResult);
 
-  if (!result.ok()) {
-    return result.error();
+  if (!status.ok()) {
+    return status.error();
   }
 
-  const auto& propRes = *result;
+  const auto& propRes = propagationResult;
   const auto& params = propRes.endParameters->parameters();
   const double d0 = params[BoundIndices::eBoundLoc0];
   const double z0 = params[BoundIndices::eBoundLoc1];
@@ -16,6 +16,7 @@
 #include "Acts/Vertexing/FullBilloirVertexFitter.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/LinearizerConcept.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexFitterConcept.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
@@ -196,14 +197,19 @@ class IterativeVertexFinder {
                        std::vector<const InputTrack_t*>& seedTracks) const;
 
   /// @brief Function for calculating how compatible
-  /// a given track is to a given vertex
+  /// given tracks are to a given vertex
   ///
-  /// @param params Track parameters
+  /// The tracks are linearized at the vertex position in one batch.
+  ///
+  /// @param tracks The tracks
   /// @param vertex The vertex
   /// @param vertexingOptions Vertexing options
   /// @param state The state object
-  Result<double> getCompatibility(
-      const BoundTrackParameters& params, const Vertex<InputTrack_t>& vertex,
+  ///
+  /// @return The compatibilities, in the same order as the tracks
+  Result<std::vector<double>> getCompatibilities(
+      const std::vector<const InputTrack_t*>& tracks,
+      const Vertex<InputTrack_t>& vertex,
       const VertexingOptions<InputTrack_t>& vertexingOptions,
       State& state) const;
 
@@ -207,39 +207,55 @@ void Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::removeAllTracks(
 }
 
 template <typename vfitter_t, typename sfinder_t>
-Acts::Result<double>
-Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::getCompatibility(
-    const BoundTrackParameters& params, const Vertex<InputTrack_t>& vertex,
+Acts::Result<std::vector<double>>
+Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::getCompatibilities(
+    const std::vector<const InputTrack_t*>& tracks,
+    const Vertex<InputTrack_t>& vertex,
     const VertexingOptions<InputTrack_t>& vertexingOptions,
     State& state) const {
-  // Linearize track
-  auto result = m_cfg.linearizer.linearizeTrack(
-      params, vertex.fullPosition(), vertexingOptions.geoContext,
-      vertexingOptions.magFieldContext, state.linearizerState);
-  if (!result.ok()) {
-    return result.error();
+  std::vector<BoundTrackParameters> params;
+  params.reserve(tracks.size());
+  std::vector<const BoundTrackParameters*> paramPointers;
+  paramPointers.reserve(tracks.size());
+  for (const InputTrack_t* trk : tracks) {
+    params.push_back(m_extractParameters(*trk));
+    paramPointers.push_back(&params.back());
   }
 
-  auto linTrack = std::move(*result);
+  // Linearize all tracks at the vertex at once
+  auto linTracks = Acts::linearizeTracks(
+      m_cfg.linearizer, paramPointers, vertex.fullPosition(),
+      vertexingOptions.geoContext, vertexingOptions.magFieldContext,
+      state.linearizerState);
+
+  std::vector<double> compatibilities;
+  compatibilities.reserve(tracks.size());
+  for (auto& result : linTracks) {
+    if (!result.ok()) {
+      return result.error();
+    }
+
+    const auto& linTrack = *result;
 
-  // Calculate reduced weight
-  SymMatrix2 weightReduced =
-      linTrack.covarianceAtPCA.template block<2, 2>(0, 0);
+    // Calculate reduced weight
+    SymMatrix2 weightReduced =
+        linTrack.covarianceAtPCA.template block<2, 2>(0, 0);
 
-  SymMatrix2 errorVertexReduced =
-      (linTrack.positionJacobian *
-       (vertex.fullCovariance() * linTrack.positionJacobian.transpose()))
-          .template block<2, 2>(0, 0);
-  weightReduced += errorVertexReduced;
-  weightReduced = weightReduced.inverse();
+    SymMatrix2 errorVertexReduced =
+        (linTrack.positionJacobian *
+         (vertex.fullCovariance() * linTrack.positionJacobian.transpose()))
+            .template block<2, 2>(0, 0);
+    weightReduced += errorVertexReduced;
+    weightReduced = weightReduced.inverse();
 
-  // Calculate compatibility / chi2
-  Vector2 trackParameters2D =
-      linTrack.parametersAtPCA.template block<2, 1>(0, 0);
-  double compatibility =
-      trackParameters2D.dot(weightReduced * trackParameters2D);
+    // Calculate compatibility / chi2
+    Vector2 trackParameters2D =
+        linTrack.parametersAtPCA.template block<2, 1>(0, 0);
+    compatibilities.push_back(
+        trackParameters2D.dot(weightReduced * trackParameters2D));
+  }
 
-  return compatibility;
+  return compatibilities;
 }
 
 template <typename vfitter_t, typename sfinder_t>
@@ -291,16 +307,17 @@ Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::removeUsedCompatibleTracks(
   // m_cfg.cutOffTrackWeight threshold and are hence outliers
   ACTS_DEBUG("Number of outliers: " << perigeesToFit.size());
 
-  for (const auto& myPerigeeToFit : perigeesToFit) {
-    // calculate chi2 w.r.t. last fitted vertex
-    auto result = getCompatibility(m_extractParameters(*myPerigeeToFit),
-                                   myVertex, vertexingOptions, state);
+  // calculate chi2 w.r.t. last fitted vertex
+  auto result =
+      getCompatibilities(perigeesToFit, myVertex, vertexingOptions, state);
 
-    if (!result.ok()) {
-      return result.error();
-    }
+  if (!result.ok()) {
+    return result.error();
+  }
 
-    double chi2 = *result;
+  for (size_t iPerigee = 0; iPerigee < perigeesToFit.size(); ++iPerigee) {
+    const auto& myPerigeeToFit = perigeesToFit[iPerigee];
+    double chi2 = (*result)[iPerigee];
 
     // check if sufficiently compatible with last fitted vertex
     // (quite loose constraint)
@@ -423,34 +440,40 @@ Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::reassignTracksToNewVertex(
   for (auto& vertexIt : vertexCollection) {
     // tracks at vertexIt
     std::vector<TrackAtVertex<InputTrack_t>> tracksAtVertex = vertexIt.tracks();
+
+    // consider only tracks that are not too tightly assigned to other
+    // vertex, use original perigee parameter of course
+    std::vector<const InputTrack_t*> candidates;
+    for (const auto& trkAtVtx : tracksAtVertex) {
+      if (trkAtVtx.trackWeight <= m_cfg.cutOffTrackWeight) {
+        candidates.push_back(trkAtVtx.originalParams);
+      }
+    }
+
+    // compute compatibilities
+    auto resultNew = getCompatibilities(candidates, currentVertex,
+                                        vertexingOptions, state);
+    if (!resultNew.ok()) {
+      return Result<bool>::failure(resultNew.error());
+    }
+    auto resultOld =
+        getCompatibilities(candidates, vertexIt, vertexingOptions, state);
+    if (!resultOld.ok()) {
+      return Result<bool>::failure(resultOld.error());
+    }
+
     auto tracksBegin = tracksAtVertex.begin();
     auto tracksEnd = tracksAtVertex.end();
+    size_t iCandidate = 0;
 
     for (auto tracksIter = tracksBegin; tracksIter != tracksEnd;) {
-      // consider only tracks that are not too tightly assigned to other
-      // vertex
       if (tracksIter->trackWeight > m_cfg.cutOffTrackWeight) {
         tracksIter++;
         continue;
       }
-      // use original perigee parameter of course
-      BoundTrackParameters trackPerigee =
-          m_extractParameters(*(tracksIter->originalParams));
-
-      // compute compatibility
-      auto resultNew = getCompatibility(trackPerigee, currentVertex,
-                                        vertexingOptions, state);
-      if (!resultNew.ok()) {
-        return Result<bool>::failure(resultNew.error());
-      }
-      double chi2NewVtx = *resultNew;
-
-      auto resultOld =
-          getCompatibility(trackPerigee, vertexIt, vertexingOptions, state);
-      if (!resultOld.ok()) {
-        return Result<bool>::failure(resultOld.error());
-      }
-      double chi2OldVtx = *resultOld;
+      double chi2NewVtx = (*resultNew)[iCandidate];
+      double chi2OldVtx = (*resultOld)[iCandidate];
+      ++iCandidate;
 
       ACTS_DEBUG("Compatibility to new vertex: " << chi2NewVtx);
       ACTS_DEBUG("Compatibility to old vertex: " << chi2OldVtx);
@@ -15,6 +15,8 @@
 #include "Acts/Utilities/TypeTraits.hpp"
 #include "Acts/Vertexing/LinearizedTrack.hpp"
 
+#include <vector>
+
 namespace Acts {
 
 namespace Concepts {
@@ -26,6 +28,7 @@ template <typename T>
 using state_t = typename T::State;
 
 METHOD_TRAIT(linTrack_t, linearizeTrack);
+METHOD_TRAIT(linTracks_t, linearizeTracks);
 
 // clang-format off
     template <typename S>
@@ -50,6 +53,16 @@ METHOD_TRAIT(linTrack_t, linearizeTrack);
                                               propagator_exists,
                                               state_exists>;
       };
+
+    /// Whether the linearizer provides the optional batched interface
+    template <typename S>
+    constexpr bool hasLinearizeTracks = has_method<const S,
+         std::vector<Result<LinearizedTrack>>,
+         linTracks_t, const std::vector<const BoundTrackParameters*>&,
+                      const Vector4&,
+                      const Acts::GeometryContext&,
+                      const Acts::MagneticFieldContext&,
+                      typename S::State&>;
 // clang-format on
 }  // namespace Linearizer
 }  // namespace Concepts
@@ -58,4 +71,36 @@ template <typename fitter>
 constexpr bool LinearizerConcept =
     Acts::Concepts ::Linearizer::LinearizerConcept<fitter>::value;
 
+/// @brief Linearizes a collection of tracks at a common linearization point
+///
+/// Uses the batched `linearizeTracks` of the linearizer if it provides one
+/// and calls `linearizeTrack` for every track otherwise.
+///
+/// @param linearizer The linearizer
+/// @param params Parameters to linearize
+/// @param linPoint Linearization point
+/// @param gctx The geometry context
+/// @param mctx The magnetic field context
+/// @param state The linearizer state
+///
+/// @return Linearized tracks, in the same order as the input parameters
+template <typename linearizer_t>
+std::vector<Result<LinearizedTrack>> linearizeTracks(
+    const linearizer_t& linearizer,
+    const std::vector<const BoundTrackParameters*>& params,
+    const Vector4& linPoint, const GeometryContext& gctx,
+    const MagneticFieldContext& mctx, typename linearizer_t::State& state) {
+  if constexpr (Concepts::Linearizer::hasLinearizeTracks<linearizer_t>) {
+    return linearizer.linearizeTracks(params, linPoint, gctx, mctx, state);
+  } else {
+    std::vector<Result<LinearizedTrack>> linTracks;
+    linTracks.reserve(params.size());
+    for (const BoundTrackParameters* trkParams : params) {
+      linTracks.push_back(
+          linearizer.linearizeTrack(*trkParams, linPoint, gctx, mctx, state));
+    }
+    return linTracks;
+  }
+}
+
 }  // namespace Acts
\ No newline at end of file
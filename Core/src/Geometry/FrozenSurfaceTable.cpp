@@ -0,0 +1,291 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/FrozenSurfaceTable.hpp"
+
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/RealQuadraticEquation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+using ConstRotationMap = Eigen::Map<const Acts::RotationMatrix3>;
+using ConstVector3Map = Eigen::Map<const Acts::Vector3>;
+
+Acts::Intersection3D::Status statusFromPath(double path) {
+  return (path * path < Acts::s_onSurfaceTolerance * Acts::s_onSurfaceTolerance)
+             ? Acts::Intersection3D::Status::onSurface
+             : Acts::Intersection3D::Status::reachable;
+}
+
+}  // namespace
+
+Acts::FrozenSurfaceTable::FrozenSurfaceTable(
+    const GeometryContext& gctx, const TrackingGeometry& trackingGeometry)
+    : m_gctx(gctx) {
+  trackingGeometry.visitSurfaces([this](const Surface* surface) {
+    if (surface != nullptr) {
+      m_surfaces.push_back(surface);
+    }
+  });
+  fill();
+}
+
+Acts::FrozenSurfaceTable::FrozenSurfaceTable(
+    const GeometryContext& gctx, std::vector<const Surface*> surfaces)
+    : m_gctx(gctx), m_surfaces(std::move(surfaces)) {
+  fill();
+}
+
+void Acts::FrozenSurfaceTable::fill() {
+  std::sort(m_surfaces.begin(), m_surfaces.end(),
+            [](const Surface* lhs, const Surface* rhs) {
+              return lhs->geometryId() < rhs->geometryId();
+            });
+  auto dup = std::adjacent_find(m_surfaces.begin(), m_surfaces.end(),
+                                [](const Surface* lhs, const Surface* rhs) {
+                                  return lhs->geometryId() == rhs->geometryId();
+                                });
+  if (dup != m_surfaces.end()) {
+    throw std::invalid_argument("Surfaces contain duplicated identifiers");
+  }
+
+  const size_t n = m_surfaces.size();
+  m_geoIds.resize(n);
+  m_kernels.resize(n, Kernel::eGeneric);
+  m_rotations.resize(9 * n);
+  m_translations.resize(3 * n);
+  m_bounds.resize(s_nBoundValues * n, 0.);
+
+  for (size_t i = 0; i < n; ++i) {
+    const Surface& surface = *m_surfaces[i];
+    const Transform3& transform = surface.transform(m_gctx);
+    m_geoIds[i] = surface.geometryId().value();
+    Eigen::Map<RotationMatrix3> rotation(&m_rotations[9 * i]);
+    Eigen::Map<Vector3> translation(&m_translations[3 * i]);
+    rotation = transform.rotation();
+    translation = transform.translation();
+
+    const SurfaceBounds& bounds = surface.bounds();
+    ActsScalar* values = &m_bounds[s_nBoundValues * i];
+    switch (surface.type()) {
+      case Surface::Plane: {
+        if (bounds.type() == SurfaceBounds::eRectangle) {
+          const auto& rBounds = static_cast<const RectangleBounds&>(bounds);
+          values[0] = rBounds.get(RectangleBounds::eMinX);
+          values[1] = rBounds.get(RectangleBounds::eMinY);
+          values[2] = rBounds.get(RectangleBounds::eMaxX);
+          values[3] = rBounds.get(RectangleBounds::eMaxY);
+          m_kernels[i] = Kernel::ePlaneRectangle;
+        } else {
+          m_kernels[i] = Kernel::ePlane;
+        }
+        break;
+      }
+      case Surface::Disc: {
+        if (bounds.type() == SurfaceBounds::eDisc) {
+          const auto& rBounds = static_cast<const RadialBounds&>(bounds);
+          values[0] = rBounds.get(RadialBounds::eMinR);
+          values[1] = rBounds.get(RadialBounds::eMaxR);
+          m_kernels[i] = rBounds.coversFullAzimuth() ? Kernel::eDiscRadial
+                                                     : Kernel::eDisc;
+        } else if (bounds.type() != SurfaceBounds::eBoundless) {
+          m_kernels[i] = Kernel::eDisc;
+        }
+        break;
+      }
+      case Surface::Cylinder: {
+        const auto& cBounds = static_cast<const CylinderBounds&>(bounds);
+        values[0] = cBounds.get(CylinderBounds::eR);
+        values[1] = cBounds.get(CylinderBounds::eHalfLengthZ);
+        if (cBounds.coversFullAzimuth()) {
+          m_kernels[i] = Kernel::eCylinder;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+size_t Acts::FrozenSurfaceTable::index(GeometryIdentifier geoId) const {
+  auto it = std::lower_bound(m_geoIds.begin(), m_geoIds.end(), geoId.value());
+  if (it == m_geoIds.end() or *it != geoId.value()) {
+    return size();
+  }
+  return static_cast<size_t>(std::distance(m_geoIds.begin(), it));
+}
+
+Acts::Vector3 Acts::FrozenSurfaceTable::center(size_t index) const {
+  return ConstVector3Map(&m_translations[3 * index]);
+}
+
+Acts::RotationMatrix3 Acts::FrozenSurfaceTable::rotation(size_t index) const {
+  return ConstRotationMap(&m_rotations[9 * index]);
+}
+
+Acts::Vector3 Acts::FrozenSurfaceTable::globalToLocal3D(
+    size_t index, const Vector3& position) const {
+  // the inverse of the rigid transform is the transposed rotation
+  return ConstRotationMap(&m_rotations[9 * index]).transpose() *
+         (position - ConstVector3Map(&m_translations[3 * index]));
+}
+
+bool Acts::FrozenSurfaceTable::insideBounds(size_t index,
+                                            const Vector2& lposition,
+                                            const BoundaryCheck& bcheck) const {
+  if (m_kernels[index] == Kernel::ePlaneRectangle and
+      bcheck.type() != BoundaryCheck::Type::eChi2) {
+    if (not bcheck) {
+      return true;
+    }
+    // absolute check on a box is a check on the box grown by the tolerance
+    const ActsScalar* values = &m_bounds[s_nBoundValues * index];
+    const Vector2& tol = bcheck.tolerance();
+    return (values[0] - tol[0] <= lposition[0]) and
+           (lposition[0] <= values[2] + tol[0]) and
+           (values[1] - tol[1] <= lposition[1]) and
+           (lposition[1] <= values[3] + tol[1]);
+  }
+  return m_surfaces[index]->insideBounds(lposition, bcheck);
+}
+
+Acts::SurfaceIntersection Acts::FrozenSurfaceTable::intersect(
+    size_t index, const Vector3& position, const Vector3& direction,
+    const BoundaryCheck& bcheck) const {
+  switch (m_kernels[index]) {
+    case Kernel::ePlane:
+    case Kernel::ePlaneRectangle:
+    case Kernel::eDisc:
+    case Kernel::eDiscRadial:
+      return intersectPlanar(index, position, direction, bcheck);
+    case Kernel::eCylinder:
+      return intersectCylinder(index, position, direction, bcheck);
+    default:
+      return m_surfaces[index]->intersect(m_gctx, position, direction, bcheck);
+  }
+}
+
+Acts::SurfaceIntersection Acts::FrozenSurfaceTable::intersectPlanar(
+    size_t index, const Vector3& position, const Vector3& direction,
+    const BoundaryCheck& bcheck) const {
+  const Surface* surface = m_surfaces[index];
+  ConstRotationMap rotation(&m_rotations[9 * index]);
+  ConstVector3Map center(&m_translations[3 * index]);
+  // same as PlanarHelper::intersect, on the frozen transform
+  const Vector3 normal = rotation.col(2);
+  ActsScalar denom = direction.dot(normal);
+  if (denom == 0.) {
+    return {Intersection3D(), surface};
+  }
+  ActsScalar path = normal.dot(center - position) / denom;
+  Intersection3D intersection(position + path * direction, path,
+                              statusFromPath(path));
+  if (not bcheck) {
+    return {intersection, surface};
+  }
+
+  const Vector3 local =
+      rotation.transpose() * (intersection.position - center);
+  const Vector2 lcartesian = local.head<2>();
+  bool inside = true;
+  switch (m_kernels[index]) {
+    case Kernel::ePlane:
+    case Kernel::ePlaneRectangle:
+      inside = insideBounds(index, lcartesian, bcheck);
+      break;
+    case Kernel::eDiscRadial:
+      if (bcheck.type() == BoundaryCheck::Type::eAbsolute) {
+        // same as RadialBounds::insideRadialBounds
+        const ActsScalar* values = &m_bounds[s_nBoundValues * index];
+        ActsScalar tolerance =
+            s_onSurfaceTolerance + bcheck.tolerance()[eBoundLoc0];
+        ActsScalar r = lcartesian.norm();
+        inside = (r + tolerance > values[0]) and (r - tolerance < values[1]);
+        break;
+      }
+      [[fallthrough]];
+    default: {
+      // the disc bounds are given in polar coordinates
+      Vector2 lpolar(VectorHelpers::perp(lcartesian),
+                     VectorHelpers::phi(lcartesian));
+      inside = surface->insideBounds(lpolar, bcheck);
+      break;
+    }
+  }
+  if (not inside) {
+    intersection.status = Intersection3D::Status::missed;
+  }
+  return {intersection, surface};
+}
+
+Acts::SurfaceIntersection Acts::FrozenSurfaceTable::intersectCylinder(
+    size_t index, const Vector3& position, const Vector3& direction,
+    const BoundaryCheck& bcheck) const {
+  // non-absolute checks need the full surface implementation
+  if (bcheck.type() == BoundaryCheck::Type::eChi2) {
+    return m_surfaces[index]->intersect(m_gctx, position, direction, bcheck);
+  }
+
+  const Surface* surface = m_surfaces[index];
+  ConstRotationMap rotation(&m_rotations[9 * index]);
+  ConstVector3Map center(&m_translations[3 * index]);
+  const ActsScalar* values = &m_bounds[s_nBoundValues * index];
+
+  // same as CylinderSurface::intersectionSolver, on the frozen transform
+  const Vector3 axis = rotation.col(2);
+  const Vector3 pcXcd = (position - center).cross(axis);
+  const Vector3 ldXcd = direction.cross(axis);
+  detail::RealQuadraticEquation qe(ldXcd.dot(ldXcd), 2. * ldXcd.dot(pcXcd),
+                                   pcXcd.dot(pcXcd) - values[0] * values[0]);
+  if (qe.solutions == 0) {
+    return SurfaceIntersection();
+  }
+
+  auto checkedStatus = [&](const Vector3& solution, double path) {
+    auto status = statusFromPath(path);
+    if (not bcheck) {
+      return status;
+    }
+    ActsScalar cZ = (solution - center).dot(axis);
+    ActsScalar hZ =
+        values[1] + s_onSurfaceTolerance + bcheck.tolerance()[eBoundLoc1];
+    return (cZ * cZ < hZ * hZ) ? status : Intersection3D::Status::missed;
+  };
+
+  // same solution selection as CylinderSurface::intersect
+  Vector3 solution1 = position + qe.first * direction;
+  Intersection3D first(solution1, qe.first, checkedStatus(solution1, qe.first));
+  SurfaceIntersection cIntersection(first, surface);
+  if (qe.solutions == 1) {
+    return cIntersection;
+  }
+  Vector3 solution2 = position + qe.second * direction;
+  Intersection3D second(solution2, qe.second,
+                        checkedStatus(solution2, qe.second));
+  bool check1 = first.status != Intersection3D::Status::missed or
+                second.status == Intersection3D::Status::missed;
+  if ((check1 and qe.first * qe.first < qe.second * qe.second) or
+      second.status == Intersection3D::Status::missed) {
+    cIntersection.alternative = second;
+  } else {
+    cIntersection.alternative = first;
+    cIntersection.intersection = second;
+  }
+  return cIntersection;
+}
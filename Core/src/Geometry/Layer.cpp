@@ -8,6 +8,7 @@
 
 #include "Acts/Geometry/Layer.hpp"
 
+#include "Acts/Geometry/FrozenSurfaceTable.hpp"
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Propagator/Navigator.hpp"
@@ -173,9 +174,15 @@ Acts::Layer::compatibleSurfaces(
                   sf.geometryId()) != options.externalSurfaces.end()) {
       boundaryCheck = false;
     }
-    // the surface intersection
+    // the surface intersection, from the frozen table if it holds the surface
+    const FrozenSurfaceTable* frozen = options.frozenSurfaces;
+    size_t index = frozen ? frozen->index(sf.geometryId()) : 0;
     SurfaceIntersection sfi =
-        sf.intersect(gctx, position, options.navDir * direction, boundaryCheck);
+        (frozen and index < frozen->size() and &frozen->surface(index) == &sf)
+            ? frozen->intersect(index, position, options.navDir * direction,
+                                boundaryCheck)
+            : sf.intersect(gctx, position, options.navDir * direction,
+                           boundaryCheck);
     // check if intersection is valid and pathLimit has not been exceeded
     if (sfi && detail::checkIntersection(sfi.intersection, pathLimit,
                                          overstepLimit, s_onSurfaceTolerance)) {
@@ -0,0 +1,1078 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/BoundarySurfaceFace.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/ConeVolumeBounds.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CutoutCylinderVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderLayer.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/DiscLayer.hpp"
+#include "Acts/Geometry/GenericApproachDescriptor.hpp"
+#include "Acts/Geometry/GenericCuboidVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/NavigationLayer.hpp"
+#include "Acts/Geometry/PlaneLayer.hpp"
+#include "Acts/Geometry/SurfaceArrayCreator.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Boundary = Acts::BoundarySurfaceT<Acts::TrackingVolume>;
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'G', 'E', 'O', '\0'};
+constexpr uint32_t s_version = 1;
+/// Index of a missing reference
+constexpr uint64_t s_none = std::numeric_limits<uint64_t>::max();
+
+enum class LayerKind : uint32_t {
+  Cylinder = 0,
+  Disc = 1,
+  Plane = 2,
+  Navigation = 3
+};
+
+/// The surface grid lookups as created by the SurfaceArrayCreator
+enum class LookupKind : uint32_t {
+  Single = 0,
+  Cylinder = 1,
+  Disc = 2,
+  Plane = 3
+};
+
+/// Byte buffer for the snapshot, in native byte order
+class OutputStream {
+ public:
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be written");
+    m_bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void write(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be written");
+    write<uint64_t>(values.size());
+    m_bytes.append(reinterpret_cast<const char*>(values.data()),
+                   values.size() * sizeof(T));
+  }
+
+  void write(const std::string& value) {
+    write<uint64_t>(value.size());
+    m_bytes.append(value);
+  }
+
+  void write(const Acts::Transform3& transform) {
+    std::array<double, 16> matrix = {};
+    std::memcpy(matrix.data(), transform.matrix().data(), sizeof(matrix));
+    write(matrix);
+  }
+
+  const std::string& bytes() const { return m_bytes; }
+
+ private:
+  std::string m_bytes;
+};
+
+/// Bounds checked reading of the snapshot bytes
+class InputStream {
+ public:
+  explicit InputStream(std::string bytes) : m_bytes(std::move(bytes)) {}
+
+  template <typename T>
+  T read() {
+    require(sizeof(T));
+    T value;
+    std::memcpy(&value, m_bytes.data() + m_position, sizeof(T));
+    m_position += sizeof(T);
+    return value;
+  }
+
+  template <typename T>
+  std::vector<T> readVector() {
+    uint64_t size = read<uint64_t>();
+    if (size > remaining() / sizeof(T)) {
+      corrupted();
+    }
+    std::vector<T> values(size);
+    std::memcpy(values.data(), m_bytes.data() + m_position, size * sizeof(T));
+    m_position += size * sizeof(T);
+    return values;
+  }
+
+  std::string readString() {
+    uint64_t size = read<uint64_t>();
+    require(size);
+    std::string value = m_bytes.substr(m_position, size);
+    m_position += size;
+    return value;
+  }
+
+  Acts::Transform3 readTransform() {
+    auto matrix = read<std::array<double, 16>>();
+    Acts::Transform3 transform;
+    std::memcpy(transform.matrix().data(), matrix.data(), sizeof(matrix));
+    return transform;
+  }
+
+  /// Number of records that follow, each taking at least @p minSize bytes
+  uint64_t readCount(size_t minSize = sizeof(uint64_t)) {
+    uint64_t count = read<uint64_t>();
+    if (count > remaining() / minSize) {
+      corrupted();
+    }
+    return count;
+  }
+
+  /// Index into a table of @p size entries, s_none is passed through
+  uint64_t readIndex(size_t size) {
+    uint64_t index = read<uint64_t>();
+    if (index != s_none and index >= size) {
+      corrupted();
+    }
+    return index;
+  }
+
+  [[noreturn]] static void corrupted() {
+    throw std::runtime_error("Corrupted tracking geometry snapshot");
+  }
+
+ private:
+  size_t remaining() const { return m_bytes.size() - m_position; }
+
+  void require(size_t n) const {
+    if (n > remaining()) {
+      corrupted();
+    }
+  }
+
+  std::string m_bytes;
+  size_t m_position = 0;
+};
+
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> makeBounds(const std::vector<double>& values) {
+  std::array<double, bounds_t::eSize> bValues = {};
+  if (values.size() != bValues.size()) {
+    throw std::invalid_argument("Invalid number of bound values");
+  }
+  std::copy(values.begin(), values.end(), bValues.begin());
+  return std::make_shared<const bounds_t>(bValues);
+}
+
+std::shared_ptr<const Acts::PlanarBounds> makePlanarBounds(
+    int32_t type, const std::vector<double>& values) {
+  switch (type) {
+    case Acts::SurfaceBounds::eRectangle:
+      return makeBounds<Acts::RectangleBounds>(values);
+    case Acts::SurfaceBounds::eTrapezoid:
+      return makeBounds<Acts::TrapezoidBounds>(values);
+    case Acts::SurfaceBounds::eDiamond:
+      return makeBounds<Acts::DiamondBounds>(values);
+    case Acts::SurfaceBounds::eEllipse:
+      return makeBounds<Acts::EllipseBounds>(values);
+    case Acts::SurfaceBounds::eConvexPolygon: {
+      if (values.size() % 2 != 0) {
+        throw std::invalid_argument("Invalid convex polygon vertices");
+      }
+      std::vector<Acts::Vector2> vertices;
+      for (size_t i = 0; i < values.size(); i += 2) {
+        vertices.emplace_back(values[i], values[i + 1]);
+      }
+      return std::make_shared<
+          const Acts::ConvexPolygonBounds<Acts::PolygonDynamic>>(vertices);
+    }
+    case Acts::SurfaceBounds::eBoundless:
+      return nullptr;
+    default:
+      throw std::invalid_argument("Unsupported planar bounds");
+  }
+}
+
+std::shared_ptr<const Acts::DiscBounds> makeDiscBounds(
+    int32_t type, const std::vector<double>& values) {
+  switch (type) {
+    case Acts::SurfaceBounds::eDisc:
+      return makeBounds<Acts::RadialBounds>(values);
+    case Acts::SurfaceBounds::eDiscTrapezoid:
+      return makeBounds<Acts::DiscTrapezoidBounds>(values);
+    case Acts::SurfaceBounds::eAnnulus:
+      return makeBounds<Acts::AnnulusBounds>(values);
+    case Acts::SurfaceBounds::eBoundless:
+      return nullptr;
+    default:
+      throw std::invalid_argument("Unsupported disc bounds");
+  }
+}
+
+std::shared_ptr<const Acts::CylinderBounds> makeCylinderBounds(
+    int32_t type, const std::vector<double>& values) {
+  if (type != Acts::SurfaceBounds::eCylinder) {
+    throw std::invalid_argument("Unsupported cylinder bounds");
+  }
+  return makeBounds<Acts::CylinderBounds>(values);
+}
+
+std::shared_ptr<Acts::Surface> makeSurface(int32_t surfaceType,
+                                           const Acts::Transform3& transform,
+                                           int32_t boundsType,
+                                           const std::vector<double>& values) {
+  switch (surfaceType) {
+    case Acts::Surface::Plane:
+    case Acts::Surface::Curvilinear:
+      return Acts::Surface::makeShared<Acts::PlaneSurface>(
+          transform, makePlanarBounds(boundsType, values));
+    case Acts::Surface::Disc:
+      return Acts::Surface::makeShared<Acts::DiscSurface>(
+          transform, makeDiscBounds(boundsType, values));
+    case Acts::Surface::Cylinder:
+      return Acts::Surface::makeShared<Acts::CylinderSurface>(
+          transform, makeCylinderBounds(boundsType, values));
+    case Acts::Surface::Cone:
+      if (boundsType != Acts::SurfaceBounds::eCone) {
+        throw std::invalid_argument("Unsupported cone bounds");
+      }
+      return Acts::Surface::makeShared<Acts::ConeSurface>(
+          transform, makeBounds<Acts::ConeBounds>(values));
+    case Acts::Surface::Straw:
+      if (boundsType != Acts::SurfaceBounds::eLine) {
+        throw std::invalid_argument("Unsupported straw bounds");
+      }
+      return Acts::Surface::makeShared<Acts::StrawSurface>(
+          transform, makeBounds<Acts::LineBounds>(values));
+    case Acts::Surface::Perigee:
+      return Acts::Surface::makeShared<Acts::PerigeeSurface>(transform);
+    default:
+      throw std::invalid_argument("Unsupported surface type");
+  }
+}
+
+std::shared_ptr<const Acts::VolumeBounds> makeVolumeBounds(
+    int32_t type, const std::vector<double>& values) {
+  switch (type) {
+    case Acts::VolumeBounds::eCone:
+      return makeBounds<Acts::ConeVolumeBounds>(values);
+    case Acts::VolumeBounds::eCuboid:
+      return makeBounds<Acts::CuboidVolumeBounds>(values);
+    case Acts::VolumeBounds::eCutoutCylinder:
+      return makeBounds<Acts::CutoutCylinderVolumeBounds>(values);
+    case Acts::VolumeBounds::eCylinder:
+      return makeBounds<Acts::CylinderVolumeBounds>(values);
+    case Acts::VolumeBounds::eGenericCuboid:
+      return makeBounds<Acts::GenericCuboidVolumeBounds>(values);
+    case Acts::VolumeBounds::eTrapezoid:
+      return makeBounds<Acts::TrapezoidVolumeBounds>(values);
+    default:
+      throw std::invalid_argument("Unsupported volume bounds");
+  }
+}
+
+void writeBinUtility(OutputStream& out, const Acts::BinUtility& bu) {
+  out.write(bu.transform());
+  out.write<uint64_t>(bu.binningData().size());
+  for (const auto& bd : bu.binningData()) {
+    if (bd.subBinningData != nullptr) {
+      throw std::invalid_argument(
+          "Tracking geometry snapshots do not support sub binning");
+    }
+    out.write<uint32_t>(bd.type);
+    out.write<uint32_t>(bd.option);
+    out.write<uint32_t>(bd.binvalue);
+    if (bd.type == Acts::equidistant) {
+      out.write<uint64_t>(bd.bins());
+      out.write(bd.min);
+      out.write(bd.max);
+    } else {
+      out.write(bd.boundaries());
+    }
+  }
+}
+
+Acts::BinUtility readBinUtility(InputStream& in) {
+  Acts::BinUtility bu(in.readTransform());
+  uint64_t nData = in.read<uint64_t>();
+  if (nData > 3) {
+    InputStream::corrupted();
+  }
+  for (uint64_t idata = 0; idata < nData; ++idata) {
+    auto type = in.read<uint32_t>();
+    auto option = static_cast<Acts::BinningOption>(in.read<uint32_t>());
+    auto value = static_cast<Acts::BinningValue>(in.read<uint32_t>());
+    if (type == Acts::equidistant) {
+      auto bins = in.read<uint64_t>();
+      auto min = in.read<float>();
+      auto max = in.read<float>();
+      bu += Acts::BinUtility(Acts::BinningData(option, value, bins, min, max));
+    } else {
+      auto boundaries = in.readVector<float>();
+      if (boundaries.size() < 2) {
+        InputStream::corrupted();
+      }
+      bu += Acts::BinUtility(Acts::BinningData(option, value, boundaries));
+    }
+  }
+  return bu;
+}
+
+/// Tables of the geometry objects, the snapshot refers to them by index
+struct GeometryTables {
+  template <typename object_t>
+  struct Table {
+    std::vector<const object_t*> objects;
+    std::unordered_map<const object_t*, uint64_t> indices;
+
+    void insert(const object_t* object) {
+      if (indices.emplace(object, objects.size()).second) {
+        objects.push_back(object);
+      }
+    }
+
+    uint64_t index(const object_t* object) const {
+      if (object == nullptr) {
+        return s_none;
+      }
+      auto it = indices.find(object);
+      if (it == indices.end()) {
+        throw std::invalid_argument(
+            "Reference to an object outside of the tracking geometry");
+      }
+      return it->second;
+    }
+  };
+
+  Table<Acts::Surface> surfaces;
+  Table<Acts::Layer> layers;
+  Table<Acts::TrackingVolumeArray> volumeArrays;
+  Table<Acts::TrackingVolume> volumes;
+  Table<Boundary> boundaries;
+};
+
+/// Binned array as stored in the snapshot, the grid holds table indices
+struct BinnedArrayRecord {
+  std::optional<Acts::BinUtility> binUtility;
+  std::vector<std::vector<std::vector<uint64_t>>> grid;
+};
+
+template <typename object_t, typename table_t>
+void writeBinnedArray(OutputStream& out,
+                      const Acts::BinnedArray<object_t>& array,
+                      const table_t& table) {
+  const auto& grid = array.objectGrid();
+  // The restored array orders its objects by their first appearance in the
+  // grid, and the geometry identifiers follow that order
+  std::vector<object_t> objects;
+  for (const auto& o2 : grid) {
+    for (const auto& o1 : o2) {
+      for (const auto& o0 : o1) {
+        if (o0 and std::find(objects.begin(), objects.end(), o0) ==
+                       objects.end()) {
+          objects.push_back(o0);
+        }
+      }
+    }
+  }
+  if (objects != array.arrayObjects()) {
+    throw std::invalid_argument(
+        "Binned arrays not ordered along their grid are not supported");
+  }
+
+  const Acts::BinUtility* bu = array.binUtility();
+  out.write<uint8_t>(bu != nullptr);
+  if (bu != nullptr) {
+    writeBinUtility(out, *bu);
+  }
+  out.write<uint64_t>(grid.size());
+  for (const auto& o2 : grid) {
+    out.write<uint64_t>(o2.size());
+    for (const auto& o1 : o2) {
+      std::vector<uint64_t> row;
+      row.reserve(o1.size());
+      for (const auto& o0 : o1) {
+        row.push_back(table.index(o0.get()));
+      }
+      out.write(row);
+    }
+  }
+}
+
+BinnedArrayRecord readBinnedArray(InputStream& in, size_t nObjects) {
+  BinnedArrayRecord record;
+  if (in.read<uint8_t>() != 0) {
+    record.binUtility = readBinUtility(in);
+  }
+  record.grid.resize(in.readCount());
+  for (auto& o2 : record.grid) {
+    o2.resize(in.readCount());
+    for (auto& o1 : o2) {
+      o1 = in.readVector<uint64_t>();
+      for (uint64_t index : o1) {
+        if (index != s_none and index >= nObjects) {
+          InputStream::corrupted();
+        }
+      }
+    }
+  }
+  return record;
+}
+
+template <typename object_t, typename objects_t>
+std::unique_ptr<const Acts::BinnedArray<object_t>> makeBinnedArray(
+    const BinnedArrayRecord& record, const objects_t& objects) {
+  auto object = [&](uint64_t index) -> object_t {
+    if (index == s_none) {
+      return nullptr;
+    }
+    // objects are created before the arrays referencing them
+    if (objects.at(index) == nullptr) {
+      InputStream::corrupted();
+    }
+    return objects.at(index);
+  };
+
+  const auto& bu = record.binUtility;
+  if (not bu) {
+    if (record.grid.size() != 1 or record.grid[0].size() != 1 or
+        record.grid[0][0].size() != 1) {
+      InputStream::corrupted();
+    }
+    return std::make_unique<const Acts::BinnedArrayXD<object_t>>(
+        object(record.grid[0][0][0]));
+  }
+  std::vector<std::vector<std::vector<object_t>>> grid(record.grid.size());
+  if (grid.size() != bu->bins(2)) {
+    InputStream::corrupted();
+  }
+  for (size_t i2 = 0; i2 < grid.size(); ++i2) {
+    if (record.grid[i2].size() != bu->bins(1)) {
+      InputStream::corrupted();
+    }
+    for (const auto& r1 : record.grid[i2]) {
+      if (r1.size() != bu->bins(0)) {
+        InputStream::corrupted();
+      }
+      std::vector<object_t> o1;
+      o1.reserve(r1.size());
+      std::transform(r1.begin(), r1.end(), std::back_inserter(o1), object);
+      grid[i2].push_back(std::move(o1));
+    }
+  }
+  return std::make_unique<const Acts::BinnedArrayXD<object_t>>(
+      grid, std::make_unique<const Acts::BinUtility>(*bu));
+}
+
+void collectLayer(const Acts::Layer& layer, GeometryTables& tables) {
+  if (dynamic_cast<const Acts::NavigationLayer*>(&layer) != nullptr) {
+    tables.surfaces.insert(&layer.surfaceRepresentation());
+  }
+  if (layer.surfaceArray() != nullptr) {
+    for (const auto* surface : layer.surfaceArray()->surfaces()) {
+      tables.surfaces.insert(surface);
+    }
+  }
+  if (layer.approachDescriptor() != nullptr) {
+    for (const auto* surface :
+         layer.approachDescriptor()->containedSurfaces()) {
+      tables.surfaces.insert(surface);
+    }
+  }
+  tables.layers.insert(&layer);
+}
+
+/// Volumes are collected depth first, i.e. before their mother volumes
+void collectVolume(const Acts::TrackingVolume& volume,
+                   GeometryTables& tables) {
+  if (volume.hasBoundingVolumeHierarchy() or
+      not volume.denseVolumes().empty()) {
+    throw std::invalid_argument(
+        "Tracking geometry snapshots do not support bounding volume "
+        "hierarchies and dense volumes");
+  }
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& subVolume : volume.confinedVolumes()->arrayObjects()) {
+      collectVolume(*subVolume, tables);
+    }
+    tables.volumeArrays.insert(volume.confinedVolumes().get());
+  }
+  if (volume.confinedLayers() != nullptr) {
+    for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+      collectLayer(*layer, tables);
+    }
+  }
+  tables.volumes.insert(&volume);
+}
+
+void collectBoundaries(GeometryTables& tables) {
+  for (const auto* volume : tables.volumes.objects) {
+    for (const auto& boundary : volume->boundarySurfaces()) {
+      tables.surfaces.insert(&boundary->surfaceRepresentation());
+      for (auto navDir : {Acts::NavigationDirection::Backward,
+                          Acts::NavigationDirection::Forward}) {
+        auto array = boundary->attachedVolumeArray(navDir);
+        if (array != nullptr) {
+          tables.volumeArrays.insert(array.get());
+        }
+      }
+      tables.boundaries.insert(boundary.get());
+    }
+  }
+}
+
+void writeSurface(OutputStream& out, const Acts::GeometryContext& gctx,
+                  const Acts::Surface& surface) {
+  const auto& bounds = surface.bounds();
+  // make sure the surface can be restored
+  makeSurface(surface.type(), surface.transform(gctx), bounds.type(),
+              bounds.values());
+  out.write<int32_t>(surface.type());
+  out.write(surface.transform(gctx));
+  out.write<int32_t>(bounds.type());
+  out.write(bounds.values());
+}
+
+LookupKind lookupKind(const Acts::SurfaceArray& sArray) {
+  using Acts::detail::AxisBoundaryType;
+
+  auto axes = sArray.getAxes();
+  if (axes.empty()) {
+    return LookupKind::Single;
+  }
+  auto bValues = sArray.binningValues();
+  if (axes.size() == 2 and bValues.size() == 2) {
+    auto bdt0 = axes[0]->getBoundaryType();
+    auto bdt1 = axes[1]->getBoundaryType();
+    if (bValues[0] == Acts::binPhi and bValues[1] == Acts::binZ and
+        bdt0 == AxisBoundaryType::Closed and bdt1 == AxisBoundaryType::Bound) {
+      return LookupKind::Cylinder;
+    }
+    if (bValues[0] == Acts::binR and bValues[1] == Acts::binPhi and
+        bdt0 == AxisBoundaryType::Bound and bdt1 == AxisBoundaryType::Closed) {
+      return LookupKind::Disc;
+    }
+    auto planar = [](Acts::BinningValue bValue) {
+      return bValue == Acts::binX or bValue == Acts::binY or
+             bValue == Acts::binZ;
+    };
+    if (planar(bValues[0]) and planar(bValues[1]) and
+        bdt0 == AxisBoundaryType::Bound and bdt1 == AxisBoundaryType::Bound) {
+      return LookupKind::Plane;
+    }
+  }
+  throw std::invalid_argument("Unsupported surface array binning");
+}
+
+void writeSurfaceArray(OutputStream& out, const Acts::SurfaceArray& sArray,
+                       const GeometryTables& tables) {
+  const auto& surfaces = sArray.surfaces();
+  std::vector<uint64_t> surfaceIndices;
+  std::unordered_map<const Acts::Surface*, uint32_t> localIndices;
+  for (const auto* surface : surfaces) {
+    localIndices.emplace(surface, surfaceIndices.size());
+    surfaceIndices.push_back(tables.surfaces.index(surface));
+  }
+  out.write(surfaceIndices);
+  out.write(sArray.transform());
+
+  LookupKind kind = lookupKind(sArray);
+  out.write(kind);
+  if (kind == LookupKind::Single) {
+    if (surfaces.size() != 1) {
+      throw std::invalid_argument("Unsupported surface array");
+    }
+    return;
+  }
+
+  auto axes = sArray.getAxes();
+  auto bValues = sArray.binningValues();
+  for (size_t iaxis = 0; iaxis < axes.size(); ++iaxis) {
+    out.write<uint32_t>(bValues[iaxis]);
+    out.write<uint8_t>(axes[iaxis]->isEquidistant());
+    out.write<uint64_t>(axes[iaxis]->getNBins());
+    out.write<double>(axes[iaxis]->getMin());
+    out.write<double>(axes[iaxis]->getMax());
+    out.write(axes[iaxis]->getBinEdges());
+  }
+
+  // the radius (z position) of the bin centers on cylinders (discs)
+  double reference = 0.;
+  for (size_t bin = 0; bin < sArray.size(); ++bin) {
+    if (sArray.isValidBin(bin)) {
+      Acts::Vector3 center = sArray.transform() * sArray.getBinCenter(bin);
+      reference =
+          kind == LookupKind::Cylinder ? Acts::VectorHelpers::perp(center)
+                                       : center.z();
+      break;
+    }
+  }
+  out.write(reference);
+
+  out.write<uint64_t>(sArray.size());
+  for (size_t bin = 0; bin < sArray.size(); ++bin) {
+    std::vector<uint32_t> content;
+    for (const auto* surface : sArray.at(bin)) {
+      auto it = localIndices.find(surface);
+      if (it == localIndices.end()) {
+        throw std::invalid_argument("Surface array with unregistered surface");
+      }
+      content.push_back(it->second);
+    }
+    out.write(content);
+  }
+}
+
+void writeLayer(OutputStream& out, const Acts::GeometryContext& gctx,
+                const Acts::Layer& layer, const GeometryTables& tables) {
+  LayerKind kind = LayerKind::Navigation;
+  if (dynamic_cast<const Acts::CylinderLayer*>(&layer) != nullptr) {
+    kind = LayerKind::Cylinder;
+  } else if (dynamic_cast<const Acts::DiscLayer*>(&layer) != nullptr) {
+    kind = LayerKind::Disc;
+  } else if (dynamic_cast<const Acts::PlaneLayer*>(&layer) != nullptr) {
+    kind = LayerKind::Plane;
+  } else if (dynamic_cast<const Acts::NavigationLayer*>(&layer) == nullptr) {
+    throw std::invalid_argument("Unsupported layer type");
+  }
+  out.write(kind);
+  out.write<int32_t>(layer.layerType());
+  out.write(layer.thickness());
+
+  const auto& representation = layer.surfaceRepresentation();
+  if (kind == LayerKind::Navigation) {
+    out.write(tables.surfaces.index(&representation));
+  } else {
+    out.write(representation.transform(gctx));
+    out.write<int32_t>(representation.bounds().type());
+    out.write(representation.bounds().values());
+  }
+
+  const Acts::SurfaceArray* sArray = layer.surfaceArray();
+  out.write<uint8_t>(sArray != nullptr);
+  if (sArray != nullptr) {
+    writeSurfaceArray(out, *sArray, tables);
+  }
+
+  const Acts::ApproachDescriptor* approach = layer.approachDescriptor();
+  out.write<uint8_t>(approach != nullptr);
+  if (approach != nullptr) {
+    std::vector<uint64_t> approachIndices;
+    for (const auto* surface : approach->containedSurfaces()) {
+      approachIndices.push_back(tables.surfaces.index(surface));
+    }
+    out.write(approachIndices);
+  }
+}
+
+std::unique_ptr<Acts::SurfaceArray> readSurfaceArray(
+    InputStream& in, const std::vector<std::shared_ptr<Acts::Surface>>& table) {
+  using Acts::detail::AxisBoundaryType;
+  using Acts::VectorHelpers::perp;
+  using Acts::VectorHelpers::phi;
+
+  std::vector<std::shared_ptr<const Acts::Surface>> surfaces;
+  for (uint64_t index : in.readVector<uint64_t>()) {
+    if (index >= table.size()) {
+      InputStream::corrupted();
+    }
+    surfaces.push_back(table[index]);
+  }
+  Acts::Transform3 transform = in.readTransform();
+  auto kind = in.read<LookupKind>();
+  if (kind == LookupKind::Single) {
+    if (surfaces.size() != 1) {
+      InputStream::corrupted();
+    }
+    return std::make_unique<Acts::SurfaceArray>(surfaces.front());
+  }
+
+  std::array<Acts::SurfaceArrayCreator::ProtoAxis, 2> pAxes;
+  for (auto& pAxis : pAxes) {
+    pAxis.bValue = static_cast<Acts::BinningValue>(in.read<uint32_t>());
+    pAxis.bType =
+        in.read<uint8_t>() != 0 ? Acts::equidistant : Acts::arbitrary;
+    pAxis.nBins = in.read<uint64_t>();
+    pAxis.min = in.read<double>();
+    pAxis.max = in.read<double>();
+    pAxis.binEdges = in.readVector<double>();
+    if (pAxis.nBins == 0 or (pAxis.bType == Acts::arbitrary and
+                             pAxis.binEdges.size() != pAxis.nBins + 1)) {
+      InputStream::corrupted();
+    }
+  }
+  double reference = in.read<double>();
+
+  Acts::Transform3 itransform = transform.inverse();
+  std::unique_ptr<Acts::SurfaceArray::ISurfaceGridLookup> sl;
+  switch (kind) {
+    case LookupKind::Cylinder: {
+      auto globalToLocal = [transform](const Acts::Vector3& pos) {
+        Acts::Vector3 loc = transform * pos;
+        return Acts::Vector2(phi(loc), loc.z());
+      };
+      auto localToGlobal = [itransform, reference](const Acts::Vector2& loc) {
+        return itransform * Acts::Vector3(reference * std::cos(loc[0]),
+                                          reference * std::sin(loc[0]),
+                                          loc[1]);
+      };
+      sl = Acts::SurfaceArrayCreator::makeSurfaceGridLookup2D<
+          AxisBoundaryType::Closed, AxisBoundaryType::Bound>(
+          globalToLocal, localToGlobal, pAxes[0], pAxes[1]);
+      break;
+    }
+    case LookupKind::Disc: {
+      auto globalToLocal = [transform](const Acts::Vector3& pos) {
+        Acts::Vector3 loc = transform * pos;
+        return Acts::Vector2(perp(loc), phi(loc));
+      };
+      auto localToGlobal = [itransform, reference](const Acts::Vector2& loc) {
+        return itransform * Acts::Vector3(loc[0] * std::cos(loc[1]),
+                                          loc[0] * std::sin(loc[1]),
+                                          reference);
+      };
+      sl = Acts::SurfaceArrayCreator::makeSurfaceGridLookup2D<
+          AxisBoundaryType::Bound, AxisBoundaryType::Closed>(
+          globalToLocal, localToGlobal, pAxes[0], pAxes[1]);
+      break;
+    }
+    case LookupKind::Plane: {
+      auto globalToLocal = [transform](const Acts::Vector3& pos) {
+        Acts::Vector3 loc = transform * pos;
+        return Acts::Vector2(loc.x(), loc.y());
+      };
+      auto localToGlobal = [itransform](const Acts::Vector2& loc) {
+        return itransform * Acts::Vector3(loc.x(), loc.y(), 0.);
+      };
+      sl = Acts::SurfaceArrayCreator::makeSurfaceGridLookup2D<
+          AxisBoundaryType::Bound, AxisBoundaryType::Bound>(
+          globalToLocal, localToGlobal, pAxes[0], pAxes[1]);
+      break;
+    }
+    default:
+      InputStream::corrupted();
+  }
+
+  // the bins are restored as they were, without binning the surfaces again
+  if (in.read<uint64_t>() != sl->size()) {
+    InputStream::corrupted();
+  }
+  for (size_t bin = 0; bin < sl->size(); ++bin) {
+    auto& content = sl->lookup(bin);
+    for (uint32_t index : in.readVector<uint32_t>()) {
+      if (index >= surfaces.size()) {
+        InputStream::corrupted();
+      }
+      content.push_back(surfaces[index].get());
+    }
+  }
+  // filling no further surfaces only builds the neighbor cache
+  sl->fill(Acts::GeometryContext(), {});
+
+  return std::make_unique<Acts::SurfaceArray>(std::move(sl),
+                                              std::move(surfaces), transform);
+}
+
+Acts::LayerPtr readLayer(
+    InputStream& in, const std::vector<std::shared_ptr<Acts::Surface>>& table) {
+  auto kind = in.read<LayerKind>();
+  auto layerType = static_cast<Acts::LayerType>(in.read<int32_t>());
+  auto thickness = in.read<double>();
+
+  if (kind == LayerKind::Navigation) {
+    uint64_t index = in.readIndex(table.size());
+    if (index == s_none or in.read<uint8_t>() != 0 or
+        in.read<uint8_t>() != 0) {
+      InputStream::corrupted();
+    }
+    return Acts::NavigationLayer::create(table[index], thickness);
+  }
+
+  Acts::Transform3 transform = in.readTransform();
+  auto boundsType = in.read<int32_t>();
+  auto boundsValues = in.readVector<double>();
+
+  std::unique_ptr<Acts::SurfaceArray> sArray = nullptr;
+  if (in.read<uint8_t>() != 0) {
+    sArray = readSurfaceArray(in, table);
+  }
+  std::unique_ptr<Acts::ApproachDescriptor> approach = nullptr;
+  if (in.read<uint8_t>() != 0) {
+    std::vector<std::shared_ptr<const Acts::Surface>> aSurfaces;
+    for (uint64_t index : in.readVector<uint64_t>()) {
+      if (index >= table.size()) {
+        InputStream::corrupted();
+      }
+      aSurfaces.push_back(table[index]);
+    }
+    approach =
+        std::make_unique<Acts::GenericApproachDescriptor>(std::move(aSurfaces));
+  }
+
+  std::vector<Acts::Surface*> sensitive;
+  if (sArray != nullptr) {
+    for (const auto* surface : sArray->surfaces()) {
+      sensitive.push_back(const_cast<Acts::Surface*>(surface));
+    }
+  }
+
+  Acts::MutableLayerPtr layer = nullptr;
+  switch (kind) {
+    case LayerKind::Cylinder:
+      layer = Acts::CylinderLayer::create(
+          transform, makeCylinderBounds(boundsType, boundsValues),
+          std::move(sArray), thickness, std::move(approach), layerType);
+      break;
+    case LayerKind::Disc:
+      layer = Acts::DiscLayer::create(
+          transform, makeDiscBounds(boundsType, boundsValues),
+          std::move(sArray), thickness, std::move(approach), layerType);
+      break;
+    case LayerKind::Plane:
+      layer = Acts::PlaneLayer::create(
+          transform, makePlanarBounds(boundsType, boundsValues),
+          std::move(sArray), thickness, std::move(approach), layerType);
+      break;
+    default:
+      InputStream::corrupted();
+  }
+  // the surfaces are owned by the snapshot tables, nothing else points to
+  // them yet
+  for (auto* surface : sensitive) {
+    surface->associateLayer(*layer);
+  }
+  return layer;
+}
+
+}  // namespace
+
+void Acts::TrackingGeometrySnapshot::write(const std::string& fileName,
+                                           const TrackingGeometry& tGeometry) {
+  GeometryContext gctx;
+  const TrackingVolume* world = tGeometry.highestTrackingVolume();
+  if (world == nullptr) {
+    throw std::invalid_argument("Tracking geometry without world volume");
+  }
+
+  GeometryTables tables;
+  collectVolume(*world, tables);
+  collectBoundaries(tables);
+
+  OutputStream out;
+  out.write(s_magic);
+  out.write(s_version);
+  out.write<uint64_t>(tables.surfaces.objects.size());
+  out.write<uint64_t>(tables.layers.objects.size());
+  out.write<uint64_t>(tables.volumeArrays.objects.size());
+  out.write<uint64_t>(tables.volumes.objects.size());
+  out.write<uint64_t>(tables.boundaries.objects.size());
+
+  for (const auto* surface : tables.surfaces.objects) {
+    writeSurface(out, gctx, *surface);
+  }
+  for (const auto* layer : tables.layers.objects) {
+    writeLayer(out, gctx, *layer, tables);
+  }
+  for (const auto* array : tables.volumeArrays.objects) {
+    writeBinnedArray(out, *array, tables.volumes);
+  }
+  for (const auto* volume : tables.volumes.objects) {
+    out.write(volume->volumeName());
+    out.write(volume->transform());
+    out.write<int32_t>(volume->volumeBounds().type());
+    out.write(volume->volumeBounds().values());
+    out.write(tables.volumeArrays.index(volume->confinedVolumes().get()));
+    const LayerArray* layers = volume->confinedLayers();
+    out.write<uint8_t>(layers != nullptr);
+    if (layers != nullptr) {
+      writeBinnedArray(out, *layers, tables.layers);
+    }
+  }
+  for (const auto* boundary : tables.boundaries.objects) {
+    out.write(tables.surfaces.index(&boundary->surfaceRepresentation()));
+    for (auto navDir :
+         {NavigationDirection::Backward, NavigationDirection::Forward}) {
+      out.write(tables.volumes.index(boundary->attachedVolume(navDir)));
+      out.write(tables.volumeArrays.index(
+          boundary->attachedVolumeArray(navDir).get()));
+    }
+  }
+  for (const auto* volume : tables.volumes.objects) {
+    std::vector<uint64_t> boundaryIndices;
+    for (const auto& boundary : volume->boundarySurfaces()) {
+      boundaryIndices.push_back(tables.boundaries.index(boundary.get()));
+    }
+    out.write(boundaryIndices);
+  }
+
+  std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+  ofs.write(out.bytes().data(), out.bytes().size());
+  if (not ofs.good()) {
+    throw std::runtime_error("Unable to write tracking geometry snapshot " +
+                             fileName);
+  }
+}
+
+std::unique_ptr<const Acts::TrackingGeometry>
+Acts::TrackingGeometrySnapshot::read(
+    const std::string& fileName, const IMaterialDecorator* materialDecorator) {
+  std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+  if (not ifs.good()) {
+    throw std::runtime_error("Unable to open tracking geometry snapshot " +
+                             fileName);
+  }
+  std::string bytes{std::istreambuf_iterator<char>(ifs),
+                    std::istreambuf_iterator<char>()};
+  InputStream in(std::move(bytes));
+
+  try {
+    if (in.read<std::array<char, 8>>() != s_magic) {
+      throw std::runtime_error(fileName +
+                               " is not a tracking geometry snapshot");
+    }
+    if (in.read<uint32_t>() != s_version) {
+      throw std::runtime_error("Incompatible tracking geometry snapshot " +
+                               fileName);
+    }
+    // every record takes at least a few bytes
+    std::vector<std::shared_ptr<Surface>> surfaces(in.readCount());
+    std::vector<LayerPtr> layers(in.readCount());
+    std::vector<BinnedArrayRecord> arrayRecords(in.readCount());
+    std::vector<MutableTrackingVolumePtr> volumes(in.readCount());
+    std::vector<std::shared_ptr<const Boundary>> boundaries(in.readCount());
+    if (volumes.empty()) {
+      InputStream::corrupted();
+    }
+
+    for (auto& surface : surfaces) {
+      auto surfaceType = in.read<int32_t>();
+      Transform3 transform = in.readTransform();
+      auto boundsType = in.read<int32_t>();
+      surface = makeSurface(surfaceType, transform, boundsType,
+                            in.readVector<double>());
+    }
+    for (auto& layer : layers) {
+      layer = readLayer(in, surfaces);
+    }
+    for (auto& record : arrayRecords) {
+      record = readBinnedArray(in, volumes.size());
+    }
+
+    // the volume arrays are built once all their volumes exist
+    std::vector<std::shared_ptr<const TrackingVolumeArray>> volumeArrays(
+        arrayRecords.size());
+    auto volumeArray = [&](uint64_t index) {
+      if (index != s_none and volumeArrays[index] == nullptr) {
+        volumeArrays[index] = makeBinnedArray<TrackingVolumePtr>(
+            arrayRecords[index], volumes);
+      }
+      return index != s_none ? volumeArrays[index] : nullptr;
+    };
+
+    for (auto& volume : volumes) {
+      std::string name = in.readString();
+      Transform3 transform = in.readTransform();
+      auto boundsType = in.read<int32_t>();
+      auto bounds = makeVolumeBounds(boundsType, in.readVector<double>());
+      auto confinedVolumes = volumeArray(in.readIndex(arrayRecords.size()));
+      std::unique_ptr<const LayerArray> confinedLayers = nullptr;
+      if (in.read<uint8_t>() != 0) {
+        confinedLayers = makeBinnedArray<LayerPtr>(
+            readBinnedArray(in, layers.size()), layers);
+      }
+      volume = TrackingVolume::create(transform, bounds, nullptr,
+                                      std::move(confinedLayers),
+                                      confinedVolumes, {}, name);
+    }
+
+    for (auto& boundary : boundaries) {
+      uint64_t surfaceIndex = in.readIndex(surfaces.size());
+      if (surfaceIndex == s_none) {
+        InputStream::corrupted();
+      }
+      auto mutableBoundary = std::make_shared<Boundary>(
+          surfaces[surfaceIndex], nullptr, nullptr);
+      for (auto navDir :
+           {NavigationDirection::Backward, NavigationDirection::Forward}) {
+        uint64_t volumeIndex = in.readIndex(volumes.size());
+        if (volumeIndex != s_none) {
+          mutableBoundary->attachVolume(volumes[volumeIndex].get(), navDir);
+        }
+        auto array = volumeArray(in.readIndex(arrayRecords.size()));
+        if (array != nullptr) {
+          mutableBoundary->attachVolumeArray(array, navDir);
+        }
+      }
+      boundary = std::move(mutableBoundary);
+    }
+    for (auto& volume : volumes) {
+      auto boundaryIndices = in.readVector<uint64_t>();
+      if (boundaryIndices.size() != volume->boundarySurfaces().size()) {
+        InputStream::corrupted();
+      }
+      for (size_t iface = 0; iface < boundaryIndices.size(); ++iface) {
+        if (boundaryIndices[iface] >= boundaries.size()) {
+          InputStream::corrupted();
+        }
+        volume->updateBoundarySurface(BoundarySurfaceFace(iface),
+                                      boundaries[boundaryIndices[iface]],
+                                      false);
+      }
+    }
+
+    // volumes are stored depth first, the world volume comes last
+    return std::make_unique<const TrackingGeometry>(volumes.back(),
+                                                    materialDecorator);
+  } catch (const std::invalid_argument& e) {
+    throw std::runtime_error("Invalid tracking geometry snapshot " +
+                             fileName + ": " + e.what());
+  }
+}
@@ -0,0 +1,248 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/BinaryBFieldMap.hpp"
+
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'B', 'F', 'L', 'D'};
+constexpr uint32_t s_version = 1;
+/// The values start on a cache line boundary
+constexpr uint64_t s_alignment = 64;
+constexpr size_t s_maxDimensions = 3;
+
+struct AxisRecord {
+  double min = 0.;
+  double max = 0.;
+  uint64_t nBins = 0;
+};
+
+/// The data offset is in bytes w.r.t. the beginning of the file
+struct FileHeader {
+  std::array<char, 8> magic = s_magic;
+  uint32_t version = s_version;
+  uint32_t nDimensions = 0;
+  uint32_t nComponents = 0;
+  uint32_t padding = 0;
+  std::array<AxisRecord, s_maxDimensions> axes = {};
+  uint64_t nValues = 0;
+  uint64_t data = 0;
+};
+
+/// Read-only shared memory mapping of a whole file
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& fileName) {
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Unable to open binary field map file " +
+                               fileName);
+    }
+    struct stat status {};
+    if (::fstat(fd, &status) != 0 or status.st_size <= 0) {
+      ::close(fd);
+      throw std::runtime_error("Unable to read binary field map file " +
+                               fileName);
+    }
+    m_size = static_cast<size_t>(status.st_size);
+    // shared read-only mapping: the pages are backed by the page cache and
+    // thus shared by all processes mapping the same file
+    void* address = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+      throw std::runtime_error("Unable to map binary field map file " +
+                               fileName);
+    }
+    m_data = static_cast<const char*>(address);
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() { ::munmap(const_cast<char*>(m_data), m_size); }
+
+  /// Pointer to @p n objects of type T at @p offset, after bounds checking
+  template <typename T>
+  const T* at(uint64_t offset, uint64_t n) const {
+    if (offset % alignof(T) != 0 or offset > m_size or
+        n > (m_size - offset) / sizeof(T)) {
+      throw std::runtime_error("Corrupted binary field map file");
+    }
+    return reinterpret_cast<const T*>(m_data + offset);
+  }
+
+  /// Copy of the object of type T at @p offset
+  template <typename T>
+  T get(uint64_t offset) const {
+    T value;
+    std::memcpy(&value, at<char>(offset, sizeof(T)), sizeof(T));
+    return value;
+  }
+
+ private:
+  const char* m_data = nullptr;
+  size_t m_size = 0;
+};
+
+template <typename grid_t>
+void writeGrid(const std::string& fileName, const grid_t& grid) {
+  constexpr size_t nComponents = grid_t::value_type::RowsAtCompileTime;
+
+  FileHeader header;
+  header.nDimensions = grid_t::DIM;
+  header.nComponents = nComponents;
+  auto axes = grid.axes();
+  for (size_t iaxis = 0; iaxis < grid_t::DIM; ++iaxis) {
+    header.axes[iaxis].min = axes[iaxis]->getMin();
+    header.axes[iaxis].max = axes[iaxis]->getMax();
+    header.axes[iaxis].nBins = axes[iaxis]->getNBins();
+  }
+  header.nValues = nComponents * grid.size();
+  header.data = (sizeof(FileHeader) + s_alignment - 1) / s_alignment *
+                s_alignment;
+
+  std::vector<float> values;
+  values.reserve(header.nValues);
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    const auto& value = grid.at(bin);
+    for (size_t icomp = 0; icomp < nComponents; ++icomp) {
+      values.push_back(static_cast<float>(value[icomp]));
+    }
+  }
+
+  std::vector<char> padding(header.data - sizeof(FileHeader), '\0');
+  std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+  ofs.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  ofs.write(padding.data(), padding.size());
+  ofs.write(reinterpret_cast<const char*>(values.data()),
+            values.size() * sizeof(float));
+  if (not ofs.good()) {
+    throw std::runtime_error("Unable to write binary field map file " +
+                             fileName);
+  }
+}
+
+template <size_t... I>
+auto makeAxes(const FileHeader& header, std::index_sequence<I...> /*ind*/) {
+  return std::make_tuple(Acts::detail::EquidistantAxis(
+      header.axes[I].min, header.axes[I].max, header.axes[I].nBins)...);
+}
+
+template <typename grid_t>
+grid_t readGrid(const std::string& fileName) {
+  constexpr size_t nComponents = grid_t::NCOMP;
+
+  auto file = std::make_shared<MappedFile>(fileName);
+  auto header = file->get<FileHeader>(0);
+  if (header.magic != s_magic) {
+    throw std::runtime_error(fileName + " is not a binary field map file");
+  }
+  if (header.version != s_version) {
+    throw std::runtime_error("Incompatible binary field map file " +
+                             fileName);
+  }
+  if (header.nDimensions != grid_t::DIM or
+      header.nComponents != nComponents) {
+    throw std::runtime_error("Unexpected field map type in " + fileName);
+  }
+
+  // all bins including under- and overflow bins are stored
+  uint64_t nValues = nComponents;
+  for (size_t iaxis = 0; iaxis < grid_t::DIM; ++iaxis) {
+    const auto& axis = header.axes[iaxis];
+    if (axis.nBins == 0 or not(axis.min < axis.max) or
+        nValues > std::numeric_limits<uint64_t>::max() / (axis.nBins + 2)) {
+      throw std::runtime_error("Corrupted binary field map file " + fileName);
+    }
+    nValues *= axis.nBins + 2;
+  }
+  if (nValues != header.nValues) {
+    throw std::runtime_error("Corrupted binary field map file " + fileName);
+  }
+  const float* values = file->at<float>(header.data, header.nValues);
+
+  return grid_t(makeAxes(header, std::make_index_sequence<grid_t::DIM>()),
+                std::shared_ptr<const float>(file, values));
+}
+
+}  // namespace
+
+void Acts::BinaryBFieldMap::write(
+    const std::string& fileName,
+    const detail::Grid<Vector2, detail::EquidistantAxis,
+                       detail::EquidistantAxis>& grid) {
+  writeGrid(fileName, grid);
+}
+
+void Acts::BinaryBFieldMap::write(
+    const std::string& fileName,
+    const detail::Grid<Vector3, detail::EquidistantAxis,
+                       detail::EquidistantAxis, detail::EquidistantAxis>&
+        grid) {
+  writeGrid(fileName, grid);
+}
+
+Acts::InterpolatedBFieldMap<Acts::CompactBFieldGridRZ>
+Acts::BinaryBFieldMap::readRZ(const std::string& fileName) {
+  // map (x,y,z) -> (r,z)
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(VectorHelpers::perp(pos), pos.z());
+  };
+
+  // map (Br,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Vector2& field, const Vector3& pos) {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi, sin_phi;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    } else {
+      cos_phi = 1.;
+      sin_phi = 0.;
+    }
+    return Vector3(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  };
+
+  return InterpolatedBFieldMap<CompactBFieldGridRZ>(
+      {transformPos, transformBField,
+       readGrid<CompactBFieldGridRZ>(fileName)});
+}
+
+Acts::InterpolatedBFieldMap<Acts::CompactBFieldGridXYZ>
+Acts::BinaryBFieldMap::readXYZ(const std::string& fileName) {
+  auto transformPos = [](const Vector3& pos) { return pos; };
+  auto transformBField = [](const Vector3& field, const Vector3& /*pos*/) {
+    return field;
+  };
+
+  return InterpolatedBFieldMap<CompactBFieldGridXYZ>(
+      {transformPos, transformBField,
+       readGrid<CompactBFieldGridXYZ>(fileName)});
+}
@@ -0,0 +1,629 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/BinaryMaterialMap.hpp"
+
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/BinnedSurfaceMaterialView.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/MaterialGridHelper.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Material/ProtoVolumeMaterial.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// The slabs are used in place, i.e. they must not require construction
+static_assert(std::is_trivially_copyable_v<Acts::MaterialSlab>,
+              "MaterialSlab must be trivially copyable");
+static_assert(std::is_standard_layout_v<Acts::MaterialSlab>,
+              "MaterialSlab must have standard layout");
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'M', 'A', 'T', '\0'};
+constexpr uint32_t s_version = 1;
+constexpr size_t s_alignment = 8;
+constexpr size_t s_materialParameters = 5;
+
+enum class SurfaceType : uint32_t { Proto = 0, Homogeneous = 1, Binned = 2 };
+enum class VolumeType : uint32_t {
+  Proto = 0,
+  Homogeneous = 1,
+  Grid2D = 2,
+  Grid3D = 3
+};
+
+struct FileHeader {
+  std::array<char, 8> magic = s_magic;
+  uint32_t version = s_version;
+  uint32_t slabSize = sizeof(Acts::MaterialSlab);
+  uint64_t nSurfaces = 0;
+  uint64_t nVolumes = 0;
+};
+
+/// All offsets are in bytes w.r.t. the beginning of the file
+struct SurfaceRecord {
+  uint64_t geoId = 0;
+  SurfaceType type = SurfaceType::Proto;
+  int32_t mappingType = Acts::MappingType::Default;
+  double splitFactor = 0.;
+  uint64_t binning = 0;
+  uint64_t data = 0;
+  uint64_t bins0 = 0;
+  uint64_t bins1 = 0;
+};
+
+struct VolumeRecord {
+  uint64_t geoId = 0;
+  VolumeType type = VolumeType::Proto;
+  uint32_t padding = 0;
+  uint64_t binning = 0;
+  uint64_t data = 0;
+  uint64_t nValues = 0;
+};
+
+/// Followed by nData binning records and the boundaries of the arbitrary
+/// binnings in the same order
+struct BinUtilityRecord {
+  std::array<double, 16> transform = {};
+  uint64_t nData = 0;
+};
+
+struct BinningRecord {
+  uint32_t type = 0;
+  uint32_t option = 0;
+  uint32_t value = 0;
+  uint32_t bins = 0;
+  float min = 0.;
+  float max = 0.;
+};
+
+/// Byte buffer with aligned appends
+class OutputBuffer {
+ public:
+  template <typename T>
+  uint64_t append(const T* values, size_t n) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    m_bytes.resize((m_bytes.size() + s_alignment - 1) / s_alignment *
+                   s_alignment);
+    uint64_t offset = m_bytes.size();
+    m_bytes.resize(offset + n * sizeof(T));
+    if (n != 0) {
+      std::memcpy(m_bytes.data() + offset, values, n * sizeof(T));
+    }
+    return offset;
+  }
+
+  template <typename T>
+  uint64_t append(const T& value) {
+    return append(&value, 1);
+  }
+
+  template <typename T>
+  void overwrite(uint64_t offset, const T& value) {
+    std::memcpy(m_bytes.data() + offset, &value, sizeof(T));
+  }
+
+  const std::vector<char>& bytes() const { return m_bytes; }
+
+ private:
+  std::vector<char> m_bytes;
+};
+
+/// Read-only (copy-on-write) memory mapping of a whole file
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& fileName) {
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Unable to open binary material map file " +
+                               fileName);
+    }
+    struct stat status {};
+    if (::fstat(fd, &status) != 0 or status.st_size <= 0) {
+      ::close(fd);
+      throw std::runtime_error("Unable to read binary material map file " +
+                               fileName);
+    }
+    m_size = static_cast<size_t>(status.st_size);
+    // private mapping: surface material can still be scaled in place without
+    // touching the file, only the modified pages are copied
+    void* address = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+      throw std::runtime_error("Unable to map binary material map file " +
+                               fileName);
+    }
+    m_data = static_cast<char*>(address);
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() { ::munmap(m_data, m_size); }
+
+  /// Pointer to @p n objects of type T at @p offset, after bounds checking
+  template <typename T>
+  T* at(uint64_t offset, uint64_t n) const {
+    if (offset % alignof(T) != 0 or offset > m_size or
+        n > (m_size - offset) / sizeof(T)) {
+      throw std::runtime_error("Corrupted binary material map file");
+    }
+    return reinterpret_cast<T*>(m_data + offset);
+  }
+
+  /// Size of the mapped file in bytes
+  size_t size() const { return m_size; }
+
+  /// Copy of the object of type T at @p offset
+  template <typename T>
+  T get(uint64_t offset) const {
+    T value;
+    std::memcpy(&value, at<char>(offset, sizeof(T)), sizeof(T));
+    return value;
+  }
+
+ private:
+  char* m_data = nullptr;
+  size_t m_size = 0;
+};
+
+uint64_t writeBinUtility(OutputBuffer& buffer, const Acts::BinUtility& bu) {
+  BinUtilityRecord record;
+  std::memcpy(record.transform.data(), bu.transform().matrix().data(),
+              sizeof(record.transform));
+  record.nData = bu.binningData().size();
+  uint64_t offset = buffer.append(record);
+
+  for (const auto& bd : bu.binningData()) {
+    if (bd.subBinningData != nullptr) {
+      throw std::invalid_argument(
+          "Binary material maps do not support sub binning");
+    }
+    BinningRecord bRecord;
+    bRecord.type = bd.type;
+    bRecord.option = bd.option;
+    bRecord.value = bd.binvalue;
+    bRecord.bins = bd.bins();
+    bRecord.min = bd.min;
+    bRecord.max = bd.max;
+    buffer.append(bRecord);
+  }
+  for (const auto& bd : bu.binningData()) {
+    if (bd.type == Acts::arbitrary) {
+      buffer.append(bd.boundaries().data(), bd.boundaries().size());
+    }
+  }
+  return offset;
+}
+
+Acts::BinUtility readBinUtility(const MappedFile& file, uint64_t offset) {
+  auto record = file.get<BinUtilityRecord>(offset);
+  Acts::Transform3 transform;
+  std::memcpy(transform.matrix().data(), record.transform.data(),
+              sizeof(record.transform));
+  if (record.nData > 3) {
+    throw std::runtime_error("Corrupted binary material map file");
+  }
+
+  std::vector<BinningRecord> bRecords;
+  offset += sizeof(BinUtilityRecord);
+  for (uint64_t idata = 0; idata < record.nData; ++idata) {
+    offset = (offset + s_alignment - 1) / s_alignment * s_alignment;
+    bRecords.push_back(file.get<BinningRecord>(offset));
+    offset += sizeof(BinningRecord);
+  }
+
+  Acts::BinUtility bu(transform);
+  for (const auto& bRecord : bRecords) {
+    auto option = static_cast<Acts::BinningOption>(bRecord.option);
+    auto value = static_cast<Acts::BinningValue>(bRecord.value);
+    // a valid map can not have more bins than bytes in the file
+    if (bRecord.bins == 0 or bRecord.bins > file.size()) {
+      throw std::runtime_error("Corrupted binary material map file");
+    }
+    if (bRecord.type == Acts::equidistant) {
+      bu += Acts::BinUtility(Acts::BinningData(option, value, bRecord.bins,
+                                               bRecord.min, bRecord.max));
+      continue;
+    }
+    offset = (offset + s_alignment - 1) / s_alignment * s_alignment;
+    const size_t nBoundaries = static_cast<size_t>(bRecord.bins) + 1;
+    const float* boundaries = file.at<float>(offset, nBoundaries);
+    offset += nBoundaries * sizeof(float);
+    bu += Acts::BinUtility(Acts::BinningData(
+        option, value,
+        std::vector<float>(boundaries, boundaries + nBoundaries)));
+  }
+  return bu;
+}
+
+void writeMaterialParameters(OutputBuffer& buffer, VolumeRecord& record,
+                             const std::vector<float>& values) {
+  record.data = buffer.append(values.data(), values.size());
+  record.nValues = values.size() / s_materialParameters;
+}
+
+template <typename grid_t>
+std::vector<float> gridValues(const grid_t& grid) {
+  std::vector<float> values;
+  values.reserve(grid.size() * s_materialParameters);
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    const auto& parameters = grid.at(bin);
+    values.insert(values.end(), parameters.data(),
+                  parameters.data() + s_materialParameters);
+  }
+  return values;
+}
+
+template <typename grid_t>
+void fillGrid(grid_t& grid, const float* values, uint64_t nValues) {
+  if (nValues != grid.size()) {
+    throw std::runtime_error("Inconsistent volume material grid size");
+  }
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    Acts::Material::ParametersVector parameters;
+    std::memcpy(parameters.data(), values + bin * s_materialParameters,
+                s_materialParameters * sizeof(float));
+    grid.at(bin) = parameters;
+  }
+}
+
+SurfaceRecord writeSurfaceMaterial(OutputBuffer& buffer,
+                                   const Acts::ISurfaceMaterial& material) {
+  SurfaceRecord record;
+  record.mappingType = material.mappingType();
+  // the split factor is only accessible through the update factors
+  record.splitFactor = material.factor(Acts::NavigationDirection::Forward,
+                                       Acts::MaterialUpdateStage::PostUpdate);
+
+  if (auto proto = dynamic_cast<const Acts::ProtoSurfaceMaterial*>(&material);
+      proto != nullptr) {
+    record.type = SurfaceType::Proto;
+    record.binning = writeBinUtility(buffer, proto->binUtility());
+    return record;
+  }
+  if (auto homogeneous =
+          dynamic_cast<const Acts::HomogeneousSurfaceMaterial*>(&material);
+      homogeneous != nullptr) {
+    record.type = SurfaceType::Homogeneous;
+    record.data = buffer.append(homogeneous->materialSlab(0, 0));
+    record.bins0 = 1;
+    record.bins1 = 1;
+    return record;
+  }
+  if (auto binned = dynamic_cast<const Acts::BinnedSurfaceMaterial*>(&material);
+      binned != nullptr) {
+    record.type = SurfaceType::Binned;
+    record.binning = writeBinUtility(buffer, binned->binUtility());
+    const auto& matrix = binned->fullMaterial();
+    record.bins1 = matrix.size();
+    record.bins0 = matrix.empty() ? 0 : matrix.front().size();
+    // store the slab matrix as one flat array, bin0 running fastest
+    std::vector<Acts::MaterialSlab> slabs;
+    slabs.reserve(record.bins0 * record.bins1);
+    for (const auto& row : matrix) {
+      if (row.size() != record.bins0) {
+        throw std::invalid_argument("Irregular binned surface material");
+      }
+      slabs.insert(slabs.end(), row.begin(), row.end());
+    }
+    record.data = buffer.append(slabs.data(), slabs.size());
+    return record;
+  }
+  if (auto view =
+          dynamic_cast<const Acts::BinnedSurfaceMaterialView*>(&material);
+      view != nullptr) {
+    record.type = SurfaceType::Binned;
+    record.binning = writeBinUtility(buffer, view->binUtility());
+    record.bins0 = view->bins0();
+    record.bins1 = view->bins1();
+    record.data = buffer.append(&view->materialSlab(0, 0),
+                                record.bins0 * record.bins1);
+    return record;
+  }
+  throw std::invalid_argument("Unsupported surface material type");
+}
+
+VolumeRecord writeVolumeMaterial(OutputBuffer& buffer,
+                                 const Acts::IVolumeMaterial& material) {
+  using Grid2DMap =
+      Acts::InterpolatedMaterialMap<Acts::MaterialMapper<Acts::MaterialGrid2D>>;
+  using Grid3DMap =
+      Acts::InterpolatedMaterialMap<Acts::MaterialMapper<Acts::MaterialGrid3D>>;
+
+  VolumeRecord record;
+  if (auto proto = dynamic_cast<const Acts::ProtoVolumeMaterial*>(&material);
+      proto != nullptr) {
+    record.type = VolumeType::Proto;
+    record.binning = writeBinUtility(buffer, proto->binUtility());
+    return record;
+  }
+  if (auto homogeneous =
+          dynamic_cast<const Acts::HomogeneousVolumeMaterial*>(&material);
+      homogeneous != nullptr) {
+    record.type = VolumeType::Homogeneous;
+    const auto parameters = homogeneous->material({0, 0, 0}).parameters();
+    writeMaterialParameters(
+        buffer, record,
+        std::vector<float>(parameters.data(),
+                           parameters.data() + s_materialParameters));
+    return record;
+  }
+  if (auto grid2D = dynamic_cast<const Grid2DMap*>(&material);
+      grid2D != nullptr) {
+    record.type = VolumeType::Grid2D;
+    record.binning = writeBinUtility(buffer, grid2D->binUtility());
+    writeMaterialParameters(buffer, record,
+                            gridValues(grid2D->getMapper().getGrid()));
+    return record;
+  }
+  if (auto grid3D = dynamic_cast<const Grid3DMap*>(&material);
+      grid3D != nullptr) {
+    record.type = VolumeType::Grid3D;
+    record.binning = writeBinUtility(buffer, grid3D->binUtility());
+    writeMaterialParameters(buffer, record,
+                            gridValues(grid3D->getMapper().getGrid()));
+    return record;
+  }
+  throw std::invalid_argument("Unsupported volume material type");
+}
+
+std::shared_ptr<const Acts::ISurfaceMaterial> readSurfaceMaterial(
+    const std::shared_ptr<MappedFile>& file, const SurfaceRecord& record) {
+  auto mappingType = static_cast<Acts::MappingType>(record.mappingType);
+  switch (record.type) {
+    case SurfaceType::Proto:
+      return std::make_shared<Acts::ProtoSurfaceMaterial>(
+          readBinUtility(*file, record.binning), mappingType);
+    case SurfaceType::Homogeneous:
+      return std::make_shared<Acts::HomogeneousSurfaceMaterial>(
+          *file->at<Acts::MaterialSlab>(record.data, 1), record.splitFactor,
+          mappingType);
+    case SurfaceType::Binned: {
+      Acts::BinUtility bu = readBinUtility(*file, record.binning);
+      // the view looks up the slabs through the bin utility, which thus has
+      // to match the stored slab matrix
+      if (record.bins0 == 0 or record.bins1 == 0 or
+          record.bins1 > std::numeric_limits<uint64_t>::max() / record.bins0 or
+          bu.bins(0) != record.bins0 or bu.bins(1) != record.bins1) {
+        throw std::runtime_error("Corrupted binary material map file");
+      }
+      auto* slabs = file->at<Acts::MaterialSlab>(record.data,
+                                                 record.bins0 * record.bins1);
+      return std::make_shared<Acts::BinnedSurfaceMaterialView>(
+          bu, slabs, record.bins0, record.bins1, file, record.splitFactor,
+          mappingType);
+    }
+  }
+  throw std::runtime_error("Unknown surface material type in binary map");
+}
+
+std::shared_ptr<const Acts::IVolumeMaterial> readVolumeMaterial(
+    const MappedFile& file, const VolumeRecord& record) {
+  switch (record.type) {
+    case VolumeType::Proto:
+      return std::make_shared<Acts::ProtoVolumeMaterial>(
+          readBinUtility(file, record.binning));
+    case VolumeType::Homogeneous: {
+      Acts::Material::ParametersVector parameters;
+      std::memcpy(parameters.data(),
+                  file.at<float>(record.data, s_materialParameters),
+                  s_materialParameters * sizeof(float));
+      return std::make_shared<Acts::HomogeneousVolumeMaterial>(
+          Acts::Material(parameters));
+    }
+    case VolumeType::Grid2D: {
+      Acts::BinUtility bu = readBinUtility(file, record.binning);
+      std::function<Acts::Vector2(Acts::Vector3)> transfoGlobalToLocal;
+      Acts::Grid2D grid = Acts::createGrid2D(bu, transfoGlobalToLocal);
+      Acts::Grid2D::point_t min = grid.minPosition();
+      Acts::Grid2D::point_t max = grid.maxPosition();
+      Acts::Grid2D::index_t nBins = grid.numLocalBins();
+      Acts::EAxis axis1(min[0], max[0], nBins[0]);
+      Acts::EAxis axis2(min[1], max[1], nBins[1]);
+      Acts::MaterialGrid2D mGrid(std::make_tuple(axis1, axis2));
+      fillGrid(mGrid,
+               file.at<float>(record.data,
+                              record.nValues * s_materialParameters),
+               record.nValues);
+      Acts::MaterialMapper<Acts::MaterialGrid2D> matMap(transfoGlobalToLocal,
+                                                        std::move(mGrid));
+      return std::make_shared<Acts::InterpolatedMaterialMap<
+          Acts::MaterialMapper<Acts::MaterialGrid2D>>>(std::move(matMap), bu);
+    }
+    case VolumeType::Grid3D: {
+      Acts::BinUtility bu = readBinUtility(file, record.binning);
+      std::function<Acts::Vector3(Acts::Vector3)> transfoGlobalToLocal;
+      Acts::Grid3D grid = Acts::createGrid3D(bu, transfoGlobalToLocal);
+      Acts::Grid3D::point_t min = grid.minPosition();
+      Acts::Grid3D::point_t max = grid.maxPosition();
+      Acts::Grid3D::index_t nBins = grid.numLocalBins();
+      Acts::EAxis axis1(min[0], max[0], nBins[0]);
+      Acts::EAxis axis2(min[1], max[1], nBins[1]);
+      Acts::EAxis axis3(min[2], max[2], nBins[2]);
+      Acts::MaterialGrid3D mGrid(std::make_tuple(axis1, axis2, axis3));
+      fillGrid(mGrid,
+               file.at<float>(record.data,
+                              record.nValues * s_materialParameters),
+               record.nValues);
+      Acts::MaterialMapper<Acts::MaterialGrid3D> matMap(transfoGlobalToLocal,
+                                                        std::move(mGrid));
+      return std::make_shared<Acts::InterpolatedMaterialMap<
+          Acts::MaterialMapper<Acts::MaterialGrid3D>>>(std::move(matMap), bu);
+    }
+  }
+  throw std::runtime_error("Unknown volume material type in binary map");
+}
+
+void collectSurface(const Acts::Surface& surface,
+                    Acts::DetectorMaterialMaps& maps) {
+  if (surface.surfaceMaterialSharedPtr() != nullptr) {
+    maps.first[surface.geometryId()] = surface.surfaceMaterialSharedPtr();
+  }
+}
+
+void collectLayer(const Acts::Layer& layer, Acts::DetectorMaterialMaps& maps) {
+  collectSurface(layer.surfaceRepresentation(), maps);
+  if (layer.approachDescriptor() != nullptr) {
+    const auto& approaches = layer.approachDescriptor()->containedSurfaces();
+    for (const auto* surface : approaches) {
+      collectSurface(*surface, maps);
+    }
+  }
+  if (layer.surfaceArray() != nullptr) {
+    for (const auto* surface : layer.surfaceArray()->surfaces()) {
+      collectSurface(*surface, maps);
+    }
+  }
+}
+
+void collectVolume(const Acts::TrackingVolume& volume,
+                   Acts::DetectorMaterialMaps& maps) {
+  if (volume.volumeMaterialSharedPtr() != nullptr) {
+    maps.second[volume.geometryId()] = volume.volumeMaterialSharedPtr();
+  }
+  if (volume.confinedLayers() != nullptr) {
+    for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+      collectLayer(*layer, maps);
+    }
+  }
+  for (const auto& boundary : volume.boundarySurfaces()) {
+    collectSurface(boundary->surfaceRepresentation(), maps);
+  }
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& subVolume : volume.confinedVolumes()->arrayObjects()) {
+      collectVolume(*subVolume, maps);
+    }
+  }
+}
+
+}  // namespace
+
+void Acts::BinaryMaterialMap::write(const std::string& fileName,
+                                    const DetectorMaterialMaps& maps) {
+  OutputBuffer buffer;
+  FileHeader header;
+  header.nSurfaces = maps.first.size();
+  header.nVolumes = maps.second.size();
+  buffer.append(header);
+
+  // reserve the records, they are filled once the payload offsets are known
+  std::vector<SurfaceRecord> surfaceRecords(maps.first.size());
+  std::vector<VolumeRecord> volumeRecords(maps.second.size());
+  uint64_t surfaceOffset =
+      buffer.append(surfaceRecords.data(), surfaceRecords.size());
+  uint64_t volumeOffset =
+      buffer.append(volumeRecords.data(), volumeRecords.size());
+
+  size_t isurface = 0;
+  for (const auto& [geoId, material] : maps.first) {
+    if (material == nullptr) {
+      throw std::invalid_argument("Missing surface material");
+    }
+    surfaceRecords[isurface] = writeSurfaceMaterial(buffer, *material);
+    surfaceRecords[isurface].geoId = geoId.value();
+    ++isurface;
+  }
+  size_t ivolume = 0;
+  for (const auto& [geoId, material] : maps.second) {
+    if (material == nullptr) {
+      throw std::invalid_argument("Missing volume material");
+    }
+    volumeRecords[ivolume] = writeVolumeMaterial(buffer, *material);
+    volumeRecords[ivolume].geoId = geoId.value();
+    ++ivolume;
+  }
+  for (size_t irecord = 0; irecord < surfaceRecords.size(); ++irecord) {
+    buffer.overwrite(surfaceOffset + irecord * sizeof(SurfaceRecord),
+                     surfaceRecords[irecord]);
+  }
+  for (size_t irecord = 0; irecord < volumeRecords.size(); ++irecord) {
+    buffer.overwrite(volumeOffset + irecord * sizeof(VolumeRecord),
+                     volumeRecords[irecord]);
+  }
+
+  std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+  ofs.write(buffer.bytes().data(), buffer.bytes().size());
+  if (not ofs.good()) {
+    throw std::runtime_error("Unable to write binary material map file " +
+                             fileName);
+  }
+}
+
+Acts::DetectorMaterialMaps Acts::BinaryMaterialMap::read(
+    const std::string& fileName) {
+  auto file = std::make_shared<MappedFile>(fileName);
+
+  auto header = file->get<FileHeader>(0);
+  if (header.magic != s_magic) {
+    throw std::runtime_error(fileName + " is not a binary material map file");
+  }
+  if (header.version != s_version or
+      header.slabSize != sizeof(MaterialSlab)) {
+    throw std::runtime_error("Incompatible binary material map file " +
+                             fileName);
+  }
+
+  uint64_t offset =
+      (sizeof(FileHeader) + s_alignment - 1) / s_alignment * s_alignment;
+  const auto* surfaceRecords =
+      file->at<const SurfaceRecord>(offset, header.nSurfaces);
+  offset += header.nSurfaces * sizeof(SurfaceRecord);
+  offset = (offset + s_alignment - 1) / s_alignment * s_alignment;
+  const auto* volumeRecords =
+      file->at<const VolumeRecord>(offset, header.nVolumes);
+
+  DetectorMaterialMaps maps;
+  for (uint64_t isurface = 0; isurface < header.nSurfaces; ++isurface) {
+    const auto& record = surfaceRecords[isurface];
+    maps.first.emplace_hint(maps.first.end(), GeometryIdentifier(record.geoId),
+                            readSurfaceMaterial(file, record));
+  }
+  for (uint64_t ivolume = 0; ivolume < header.nVolumes; ++ivolume) {
+    const auto& record = volumeRecords[ivolume];
+    maps.second.emplace_hint(maps.second.end(),
+                             GeometryIdentifier(record.geoId),
+                             readVolumeMaterial(*file, record));
+  }
+  return maps;
+}
+
+Acts::DetectorMaterialMaps Acts::BinaryMaterialMap::collect(
+    const TrackingGeometry& tGeometry) {
+  DetectorMaterialMaps maps;
+  if (tGeometry.highestTrackingVolume() != nullptr) {
+    collectVolume(*tGeometry.highestTrackingVolume(), maps);
+  }
+  return maps;
+}
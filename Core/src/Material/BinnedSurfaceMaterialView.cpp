@@ -0,0 +1,61 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/BinnedSurfaceMaterialView.hpp"
+
+#include <ostream>
+#include <utility>
+
+Acts::BinnedSurfaceMaterialView::BinnedSurfaceMaterialView(
+    const BinUtility& binUtility, MaterialSlab* slabs, size_t bins0,
+    size_t bins1, std::shared_ptr<void> storage, double splitFactor,
+    Acts::MappingType mappingType)
+    : ISurfaceMaterial(splitFactor, mappingType),
+      m_binUtility(binUtility),
+      m_slabs(slabs),
+      m_bins0(bins0),
+      m_bins1(bins1),
+      m_storage(std::move(storage)) {}
+
+Acts::BinnedSurfaceMaterialView& Acts::BinnedSurfaceMaterialView::operator*=(
+    double scale) {
+  for (size_t ibin = 0; ibin < m_bins0 * m_bins1; ++ibin) {
+    m_slabs[ibin].scaleThickness(scale);
+  }
+  return (*this);
+}
+
+const Acts::MaterialSlab& Acts::BinnedSurfaceMaterialView::materialSlab(
+    const Vector2& lp) const {
+  size_t ibin0 = m_binUtility.bin(lp, 0);
+  size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(lp, 1) : 0;
+  return materialSlab(ibin0, ibin1);
+}
+
+const Acts::MaterialSlab& Acts::BinnedSurfaceMaterialView::materialSlab(
+    const Vector3& gp) const {
+  size_t ibin0 = m_binUtility.bin(gp, 0);
+  size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
+  return materialSlab(ibin0, ibin1);
+}
+
+std::ostream& Acts::BinnedSurfaceMaterialView::toStream(
+    std::ostream& sl) const {
+  sl << "Acts::BinnedSurfaceMaterialView : " << std::endl;
+  sl << "   - Number of Material bins [0,1] : " << m_bins0 << " / " << m_bins1
+     << std::endl;
+  sl << "   - Parse full update material    : " << std::endl;
+  for (size_t imat1 = 0; imat1 < m_bins1; ++imat1) {
+    for (size_t imat0 = 0; imat0 < m_bins0; ++imat0) {
+      sl << " Bin [" << imat1 << "][" << imat0 << "] - "
+         << materialSlab(imat0, imat1);
+    }
+  }
+  sl << "  - BinUtility: " << m_binUtility << std::endl;
+  return sl;
+}
@@ -0,0 +1,178 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/HelixStepper.hpp"
+
+#include "Acts/EventData/detail/TransformationBoundToFree.hpp"
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
+
+namespace Acts {
+
+Result<std::tuple<BoundTrackParameters, BoundMatrix, double>>
+HelixStepper::boundState(
+    State& state, const Surface& surface, bool transportCov,
+    const FreeToBoundCorrection& freeToBoundCorrection) const {
+  return detail::boundState(
+      state.geoContext, state.cov, state.jacobian, state.jacTransport,
+      state.derivative, state.jacToGlobal, state.pars,
+      state.covTransport and transportCov, state.pathAccumulated, surface,
+      freeToBoundCorrection);
+}
+
+std::tuple<CurvilinearTrackParameters, BoundMatrix, double>
+HelixStepper::curvilinearState(State& state, bool transportCov) const {
+  return detail::curvilinearState(
+      state.cov, state.jacobian, state.jacTransport, state.derivative,
+      state.jacToGlobal, state.pars, state.covTransport and transportCov,
+      state.pathAccumulated);
+}
+
+void HelixStepper::update(State& state, const FreeVector& freeParams,
+                          const BoundVector& boundParams,
+                          const Covariance& covariance,
+                          const Surface& surface) const {
+  state.pars = freeParams;
+  state.cov = covariance;
+  state.jacToGlobal =
+      surface.boundToFreeJacobian(state.geoContext, boundParams);
+}
+
+void HelixStepper::update(State& state, const Vector3& uposition,
+                          const Vector3& udirection, double up,
+                          double time) const {
+  state.pars.template segment<3>(eFreePos0) = uposition;
+  state.pars.template segment<3>(eFreeDir0) = udirection;
+  state.pars[eFreeTime] = time;
+  state.pars[eFreeQOverP] = (state.q != 0. ? state.q / up : 1. / up);
+}
+
+void HelixStepper::transportCovarianceToCurvilinear(State& state) const {
+  detail::transportCovarianceToCurvilinear(
+      state.cov, state.jacobian, state.jacTransport, state.derivative,
+      state.jacToGlobal, state.pars.template segment<3>(eFreeDir0));
+}
+
+void HelixStepper::transportCovarianceToBound(
+    State& state, const Surface& surface,
+    const FreeToBoundCorrection& freeToBoundCorrection) const {
+  detail::transportCovarianceToBound(
+      state.geoContext, state.cov, state.jacobian, state.jacTransport,
+      state.derivative, state.jacToGlobal, state.pars, surface,
+      freeToBoundCorrection);
+}
+
+void HelixStepper::resetState(State& state, const BoundVector& boundParams,
+                              const BoundSymMatrix& cov,
+                              const Surface& surface,
+                              const NavigationDirection navDir,
+                              const double stepSize) const {
+  // Update the stepping state
+  update(state,
+         detail::transformBoundToFreeParameters(surface, state.geoContext,
+                                                boundParams),
+         boundParams, cov, surface);
+  state.navDir = navDir;
+  state.stepSize = ConstrainedStep(stepSize);
+  state.pathAccumulated = 0.;
+  // Re-read the field at the new position with the next step
+  state.fieldValid = false;
+
+  // Reinitialize the stepping jacobian
+  state.jacToGlobal =
+      surface.boundToFreeJacobian(state.geoContext, boundParams);
+  state.jacobian = BoundMatrix::Identity();
+  state.jacTransport = FreeMatrix::Identity();
+  state.derivative = FreeVector::Zero();
+}
+
+void HelixStepper::transport(State& state, double h, double mass) const {
+  const Vector3 dir = direction(state);
+  const double qop = state.pars[eFreeQOverP];
+  const double absQ = (state.q == 0. ? 1. : std::abs(state.q));
+  const double p = absQ / std::abs(qop);
+
+  // The direction rotates around the field axis b with the angular
+  // frequency omega = q/p |B| per unit path length:
+  //
+  //   T(h) = T_par + cos(omega h) T_perp - sin(omega h) b x T
+  //   r(h) = r + h T_par + f1 T_perp - f2 b x T
+  //
+  // with f1 = sin(omega h) / omega and f2 = (1 - cos(omega h)) / omega.
+  // Neutral particles are not deflected.
+  const double bStrength = (state.q == 0.) ? 0. : state.field.norm();
+  const Vector3 b = (0. < bStrength) ? Vector3(state.field / bStrength)
+                                     : Vector3::UnitZ();
+  const double omega = qop * bStrength;
+  const double phi = omega * h;
+  const double cosPhi = std::cos(phi);
+  const double sinPhi = std::sin(phi);
+  // f1, f2 and their derivatives w.r.t. omega; use the series expansion
+  // for small angles to avoid the cancellations
+  double f1 = 0, f2 = 0, df1 = 0, df2 = 0;
+  if (std::abs(phi) < 1e-4) {
+    const double phi2 = phi * phi;
+    f1 = h * (1. - phi2 / 6.);
+    f2 = h * phi / 2. * (1. - phi2 / 12.);
+    df1 = -h * h * phi / 3.;
+    df2 = h * h * (0.5 - phi2 / 8.);
+  } else {
+    f1 = sinPhi / omega;
+    f2 = (1. - cosPhi) / omega;
+    df1 = (h * cosPhi - f1) / omega;
+    df2 = (h * sinPhi - f2) / omega;
+  }
+
+  const Vector3 dirPar = b.dot(dir) * b;
+  const Vector3 dirPerp = dir - dirPar;
+  const Vector3 bCrossDir = b.cross(dir);
+  const Vector3 newDir = dirPar + cosPhi * dirPerp - sinPhi * bCrossDir;
+
+  // time propagates along distance as 1/b = sqrt(1 + m²/p²)
+  const double dtds = std::hypot(1., mass / p);
+
+  state.pars.template segment<3>(eFreePos0) +=
+      h * dirPar + f1 * dirPerp - f2 * bCrossDir;
+  state.pars.template segment<3>(eFreeDir0) = newDir;
+  state.pars[eFreeTime] += h * dtds;
+
+  if (not state.covTransport) {
+    return;
+  }
+
+  // The analytic transport jacobian in global coordinates
+  const ActsSymMatrix<3> bbT = b * b.transpose();
+  const ActsSymMatrix<3> perp = ActsSymMatrix<3>::Identity() - bbT;
+  ActsSymMatrix<3> bCross;
+  // clang-format off
+  bCross << 0.,    -b.z(), b.y(),
+            b.z(), 0.,     -b.x(),
+            -b.y(), b.x(), 0.;
+  // clang-format on
+
+  FreeMatrix D = FreeMatrix::Identity();
+  // position and direction w.r.t. the initial direction
+  D.block<3, 3>(eFreePos0, eFreeDir0) = h * bbT + f1 * perp - f2 * bCross;
+  D.block<3, 3>(eFreeDir0, eFreeDir0) = bbT + cosPhi * perp - sinPhi * bCross;
+  // position and direction w.r.t. q/p via the angular frequency
+  D.block<3, 1>(eFreePos0, eFreeQOverP) =
+      bStrength * (df1 * dirPerp - df2 * bCrossDir);
+  D.block<3, 1>(eFreeDir0, eFreeQOverP) =
+      -bStrength * h * (sinPhi * dirPerp + cosPhi * bCrossDir);
+  // Evaluate dt/dlambda
+  D(eFreeTime, eFreeQOverP) = h * mass * mass * qop / (absQ * absQ * dtds);
+
+  // Update jacobian and derivative
+  state.jacTransport = D * state.jacTransport;
+  state.derivative.template head<3>() = newDir;
+  state.derivative(eFreeTime) = dtds;
+  state.derivative.template segment<3>(eFreeDir0) =
+      -omega * b.cross(newDir);
+  state.derivative(eFreeQOverP) = 0.;
+}
+
+}  // namespace Acts
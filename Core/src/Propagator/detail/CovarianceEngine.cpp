@@ -11,6 +11,7 @@
 #include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
 #include "Acts/EventData/detail/TransformationBoundToFree.hpp"
 #include "Acts/EventData/detail/TransformationFreeToBound.hpp"
+#include "Acts/Propagator/detail/JacobianEngine.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
@@ -24,55 +25,6 @@ using BoundState = std::tuple<BoundTrackParameters, Jacobian, double>;
 using CurvilinearState =
     std::tuple<CurvilinearTrackParameters, Jacobian, double>;
 
-/// @brief Evaluate the projection Jacobian from free to curvilinear parameters
-///
-/// @param [in] direction Normalised direction vector
-///
-/// @return Projection Jacobian
-FreeToBoundMatrix freeToCurvilinearJacobian(const Vector3& direction) {
-  // Optimized trigonometry on the propagation direction
-  const double x = direction(0);  // == cos(phi) * sin(theta)
-  const double y = direction(1);  // == sin(phi) * sin(theta)
-  const double z = direction(2);  // == cos(theta)
-  // can be turned into cosine/sine
-  const double cosTheta = z;
-  const double sinTheta = sqrt(x * x + y * y);
-  const double invSinTheta = 1. / sinTheta;
-  const double cosPhi = x * invSinTheta;
-  const double sinPhi = y * invSinTheta;
-  // prepare the jacobian to curvilinear
-  FreeToBoundMatrix jacToCurv = FreeToBoundMatrix::Zero();
-  if (std::abs(cosTheta) < s_curvilinearProjTolerance) {
-    // We normally operate in curvilinear coordinates defined as follows
-    jacToCurv(0, 0) = -sinPhi;
-    jacToCurv(0, 1) = cosPhi;
-    jacToCurv(1, 0) = -cosPhi * cosTheta;
-    jacToCurv(1, 1) = -sinPhi * cosTheta;
-    jacToCurv(1, 2) = sinTheta;
-  } else {
-    // Under grazing incidence to z, the above coordinate system definition
-    // becomes numerically unstable, and we need to switch to another one
-    const double c = sqrt(y * y + z * z);
-    const double invC = 1. / c;
-    jacToCurv(0, 1) = -z * invC;
-    jacToCurv(0, 2) = y * invC;
-    jacToCurv(1, 0) = c;
-    jacToCurv(1, 1) = -x * y * invC;
-    jacToCurv(1, 2) = -x * z * invC;
-  }
-  // Time parameter
-  jacToCurv(5, 3) = 1.;
-  // Directional and momentum parameters for curvilinear
-  jacToCurv(2, 4) = -sinPhi * invSinTheta;
-  jacToCurv(2, 5) = cosPhi * invSinTheta;
-  jacToCurv(3, 4) = cosPhi * cosTheta;
-  jacToCurv(3, 5) = sinPhi * cosTheta;
-  jacToCurv(3, 6) = -sinTheta;
-  jacToCurv(4, 7) = 1.;
-
-  return jacToCurv;
-}
-
 /// @brief This function calculates the full jacobian from local parameters at
 /// the start surface to bound parameters at the final surface
 ///
@@ -101,21 +53,11 @@ void boundToBoundJacobian(const GeometryContext& geoContext,
                           const FreeVector& freeToPathDerivatives,
                           BoundMatrix& fullTransportJacobian,
                           const Surface& surface) {
-  // Calculate the derivative of path length at the final surface or the
-  // point-of-closest approach w.r.t. free parameters
-  const FreeToPathMatrix freeToPath =
-      surface.freeToPathDerivative(geoContext, freeParameters);
-  // Calculate the jacobian from free to bound at the final surface
-  FreeToBoundMatrix freeToBoundJacobian =
-      surface.freeToBoundJacobian(geoContext, freeParameters);
-  // Calculate the full jacobian from the local/bound parameters at the start
-  // surface to local/bound parameters at the final surface
-  // @note jac(locA->locB) = jac(gloB->locB)*(1+
-  // pathCorrectionFactor(gloB))*jacTransport(gloA->gloB) *jac(locA->gloA)
-  fullTransportJacobian =
-      freeToBoundJacobian *
-      (FreeMatrix::Identity() + freeToPathDerivatives * freeToPath) *
-      freeTransportJacobian * boundToFreeJacobian;
+  // Use the structured kernel of the jacobian engine, which avoids the full
+  // 8x8 free matrix products
+  fullTransportJacobian = detail::boundToBoundTransportJacobian(
+      geoContext, freeParameters, boundToFreeJacobian, freeTransportJacobian,
+      freeToPathDerivatives, surface);
 }
 
 /// @brief This function calculates the full jacobian from local parameters at
@@ -136,31 +78,14 @@ void boundToBoundJacobian(const GeometryContext& geoContext,
 /// parameters
 /// @param [in, out] jacFull The full jacobian from start local to curvilinear
 /// parameters
-///
-/// @note The parameter @p surface is only required if projected to bound
-/// parameters. In the case of curvilinear parameters the geometry and the
-/// position is known and the calculation can be simplified
 void boundToCurvilinearJacobian(const Vector3& direction,
                                 const BoundToFreeMatrix& boundToFreeJacobian,
                                 const FreeMatrix& freeTransportJacobian,
                                 const FreeVector& freeToPathDerivatives,
                                 BoundMatrix& fullTransportJacobian) {
-  // Calculate the jacobian from global to local at the curvilinear surface
-  FreeToBoundMatrix freeToBoundJacobian = freeToCurvilinearJacobian(direction);
-
-  // Update the jacobian to include the derivative of the path length at the
-  // curvilinear surface w.r.t. the free parameters
-  freeToBoundJacobian.topLeftCorner<6, 3>() +=
-      (freeToBoundJacobian * freeToPathDerivatives) *
-      (-1.0 * direction).transpose();
-
-  // Calculate the full jocobian from the local parameters at the start surface
-  // to curvilinear parameters
-  // @note jac(locA->locB) = jac(gloB->locB)*(1+
-  // pathCorrectionFactor(gloB))*jacTransport(gloA->gloB) *jac(locA->gloA)
-  fullTransportJacobian =
-      blockedMult(freeToBoundJacobian,
-                  blockedMult(freeTransportJacobian, boundToFreeJacobian));
+  fullTransportJacobian = detail::boundToCurvilinearTransportJacobian(
+      direction, boundToFreeJacobian, freeTransportJacobian,
+      freeToPathDerivatives);
 }
 
 /// @brief This function reinitialises the state members required for the
@@ -342,7 +267,8 @@ void transportCovarianceToBound(
   bool correction = false;
   if (freeToBoundCorrection) {
     BoundToFreeMatrix startBoundToFinalFreeJacobian =
-        freeTransportJacobian * boundToFreeJacobian;
+        detail::boundToFreeTransportJacobian(boundToFreeJacobian,
+                                             freeTransportJacobian);
     FreeSymMatrix freeCovariance = startBoundToFinalFreeJacobian *
                                    boundCovariance *
                                    startBoundToFinalFreeJacobian.transpose();
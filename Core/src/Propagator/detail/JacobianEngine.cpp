@@ -17,6 +17,36 @@ namespace Acts {
 
 namespace detail {
 
+namespace {
+
+/// @brief Transport the bound-to-free projection with the free transport
+/// jacobian, exploiting the structure of the projection.
+///
+/// For all surfaces the bound time and q/p map one-to-one onto the free time
+/// and q/p, and these rows and columns of the bound-to-free jacobian have no
+/// other entries. The remaining non-trivial part of the product reduces to two
+/// 8x3 times 3x4 multiplications for the position and direction blocks.
+///
+/// @param [in] freeTransportJacobian Transport jacobian free to free
+/// @param [in] boundToFreeJacobian Jacobian from bound to free at start
+///
+/// @return the 8x6 product freeTransportJacobian * boundToFreeJacobian
+BoundToFreeMatrix transportBoundToFree(
+    const FreeMatrix& freeTransportJacobian,
+    const BoundToFreeMatrix& boundToFreeJacobian) {
+  BoundToFreeMatrix result;
+  result.leftCols<4>() =
+      freeTransportJacobian.middleCols<3>(eFreePos0) *
+          boundToFreeJacobian.block<3, 4>(eFreePos0, eBoundLoc0) +
+      freeTransportJacobian.middleCols<3>(eFreeDir0) *
+          boundToFreeJacobian.block<3, 4>(eFreeDir0, eBoundLoc0);
+  result.col(eBoundQOverP) = freeTransportJacobian.col(eFreeQOverP);
+  result.col(eBoundTime) = freeTransportJacobian.col(eFreeTime);
+  return result;
+}
+
+}  // namespace
+
 FreeToBoundMatrix freeToCurvilinearJacobian(const Vector3& direction) {
   auto [cosPhi, sinPhi, cosTheta, sinTheta, invSinTheta] =
       VectorHelpers::evaluateTrigonomics(direction);
@@ -134,28 +164,32 @@ BoundMatrix boundToBoundTransportJacobian(
   // Calculate the jacobian from free to bound at the final surface
   FreeToBoundMatrix freeToBoundJacobian =
       surface.freeToBoundJacobian(geoContext, freeParameters);
+  // Include the path length correction (1 + freeToPathDerivatives *
+  // freeToPath); this is a rank-1 update and can be applied to the 6x8
+  // projection directly instead of building the 8x8 matrix
+  freeToBoundJacobian +=
+      (freeToBoundJacobian * freeToPathDerivatives) * freeToPath;
   // Calculate the full jacobian from the local/bound parameters at the start
   // surface to local/bound parameters at the final surface
   return freeToBoundJacobian *
-         (FreeMatrix::Identity() + freeToPathDerivatives * freeToPath) *
-         freeTransportJacobian * boundToFreeJacobian;
+         transportBoundToFree(freeTransportJacobian, boundToFreeJacobian);
 }
 
 BoundMatrix boundToCurvilinearTransportJacobian(
     const Vector3& direction, const BoundToFreeMatrix& boundToFreeJacobian,
     const FreeMatrix& freeTransportJacobian,
     const FreeVector& freeToPathDerivatives) {
-  // Calculate the derivative of path length at the the curvilinear surface
-  // w.r.t. free parameters
-  FreeToPathMatrix freeToPath = FreeToPathMatrix::Zero();
-  freeToPath.segment<3>(eFreePos0) = -1.0 * direction;
   // Calculate the jacobian from global to local at the curvilinear surface
   FreeToBoundMatrix freeToBoundJacobian = freeToCurvilinearJacobian(direction);
+  // Include the path length correction; the derivative of the path length at
+  // the curvilinear surface w.r.t. the free parameters is -direction for the
+  // position and zero otherwise, i.e. only the position columns change
+  freeToBoundJacobian.leftCols<3>() -=
+      (freeToBoundJacobian * freeToPathDerivatives) * direction.transpose();
   // Calculate the full jacobian from the local parameters at the start surface
   // to curvilinear parameters
   return freeToBoundJacobian *
-         (FreeMatrix::Identity() + freeToPathDerivatives * freeToPath) *
-         freeTransportJacobian * boundToFreeJacobian;
+         transportBoundToFree(freeTransportJacobian, boundToFreeJacobian);
 }
 
 BoundToFreeMatrix boundToFreeTransportJacobian(
@@ -163,7 +197,7 @@ BoundToFreeMatrix boundToFreeTransportJacobian(
     const FreeMatrix& freeTransportJacobian) {
   // Calculate the full jacobian, in this case simple a product of
   // jacobian(transport in free) * jacobian(bound to free)
-  return (freeTransportJacobian * boundToFreeJacobian);
+  return transportBoundToFree(freeTransportJacobian, boundToFreeJacobian);
 }
 
 FreeToBoundMatrix freeToBoundTransportJacobian(
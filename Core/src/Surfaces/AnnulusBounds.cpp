@@ -168,6 +168,51 @@ bool Acts::AnnulusBounds::inside(const Vector2& lposition, double tolR,
   return true;
 }
 
+void Acts::AnnulusBounds::insideBatch(
+    const BoundaryCheck::LocalPositions& lpositions,
+    const BoundaryCheck& bcheck, BoundaryCheck::InsideMask& inside) const {
+  const bool absolute = (bcheck.type() == BoundaryCheck::Type::eAbsolute);
+  const double tolR = absolute ? bcheck.tolerance()[eBoundLoc0] : 0.;
+  const double tolPhi = absolute ? bcheck.tolerance()[eBoundLoc1] : 0.;
+
+  // same as the single position check w/ tolerances, but for all positions
+  // locpo is PC in STRIP SYSTEM
+  // need to perform internal rotation induced by average phi
+  BoundaryCheck::LocalPositions rotated =
+      lpositions * m_rotationStripPC.linear().transpose();
+  rotated.rowwise() += m_rotationStripPC.translation().transpose();
+  const auto rLoc = rotated.col(eBoundLoc0).array();
+  const auto phiLoc = rotated.col(eBoundLoc1).array();
+
+  inside = !((phiLoc < (get(eMinPhiRel) - tolPhi)) ||
+             (phiLoc > (get(eMaxPhiRel) + tolPhi)));
+
+  // calculate R in MODULE SYSTEM to evaluate R-bounds
+  const Eigen::ArrayXd r_mod2 =
+      m_shiftPC[eBoundLoc0] * m_shiftPC[eBoundLoc0] + rLoc * rLoc +
+      2 * m_shiftPC[eBoundLoc0] * rLoc * (phiLoc - m_shiftPC[eBoundLoc1]).cos();
+  if (tolR == 0.) {
+    // don't need R, can use R^2
+    inside = inside && !((r_mod2 < get(eMinR) * get(eMinR)) ||
+                         (r_mod2 > get(eMaxR) * get(eMaxR)));
+  } else {
+    // use R
+    const Eigen::ArrayXd r_mod = r_mod2.sqrt();
+    inside = inside &&
+             !((r_mod < (get(eMinR) - tolR)) || (r_mod > (get(eMaxR) + tolR)));
+  }
+
+  if (not absolute) {
+    // the covariance based check is only needed for the positions that are
+    // outside w/o tolerances
+    for (Eigen::Index i = 0; i < lpositions.rows(); ++i) {
+      if (not inside[i]) {
+        inside[i] = this->inside(lpositions.row(i).transpose(), bcheck);
+      }
+    }
+  }
+}
+
 bool Acts::AnnulusBounds::inside(const Vector2& lposition,
                                  const BoundaryCheck& bcheck) const {
   // locpo is PC in STRIP SYSTEM
@@ -46,6 +46,12 @@ bool Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::inside(
   return bcheck.isInside(lposition, m_vertices);
 }
 
+void Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::insideBatch(
+    const BoundaryCheck::LocalPositions& lpositions,
+    const BoundaryCheck& bcheck, BoundaryCheck::InsideMask& inside) const {
+  bcheck.isInside(lpositions, m_vertices, inside);
+}
+
 std::vector<Acts::Vector2> Acts::ConvexPolygonBounds<
     Acts::PolygonDynamic>::vertices(unsigned int /*lseg*/) const {
   return {m_vertices.begin(), m_vertices.end()};
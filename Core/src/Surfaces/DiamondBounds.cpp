@@ -22,6 +22,12 @@ bool Acts::DiamondBounds::inside(const Acts::Vector2& lposition,
   return bcheck.isInside(lposition, vertices());
 }
 
+void Acts::DiamondBounds::insideBatch(
+    const BoundaryCheck::LocalPositions& lpositions,
+    const BoundaryCheck& bcheck, BoundaryCheck::InsideMask& inside) const {
+  bcheck.isInside(lpositions, vertices(), inside);
+}
+
 std::vector<Acts::Vector2> Acts::DiamondBounds::vertices(
     unsigned int /*lseg*/) const {
   // Vertices starting at lower left (min rel. phi)
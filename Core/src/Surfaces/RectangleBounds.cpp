@@ -19,6 +19,12 @@ bool Acts::RectangleBounds::inside(const Acts::Vector2& lposition,
   return bcheck.isInside(lposition, m_min, m_max);
 }
 
+void Acts::RectangleBounds::insideBatch(
+    const BoundaryCheck::LocalPositions& lpositions,
+    const BoundaryCheck& bcheck, BoundaryCheck::InsideMask& inside) const {
+  bcheck.isInside(lpositions, m_min, m_max, inside);
+}
+
 std::vector<Acts::Vector2> Acts::RectangleBounds::vertices(
     unsigned int /*lseg*/) const {
   // counter-clockwise starting from bottom-left corner
@@ -54,6 +54,31 @@ bool Acts::TrapezoidBounds::inside(const Acts::Vector2& lposition,
   return bcheck.isInside(lposition, v);
 }
 
+void Acts::TrapezoidBounds::insideBatch(
+    const BoundaryCheck::LocalPositions& lpositions,
+    const BoundaryCheck& bcheck, BoundaryCheck::InsideMask& inside) const {
+  const double hlY = get(TrapezoidBounds::eHalfLengthY);
+  const double hlXnY = get(TrapezoidBounds::eHalfLengthXnegY);
+  const double hlXpY = get(TrapezoidBounds::eHalfLengthXposY);
+
+  std::array<Vector2, 4> v{
+      Vector2{-hlXnY, -hlY}, {hlXnY, -hlY}, {hlXpY, hlY}, {-hlXpY, hlY}};
+  bcheck.isInside(lpositions, v, inside);
+
+  if (bcheck.type() == BoundaryCheck::Type::eAbsolute) {
+    // apply the same shortcuts as the single position check
+    const double tolX = bcheck.tolerance()[eBoundLoc0];
+    const double tolY = bcheck.tolerance()[eBoundLoc1];
+    const auto absX = lpositions.col(0).array().abs();
+    const auto absY = lpositions.col(1).array().abs();
+    const BoundaryCheck::InsideMask outside =
+        ((absY - hlY) > tolY) || ((absX - std::max(hlXnY, hlXpY)) > tolX);
+    const BoundaryCheck::InsideMask insideX =
+        (absX - std::min(hlXnY, hlXpY)) <= tolX;
+    inside = !outside && (insideX || inside);
+  }
+}
+
 std::vector<Acts::Vector2> Acts::TrapezoidBounds::vertices(
     unsigned int /*lseg*/) const {
   double minhx = get(TrapezoidBounds::eHalfLengthXnegY);
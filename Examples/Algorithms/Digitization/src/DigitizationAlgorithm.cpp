@@ -107,6 +107,8 @@ ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
   }
 
   m_digitizers = Acts::GeometryHierarchyMap<Digitizer>(digitizerInput);
+  // digitizers are looked up for every module with hits in every event
+  m_digitizers.compile(*m_cfg.trackingGeometry);
 }
 
 ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
@@ -128,9 +130,6 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   measurementParticlesMap.reserve(simHits.size());
   measurementSimHitsMap.reserve(simHits.size());
 
-  // Setup random number generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-
   ACTS_DEBUG("Starting loop over modules ...");
   for (auto simHitsGroup : groupByModule(simHits)) {
     // Manual pair unpacking instead of using
@@ -159,6 +158,9 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
       ACTS_DEBUG("Digitizer found for module " << moduleGeoId);
     }
 
+    // Module-local random numbers do not depend on the module processing order
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx, moduleGeoId.value());
+
     // Run the digitizer. Iterate over the hits for this surface inside the
     // visitor so we do not need to lookup the variant object per-hit.
     std::visit(
@@ -233,8 +235,7 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
             // be added at the end.
             sourceLinks.insert(sourceLinks.end(), sourceLink);
 
-            measurements.emplace_back(
-                createMeasurement(dParameters, sourceLink));
+            measurements.push_back(createMeasurement(dParameters, sourceLink));
             clusters.emplace_back(std::move(dParameters.cluster));
             // this digitization does hit merging so there can be more than one
             // mapping entry for each digitized hit.
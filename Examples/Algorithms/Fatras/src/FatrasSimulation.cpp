@@ -29,6 +29,8 @@
 #include "ActsFatras/Selectors/SelectorHelpers.hpp"
 #include "ActsFatras/Selectors/SurfaceSelectors.hpp"
 
+#include <array>
+
 namespace {
 
 /// Simple struct to select surfaces where hits should be generated.
@@ -51,12 +53,13 @@ struct HitSurfaceSelector {
 
 }  // namespace
 
-// Same interface as `ActsFatras::Simulation` but with concrete types.
+// Same interface as `ActsFatras::Simulation` but with concrete types and for
+// a single input particle including its secondaries.
 struct ActsExamples::detail::FatrasSimulation {
   virtual ~FatrasSimulation() = default;
   virtual Acts::Result<std::vector<ActsFatras::FailedParticle>> simulate(
       const Acts::GeometryContext &, const Acts::MagneticFieldContext &,
-      ActsExamples::RandomEngine &, const ActsExamples::SimParticleContainer &,
+      ActsExamples::RandomEngine &, const ActsExamples::SimParticle &,
       ActsExamples::SimParticleContainer::sequence_type &,
       ActsExamples::SimParticleContainer::sequence_type &,
       ActsExamples::SimHitContainer::sequence_type &) const = 0;
@@ -146,12 +149,14 @@ struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
   Acts::Result<std::vector<ActsFatras::FailedParticle>> simulate(
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, ActsExamples::RandomEngine &rng,
-      const ActsExamples::SimParticleContainer &inputParticles,
+      const ActsExamples::SimParticle &inputParticle,
       ActsExamples::SimParticleContainer::sequence_type
           &simulatedParticlesInitial,
       ActsExamples::SimParticleContainer::sequence_type
           &simulatedParticlesFinal,
       ActsExamples::SimHitContainer::sequence_type &simHits) const final {
+    const std::array<ActsExamples::SimParticle, 1> inputParticles = {
+        inputParticle};
     return simulation.simulate(geoCtx, magCtx, rng, inputParticles,
                                simulatedParticlesInitial,
                                simulatedParticlesFinal, simHits);
@@ -208,24 +213,29 @@ ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
   simHitsUnordered.reserve(inputParticles.size() *
                            m_cfg.averageHitsPerParticle);
 
-  // run the simulation w/ a local random generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             inputParticles, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
-  // fatal error leads to panic
-  if (not ret.ok()) {
-    ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
-                        << ret.error());
-    return ProcessCode::ABORT;
-  }
-  // failed particles are just logged. assumes that failed particles are due
-  // to edge-cases representing a tiny fraction of the event; not due to a
-  // fundamental issue.
-  for (const auto &failed : ret.value()) {
-    ACTS_ERROR("event " << ctx.eventNumber << " particle " << failed.particle
-                        << " failed to simulate with error " << failed.error
-                        << ": " << failed.error.message());
+  // run the simulation w/ a local random generator for each input particle.
+  // secondaries use the generator of their primary particle. the results are
+  // thus independent of the order in which the input particles are simulated.
+  for (const auto &inputParticle : inputParticles) {
+    auto rng = m_cfg.randomNumbers->spawnGenerator(
+        ctx, inputParticle.particleId().value());
+    auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                               inputParticle, particlesInitialUnordered,
+                               particlesFinalUnordered, simHitsUnordered);
+    // fatal error leads to panic
+    if (not ret.ok()) {
+      ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
+                          << ret.error());
+      return ProcessCode::ABORT;
+    }
+    // failed particles are just logged. assumes that failed particles are due
+    // to edge-cases representing a tiny fraction of the event; not due to a
+    // fundamental issue.
+    for (const auto &failed : ret.value()) {
+      ACTS_ERROR("event " << ctx.eventNumber << " particle " << failed.particle
+                          << " failed to simulate with error " << failed.error
+                          << ": " << failed.error.message());
+    }
   }
 
   ACTS_DEBUG(particlesInitialUnordered.size()
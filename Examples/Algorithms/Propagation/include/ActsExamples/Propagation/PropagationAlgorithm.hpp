@@ -19,6 +19,7 @@
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/detail/CompactSteppingLogger.hpp"
 #include "Acts/Propagator/detail/SteppingLogger.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/Helpers.hpp"
@@ -46,8 +47,15 @@ using RecordedMaterialTrack =
     std::pair<std::pair<Acts::Vector3, Acts::Vector3>, RecordedMaterial>;
 
 /// Finally the output of the propagation test
-using PropagationOutput =
-    std::pair<std::vector<Acts::detail::Step>, RecordedMaterial>;
+/// Output of a single test propagation
+struct PropagationOutput {
+  /// The full steps, filled in the default step recording mode
+  std::vector<Acts::detail::Step> steps;
+  /// The compact steps, filled in the compact step recording mode
+  Acts::detail::CompactSteps compactSteps;
+  /// The recorded material
+  RecordedMaterial material;
+};
 
 /// @brief this test algorithm performs test propagation
 /// within the Acts::Propagator
@@ -66,6 +74,13 @@ class PropagationAlgorithm : public BareAlgorithm {
     int mode = 0;
     /// Switch the logger to sterile
     bool sterileLogger = false;
+    /// Record compact steps instead of full steps. The step collection then
+    /// contains `std::vector<Acts::detail::CompactSteps>`.
+    bool compactStepRecording = false;
+    /// Compact mode only: record every n-th step that is not on a surface
+    size_t stepSampling = 1;
+    /// Compact mode only: maximum number of recorded steps per track
+    size_t maxStepsPerTrack = std::numeric_limits<size_t>::max();
     /// debug output
     bool debugOutput = false;
     /// Modify the behavior of the material interaction: energy loss
@@ -11,6 +11,8 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Propagation/PropagationAlgorithm.hpp"
 
+#include <type_traits>
+
 namespace ActsExamples {
 
 ///@brief Propagator wrapper
@@ -96,57 +98,83 @@ class ConcretePropagator : public PropagatorInterface {
 
     // This is the outside in mode
     if (cfg.mode == 0) {
-      // The step length logger for testing & end of world aborter
-      using MaterialInteractor = Acts::MaterialInteractor;
-      using SteppingLogger = Acts::detail::SteppingLogger;
-      using EndOfWorld = Acts::EndOfWorldReached;
-
-      // Action list and abort list
-      using ActionList = Acts::ActionList<SteppingLogger, MaterialInteractor>;
-      using AbortList = Acts::AbortList<EndOfWorld>;
-      using PropagatorOptions =
-          Acts::DenseStepperPropagatorOptions<ActionList, AbortList>;
-
-      PropagatorOptions options(context.geoContext, context.magFieldContext,
-                                Acts::LoggerWrapper{logger()});
-      options.pathLimit = pathLength;
-
-      // Activate loop protection at some pt value
-      options.loopProtection =
-          (startParameters.transverseMomentum() < cfg.ptLoopers);
-
-      // Switch the material interaction on/off & eventually into logging mode
-      auto& mInteractor = options.actionList.get<MaterialInteractor>();
-      mInteractor.multipleScattering = cfg.multipleScattering;
-      mInteractor.energyLoss = cfg.energyLoss;
-      mInteractor.recordInteractions = cfg.recordMaterialInteractions;
-
-      // Switch the logger to sterile, e.g. for timing checks
-      auto& sLogger = options.actionList.get<SteppingLogger>();
-      sLogger.sterile = cfg.sterileLogger;
-      // Set a maximum step size
-      options.maxStepSize = cfg.maxStepSize;
-
-      // Propagate using the propagator
-      auto result = m_propagator.propagate(startParameters, options);
-      if (result.ok()) {
-        const auto& resultValue = result.value();
-        auto steppingResults =
-            resultValue.template get<SteppingLogger::result_type>();
-
-        // Set the stepping result
-        pOutput.first = std::move(steppingResults.steps);
-        // Also set the material recording result - if configured
-        if (cfg.recordMaterialInteractions) {
-          auto materialResult =
-              resultValue.template get<MaterialInteractor::result_type>();
-          pOutput.second = std::move(materialResult);
-        }
+      if (cfg.compactStepRecording) {
+        executeWithLogger<Acts::detail::CompactSteppingLogger>(
+            context, cfg, logger, startParameters, pathLength, pOutput);
+      } else {
+        executeWithLogger<Acts::detail::SteppingLogger>(
+            context, cfg, logger, startParameters, pathLength, pOutput);
       }
     }
     return pOutput;
   }
 
+  /// Propagate with the given step logger
+  /// @param [out] pOutput is the propagation output to be filled
+  template <typename stepping_logger_t, typename parameters_t>
+  void executeWithLogger(const AlgorithmContext& context,
+                         const PropagationAlgorithm::Config& cfg,
+                         Acts::LoggerWrapper logger,
+                         const parameters_t& startParameters,
+                         double pathLength, PropagationOutput& pOutput) const {
+    // The step length logger for testing & end of world aborter
+    using MaterialInteractor = Acts::MaterialInteractor;
+    using SteppingLogger = stepping_logger_t;
+    using EndOfWorld = Acts::EndOfWorldReached;
+
+    // Action list and abort list
+    using ActionList = Acts::ActionList<SteppingLogger, MaterialInteractor>;
+    using AbortList = Acts::AbortList<EndOfWorld>;
+    using PropagatorOptions =
+        Acts::DenseStepperPropagatorOptions<ActionList, AbortList>;
+
+    PropagatorOptions options(context.geoContext, context.magFieldContext,
+                              Acts::LoggerWrapper{logger()});
+    options.pathLimit = pathLength;
+
+    // Activate loop protection at some pt value
+    options.loopProtection =
+        (startParameters.transverseMomentum() < cfg.ptLoopers);
+
+    // Switch the material interaction on/off & eventually into logging mode
+    auto& mInteractor = options.actionList.template get<MaterialInteractor>();
+    mInteractor.multipleScattering = cfg.multipleScattering;
+    mInteractor.energyLoss = cfg.energyLoss;
+    mInteractor.recordInteractions = cfg.recordMaterialInteractions;
+
+    // Switch the logger to sterile, e.g. for timing checks
+    auto& sLogger = options.actionList.template get<SteppingLogger>();
+    sLogger.sterile = cfg.sterileLogger;
+    if constexpr (std::is_same_v<SteppingLogger,
+                                 Acts::detail::CompactSteppingLogger>) {
+      sLogger.sampling = cfg.stepSampling;
+      sLogger.maxSteps = cfg.maxStepsPerTrack;
+    }
+    // Set a maximum step size
+    options.maxStepSize = cfg.maxStepSize;
+
+    // Propagate using the propagator
+    auto result = m_propagator.propagate(startParameters, options);
+    if (result.ok()) {
+      auto& resultValue = result.value();
+      auto& steppingResults =
+          resultValue.template get<typename SteppingLogger::result_type>();
+
+      // Set the stepping result
+      if constexpr (std::is_same_v<SteppingLogger,
+                                   Acts::detail::CompactSteppingLogger>) {
+        pOutput.compactSteps = std::move(steppingResults);
+      } else {
+        pOutput.steps = std::move(steppingResults.steps);
+      }
+      // Also set the material recording result - if configured
+      if (cfg.recordMaterialInteractions) {
+        pOutput.material = std::move(
+            resultValue.template get<MaterialInteractor::result_type>());
+      }
+    }
+  }
+
  private:
   propagator_t m_propagator;
 };
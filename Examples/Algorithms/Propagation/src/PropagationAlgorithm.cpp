@@ -34,9 +34,14 @@ ProcessCode PropagationAlgorithm::execute(
       Acts::Surface::makeShared<Acts::PerigeeSurface>(
           Acts::Vector3(0., 0., 0.));
 
-  // Output : the propagation steps
+  // Output : the propagation steps, either full or compact
   std::vector<std::vector<Acts::detail::Step>> propagationSteps;
-  propagationSteps.reserve(m_cfg.ntests);
+  std::vector<Acts::detail::CompactSteps> compactPropagationSteps;
+  if (m_cfg.compactStepRecording) {
+    compactPropagationSteps.reserve(m_cfg.ntests);
+  } else {
+    propagationSteps.reserve(m_cfg.ntests);
+  }
 
   // Output (optional): the recorded material
   std::unordered_map<size_t, Acts::RecordedMaterialTrack> recordedMaterial;
@@ -85,9 +90,13 @@ ProcessCode PropagationAlgorithm::execute(
           context, m_cfg, Acts::LoggerWrapper{logger()}, neutralParameters);
     }
     // Record the propagator steps
-    propagationSteps.push_back(std::move(pOutput.first));
+    if (m_cfg.compactStepRecording) {
+      compactPropagationSteps.push_back(std::move(pOutput.compactSteps));
+    } else {
+      propagationSteps.push_back(std::move(pOutput.steps));
+    }
     if (m_cfg.recordMaterialInteractions &&
-        !pOutput.second.materialInteractions.empty()) {
+        !pOutput.material.materialInteractions.empty()) {
       // Create a recorded material track
       RecordedMaterialTrack rmTrack;
       // Start position
@@ -95,15 +104,20 @@ ProcessCode PropagationAlgorithm::execute(
       // Start momentum
       rmTrack.first.second = std::move(sMomentum);
       // The material
-      rmTrack.second = std::move(pOutput.second);
+      rmTrack.second = std::move(pOutput.material);
       // push it it
       recordedMaterial[it] = (std::move(rmTrack));
     }
   }
 
   // Write the propagation step data to the event store
-  context.eventStore.add(m_cfg.propagationStepCollection,
-                         std::move(propagationSteps));
+  if (m_cfg.compactStepRecording) {
+    context.eventStore.add(m_cfg.propagationStepCollection,
+                           std::move(compactPropagationSteps));
+  } else {
+    context.eventStore.add(m_cfg.propagationStepCollection,
+                           std::move(propagationSteps));
+  }
 
   // Write the recorded material to the event store
   if (m_cfg.recordMaterialInteractions) {
@@ -146,6 +160,9 @@ PropagationAlgorithm::PropagationAlgorithm(
   if (!m_cfg.randomNumberSvc) {
     throw std::invalid_argument("No random number generator given");
   }
+  if (m_cfg.compactStepRecording and m_cfg.stepSampling == 0) {
+    throw std::invalid_argument("Step sampling must be at least one");
+  }
 }
 
 }  // namespace ActsExamples
\ No newline at end of file
@@ -116,8 +116,8 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
         // are transformed to the bound space where we do know their location.
         // if the local parameters are not measured, this results in a
         // zero location, which is a reasonable default fall-back.
-        auto [localPos, localCov] = std::visit(
-            [](const auto& meas) {
+        auto [localPos, localCov] =
+            measurements[sourceLink.get().index()].visit([](const auto& meas) {
               auto expander = meas.expander();
               Acts::BoundVector par = expander * meas.parameters();
               Acts::BoundSymMatrix cov =
@@ -128,8 +128,7 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
               Acts::SymMatrix2 lcov =
                   cov.block<2, 2>(Acts::eBoundLoc0, Acts::eBoundLoc0);
               return std::make_pair(lpar, lcov);
-            },
-            measurements[sourceLink.get().index()]);
+            });
 
         // transform local position to global coordinates
         Acts::Vector3 globalFakeMom(1, 1, 1);
@@ -37,10 +37,6 @@ ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
   TrackParametersContainer parameters;
   parameters.reserve(particles.size());
 
-  // setup random number generator and standard gaussian
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  std::normal_distribution<double> stdNormal(0.0, 1.0);
-
   for (auto&& [vtxId, vtxParticles] : groupBySecondaryVertex(particles)) {
     // a group contains at least one particle by construction. assume that all
     // particles within the group originate from the same position and use it to
@@ -49,6 +45,11 @@ ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
         vtxParticles.begin()->position());
 
     for (const auto& particle : vtxParticles) {
+      // particle-local random number generator and standard gaussian
+      auto rng = m_cfg.randomNumbers->spawnGenerator(
+          ctx, particle.particleId().value());
+      std::normal_distribution<double> stdNormal(0.0, 1.0);
+
       const auto time = particle.time();
       const auto phi = Acts::VectorHelpers::phi(particle.unitDirection());
       const auto theta = Acts::VectorHelpers::theta(particle.unitDirection());
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/BinaryBFieldMap.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
@@ -29,6 +30,12 @@ using InterpolatedMagneticField3 =
         Acts::Vector3, Acts::detail::EquidistantAxis,
         Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>;
 
+using CompactMagneticField2 =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldGridRZ>;
+
+using CompactMagneticField3 =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldGridXYZ>;
+
 }  // namespace detail
 
 }  // namespace ActsExamples
@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/BinaryBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -46,8 +47,9 @@ void ActsExamples::Options::addMagneticFieldOptions(Description& desc) {
       "Scaling factor for the event-dependent field strength scaling. A unit "
       "value means that the field strength stays the same for every event.");
   opt("bf-map-file", value<std::string>(),
-      "Read a magnetic field map from the given file. ROOT and text file "
-      "formats are supported. Only used if no constant field is given.");
+      "Read a magnetic field map from the given file. ROOT, text and binary "
+      "(.actsbf) file formats are supported. Only used if no constant field is "
+      "given.");
   opt("bf-map-tree", value<std::string>()->default_value("bField"),
       "Name of the TTree in the ROOT file. Only used if the field map is read "
       "from a ROOT file.");
@@ -67,6 +69,12 @@ void ActsExamples::Options::addMagneticFieldOptions(Description& desc) {
       "option only needs to be set if the field value unit in the field map "
       "file is not `Tesla`. The value must scale from the stored unit to the "
       "equvalent value in `Tesla`.");
+  opt("bf-map-write-binary", value<std::string>(),
+      "Write the field map read from a ROOT or text file into the given binary "
+      "field map file. Binary field maps are stored in single precision and "
+      "are memory-mapped read-only, i.e. shared by all processes on a node. "
+      "The octant and scale options are applied before writing and are "
+      "ignored when reading a binary field map.");
   opt("bf-solenoid-mag-tesla", value<double>()->default_value(0.),
       "The magnitude of a solenoid magnetic field in the center in `Tesla`. "
       "Only used "
@@ -134,10 +142,18 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
     const auto fieldUnit =
         vars["bf-map-fieldscale-tesla"].as<double>() * Acts::UnitConstants::T;
 
+    const auto binaryFile = vars.count("bf-map-write-binary") != 0u
+                                ? vars["bf-map-write-binary"].as<std::string>()
+                                : std::string();
+
     bool readRoot = false;
+    bool readBinary = false;
     if (file.extension() == ".root") {
       ACTS_INFO("Read magnetic field map from ROOT file '" << file << "'");
       readRoot = true;
+    } else if (file.extension() == ".actsbf") {
+      ACTS_INFO("Read magnetic field map from binary file '" << file << "'");
+      readBinary = true;
     } else if (file.extension() == ".txt") {
       ACTS_INFO("Read magnetic field map from text file '" << file << "'");
       readRoot = false;
@@ -154,18 +170,23 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
       };
 
       ACTS_INFO("Use XYZ field map");
-      if (readRoot) {
-        auto map = makeMagneticFieldMapXyzFromRoot(
-            std::move(mapBins), file.native(), tree, lengthUnit, fieldUnit,
-            useOctantOnly);
-        return std::make_shared<InterpolatedMagneticField3>(std::move(map));
-
-      } else {
-        auto map = makeMagneticFieldMapXyzFromText(std::move(mapBins),
-                                                   file.native(), lengthUnit,
-                                                   fieldUnit, useOctantOnly);
-        return std::make_shared<InterpolatedMagneticField3>(std::move(map));
+      if (readBinary) {
+        return std::make_shared<CompactMagneticField3>(
+            Acts::BinaryBFieldMap::readXYZ(file.native()));
+      }
+
+      auto map = readRoot
+                     ? makeMagneticFieldMapXyzFromRoot(
+                           std::move(mapBins), file.native(), tree,
+                           lengthUnit, fieldUnit, useOctantOnly)
+                     : makeMagneticFieldMapXyzFromText(
+                           std::move(mapBins), file.native(), lengthUnit,
+                           fieldUnit, useOctantOnly);
+      if (not binaryFile.empty()) {
+        ACTS_INFO("Write binary magnetic field map '" << binaryFile << "'");
+        Acts::BinaryBFieldMap::write(binaryFile, map.getGrid());
       }
+      return std::make_shared<InterpolatedMagneticField3>(std::move(map));
 
     } else if (type == "rz") {
       auto mapBins = [](std::array<size_t, 2> bins,
@@ -174,18 +195,23 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
       };
 
       ACTS_INFO("Use RZ field map");
-      if (readRoot) {
-        auto map = makeMagneticFieldMapRzFromRoot(
-            std::move(mapBins), file.native(), tree, lengthUnit, fieldUnit,
-            useOctantOnly);
-        return std::make_shared<InterpolatedMagneticField2>(std::move(map));
-
-      } else {
-        auto map = makeMagneticFieldMapRzFromText(std::move(mapBins),
-                                                  file.native(), lengthUnit,
-                                                  fieldUnit, useOctantOnly);
-        return std::make_shared<InterpolatedMagneticField2>(std::move(map));
+      if (readBinary) {
+        return std::make_shared<CompactMagneticField2>(
+            Acts::BinaryBFieldMap::readRZ(file.native()));
+      }
+
+      auto map = readRoot
+                     ? makeMagneticFieldMapRzFromRoot(
+                           std::move(mapBins), file.native(), tree,
+                           lengthUnit, fieldUnit, useOctantOnly)
+                     : makeMagneticFieldMapRzFromText(
+                           std::move(mapBins), file.native(), lengthUnit,
+                           fieldUnit, useOctantOnly);
+      if (not binaryFile.empty()) {
+        ACTS_INFO("Write binary magnetic field map '" << binaryFile << "'");
+        Acts::BinaryBFieldMap::write(binaryFile, map.getGrid());
       }
+      return std::make_shared<InterpolatedMagneticField2>(std::move(map));
 
     } else {
       ACTS_ERROR("'" << type << "' is an unknown magnetic field map type");
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2020 CERN for the benefit of the Acts project
+// Copyright (C) 2020-2022 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,24 +8,264 @@
 
 #pragma once
 
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <variant>
 #include <vector>
 
 namespace ActsExamples {
 
 /// Variable measurement type that can contain all possible combinations.
 using Measurement = ::Acts::BoundVariantMeasurement;
+
+class MeasurementContainer;
+
+/// Read-only proxy for a single measurement stored in the container.
+///
+/// The proxy only references the container and is cheap to copy. It must not
+/// be used after the container was modified.
+class ConstMeasurementProxy {
+ public:
+  using Scalar = Acts::ActsScalar;
+  using ParametersMap = Eigen::Map<const Acts::ActsDynamicVector>;
+  using CovarianceMap = Eigen::Map<const Acts::ActsDynamicMatrix>;
+
+  ConstMeasurementProxy(const MeasurementContainer& container, Index index)
+      : m_container(&container), m_index(index) {}
+
+  /// Index of the measurement in the container.
+  Index index() const { return m_index; }
+  /// Number of measured bound parameters.
+  size_t size() const;
+  const Acts::SourceLink& sourceLink() const;
+  /// Check if the given bound parameter is measured.
+  bool contains(Acts::BoundIndices i) const;
+  /// Measured parameters in the order of the bound indices.
+  ParametersMap parameters() const;
+  CovarianceMap covariance() const;
+
+  /// Construct the equivalent fixed-size measurement.
+  ///
+  /// @tparam kSize Measurement size; must be identical to `size()`
+  template <size_t kSize>
+  Acts::Measurement<Acts::BoundIndices, kSize> fixedSize() const;
+
+  /// Call the visitor with the equivalent fixed-size measurement.
+  ///
+  /// This replaces `std::visit` on the variant measurement type. As for the
+  /// variant, the visitor must have the same return type for all sizes.
+  template <typename visitor_t>
+  auto visit(visitor_t&& visitor) const;
+
+ private:
+  const MeasurementContainer* m_container;
+  Index m_index;
+};
+
 /// Container of measurements.
 ///
 /// In contrast to the source links, the measurements themself must not be
 /// orderable. The source links stored in the measurements are treated
 /// as opaque here and no ordering is enforced on the stored measurements.
-using MeasurementContainer = std::vector<Measurement>;
+///
+/// Measurements of different sizes are stored back-to-back in shared parameter
+/// and covariance pools, i.e. each measurement only occupies the storage for
+/// its actual size. The measured subspace is stored as a bitset of the bound
+/// indices. Individual measurements are accessed via proxy objects.
+class MeasurementContainer {
+ public:
+  using value_type = ConstMeasurementProxy;
+  using size_type = size_t;
+
+  /// Iterator over the measurement proxies.
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ConstMeasurementProxy;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = ConstMeasurementProxy;
+
+    const_iterator(const MeasurementContainer& container, Index index)
+        : m_container(&container), m_index(index) {}
+
+    ConstMeasurementProxy operator*() const { return {*m_container, m_index}; }
+    const_iterator& operator++() {
+      ++m_index;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      auto tmp = *this;
+      ++m_index;
+      return tmp;
+    }
+    bool operator==(const const_iterator& other) const {
+      return (m_container == other.m_container) and (m_index == other.m_index);
+    }
+    bool operator!=(const const_iterator& other) const {
+      return not(*this == other);
+    }
+
+   private:
+    const MeasurementContainer* m_container;
+    Index m_index;
+  };
+
+  size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+
+  /// Reserve storage for the given number of measurements.
+  ///
+  /// @param n Number of measurements
+  /// @param averageSize Expected average number of measured parameters
+  void reserve(size_t n, size_t averageSize = 2u) {
+    m_entries.reserve(n);
+    m_parameters.reserve(n * averageSize);
+    m_covariances.reserve(n * averageSize * averageSize);
+  }
+
+  void clear() {
+    m_entries.clear();
+    m_parameters.clear();
+    m_covariances.clear();
+  }
+
+  /// Add a fixed-size measurement at the end of the container.
+  ///
+  /// @note Only a reference to the source link is stored. It must outlive the
+  ///       container as for the fixed-size measurement itself.
+  template <size_t kSize>
+  void push_back(const Acts::Measurement<Acts::BoundIndices, kSize>& meas) {
+    Entry entry;
+    entry.sourceLink = &meas.sourceLink();
+    entry.parametersOffset = static_cast<uint32_t>(m_parameters.size());
+    entry.covarianceOffset = static_cast<uint32_t>(m_covariances.size());
+    entry.size = static_cast<uint8_t>(kSize);
+    entry.subspace = 0u;
+    for (uint8_t i = 0u; i < Acts::eBoundSize; ++i) {
+      if (meas.contains(static_cast<Acts::BoundIndices>(i))) {
+        entry.subspace |= (1u << i);
+      }
+    }
+    const auto* par = meas.parameters().data();
+    const auto* cov = meas.covariance().data();
+    m_parameters.insert(m_parameters.end(), par, par + kSize);
+    m_covariances.insert(m_covariances.end(), cov, cov + kSize * kSize);
+    m_entries.push_back(entry);
+  }
+  /// Add a variable measurement at the end of the container.
+  void push_back(const Measurement& meas) {
+    std::visit([this](const auto& m) { push_back(m); }, meas);
+  }
+
+  ConstMeasurementProxy operator[](Index i) const {
+    assert((i < size()) and "Measurement index is outside the container");
+    return {*this, i};
+  }
+  ConstMeasurementProxy at(Index i) const {
+    if (size() <= i) {
+      throw std::out_of_range("Measurement index is outside the container");
+    }
+    return {*this, i};
+  }
+
+  const_iterator begin() const { return {*this, 0u}; }
+  const_iterator end() const {
+    return {*this, static_cast<Index>(m_entries.size())};
+  }
+
+ private:
+  struct Entry {
+    const Acts::SourceLink* sourceLink = nullptr;
+    uint32_t parametersOffset = 0u;
+    uint32_t covarianceOffset = 0u;
+    uint8_t size = 0u;
+    // bit i is set if bound parameter i is measured
+    uint8_t subspace = 0u;
+  };
+
+  static_assert(Acts::eBoundSize <= 8u, "Subspace bitset is too small");
+
+  std::vector<Entry> m_entries;
+  std::vector<Acts::ActsScalar> m_parameters;
+  std::vector<Acts::ActsScalar> m_covariances;
+
+  friend class ConstMeasurementProxy;
+};
+
+inline size_t ConstMeasurementProxy::size() const {
+  return m_container->m_entries[m_index].size;
+}
+
+inline const Acts::SourceLink& ConstMeasurementProxy::sourceLink() const {
+  return *m_container->m_entries[m_index].sourceLink;
+}
+
+inline bool ConstMeasurementProxy::contains(Acts::BoundIndices i) const {
+  return (m_container->m_entries[m_index].subspace >> i) & 1u;
+}
+
+inline ConstMeasurementProxy::ParametersMap ConstMeasurementProxy::parameters()
+    const {
+  const auto& entry = m_container->m_entries[m_index];
+  return {m_container->m_parameters.data() + entry.parametersOffset,
+          entry.size};
+}
+
+inline ConstMeasurementProxy::CovarianceMap ConstMeasurementProxy::covariance()
+    const {
+  const auto& entry = m_container->m_entries[m_index];
+  return {m_container->m_covariances.data() + entry.covarianceOffset,
+          entry.size, entry.size};
+}
+
+template <size_t kSize>
+inline Acts::Measurement<Acts::BoundIndices, kSize>
+ConstMeasurementProxy::fixedSize() const {
+  const auto& entry = m_container->m_entries[m_index];
+  assert((entry.size == kSize) and "Inconsistent measurement size");
+
+  std::array<Acts::BoundIndices, kSize> indices = {};
+  for (uint8_t i = 0u, j = 0u; i < Acts::eBoundSize; ++i) {
+    if ((entry.subspace >> i) & 1u) {
+      indices[j++] = static_cast<Acts::BoundIndices>(i);
+    }
+  }
+  Eigen::Map<const Acts::ActsVector<kSize>> par(
+      m_container->m_parameters.data() + entry.parametersOffset);
+  Eigen::Map<const Acts::ActsSymMatrix<kSize>> cov(
+      m_container->m_covariances.data() + entry.covarianceOffset);
+  return {*entry.sourceLink, indices, par, cov};
+}
+
+namespace detail {
+template <size_t kSize>
+struct VisitMeasurementProxy {
+  template <typename visitor_t>
+  static auto invoke(const ConstMeasurementProxy& proxy, visitor_t&& visitor) {
+    return visitor(proxy.fixedSize<kSize>());
+  }
+};
+}  // namespace detail
+
+template <typename visitor_t>
+inline auto ConstMeasurementProxy::visit(visitor_t&& visitor) const {
+  return Acts::template_switch<detail::VisitMeasurementProxy, 1,
+                               Acts::eBoundSize>(
+      size(), *this, std::forward<visitor_t>(visitor));
+}
 
 /// Calibrator to convert an index source link to a measurement.
 class MeasurementCalibrator {
@@ -49,9 +289,8 @@ class MeasurementCalibrator {
            "Undefined measurement container in DigitizedCalibrator");
     assert((sourceLink.index() < m_measurements->size()) and
            "Source link index is outside the container bounds");
-    std::visit(
-        [&trackState](const auto& meas) { trackState.setCalibrated(meas); },
-        (*m_measurements)[sourceLink.index()]);
+    (*m_measurements)[sourceLink.index()].visit(
+        [&trackState](const auto& meas) { trackState.setCalibrated(meas); });
   }
 
  private:
@@ -0,0 +1,275 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+class RandomNumbers;
+
+/// Marks types that only hold fixed-size values and can be stored bytewise.
+///
+/// Trivially copyable types are supported automatically. The event data types
+/// built from Eigen fixed-size vectors are not trivially copyable, but contain
+/// neither pointers nor references and are explicitly marked below.
+template <typename T>
+struct IsCheckpointPlainData : std::is_trivially_copyable<T> {};
+template <>
+struct IsCheckpointPlainData<SimHit> : std::true_type {};
+template <>
+struct IsCheckpointPlainData<SimParticle> : std::true_type {};
+template <>
+struct IsCheckpointPlainData<SimSpacePoint> : std::true_type {};
+
+/// Explicit type tag of a collection stored in an event checkpoint.
+///
+/// The tag is part of the checkpoint key. In contrast to `typeid(T).name()`
+/// it does not depend on the compiler and must be provided for every stored
+/// collection type.
+template <typename T>
+struct CheckpointTypeTag;
+template <>
+struct CheckpointTypeTag<SimHitContainer> {
+  static constexpr const char* value = "SimHitContainer";
+};
+template <>
+struct CheckpointTypeTag<SimParticleContainer> {
+  static constexpr const char* value = "SimParticleContainer";
+};
+template <>
+struct CheckpointTypeTag<SimSpacePointContainer> {
+  static constexpr const char* value = "SimSpacePointContainer";
+};
+template <>
+struct CheckpointTypeTag<ProtoTrackContainer> {
+  static constexpr const char* value = "ProtoTrackContainer";
+};
+template <>
+struct CheckpointTypeTag<IndexMultimap<ActsFatras::Barcode>> {
+  static constexpr const char* value = "IndexMultimap<Barcode>";
+};
+template <>
+struct CheckpointTypeTag<IndexMultimap<Index>> {
+  static constexpr const char* value = "IndexMultimap<Index>";
+};
+
+/// Binary encoding of a value stored in an event checkpoint.
+///
+/// Specializations provide `write(std::ostream&, const T&)` and
+/// `T read(std::istream&)`. Plain data, pairs, and containers thereof are
+/// supported. Types that reference other objects can not be restored without
+/// the referenced objects; the measurements and their source links are thus
+/// stored together via `EventCheckpoint::addMeasurements`.
+template <typename T, typename = void>
+struct CheckpointCodec;
+
+namespace detail {
+
+// containers that can be filled by inserting values at the end
+template <typename T>
+using InsertAtEnd = decltype(std::declval<T&>().insert(
+    std::declval<T&>().end(), std::declval<typename T::value_type>()));
+
+template <typename T, typename = void>
+struct IsCheckpointContainer : std::false_type {};
+template <typename T>
+struct IsCheckpointContainer<T, std::void_t<InsertAtEnd<T>>>
+    : std::true_type {};
+
+inline void checkStream(const std::istream& is) {
+  if (not is) {
+    throw std::runtime_error("Truncated or corrupt event checkpoint");
+  }
+}
+
+}  // namespace detail
+
+template <typename T>
+struct CheckpointCodec<T, std::enable_if_t<IsCheckpointPlainData<T>::value>> {
+  static void write(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  static T read(std::istream& is) {
+    alignas(T) char buffer[sizeof(T)];
+    is.read(buffer, sizeof(T));
+    detail::checkStream(is);
+    return *reinterpret_cast<const T*>(buffer);
+  }
+};
+
+template <typename first_t, typename second_t>
+struct CheckpointCodec<std::pair<first_t, second_t>> {
+  using Value = std::pair<std::remove_const_t<first_t>, second_t>;
+
+  static void write(std::ostream& os,
+                    const std::pair<first_t, second_t>& value) {
+    CheckpointCodec<std::remove_const_t<first_t>>::write(os, value.first);
+    CheckpointCodec<second_t>::write(os, value.second);
+  }
+  static Value read(std::istream& is) {
+    auto first = CheckpointCodec<std::remove_const_t<first_t>>::read(is);
+    auto second = CheckpointCodec<second_t>::read(is);
+    return Value(std::move(first), std::move(second));
+  }
+};
+
+template <typename T>
+struct CheckpointCodec<
+    T, std::enable_if_t<detail::IsCheckpointContainer<T>::value and
+                        not IsCheckpointPlainData<T>::value>> {
+  using Element = CheckpointCodec<typename T::value_type>;
+
+  static void write(std::ostream& os, const T& container) {
+    CheckpointCodec<uint64_t>::write(os, container.size());
+    for (const auto& value : container) {
+      Element::write(os, value);
+    }
+  }
+  static T read(std::istream& is) {
+    uint64_t size = CheckpointCodec<uint64_t>::read(is);
+    T container;
+    // containers are written in iteration order, i.e. sorted containers can
+    // be filled with amortized constant-time insertions at the end
+    for (uint64_t i = 0; i < size; ++i) {
+      container.insert(container.end(), Element::read(is));
+    }
+    return container;
+  }
+};
+
+/// Store selected event store collections after an algorithm.
+///
+/// The sequencer stores the registered collections of each event after the
+/// configured algorithm has been executed. Later runs restore them and skip
+/// all readers and algorithms up to and including the configured one. The
+/// checkpoints are placed in a sub-directory named after a hash of the
+/// upstream readers and algorithms, the registered collections and their
+/// type tags, the random seed, and the user-provided fingerprint. Changing
+/// any of them thus results in a new set of checkpoints instead of reusing
+/// outdated ones.
+///
+/// The algorithm configurations can not be hashed generically and are not
+/// part of the hash. The fingerprint is therefore required and must identify
+/// the upstream configuration, e.g. by including the relevant configuration
+/// parameters.
+class EventCheckpoint {
+ public:
+  struct Config {
+    /// Name of the algorithm after which the collections are stored.
+    std::string algorithm;
+    /// Base directory for the checkpoints.
+    std::string directory = "checkpoints";
+    /// Identifier of the upstream configuration; must not be empty.
+    std::string fingerprint;
+    /// Optional random numbers service whose seed is part of the key.
+    std::shared_ptr<const RandomNumbers> randomNumbers = nullptr;
+  };
+
+  EventCheckpoint(const Config& cfg, Acts::Logging::Level lvl);
+
+  /// Register a collection to be stored in the checkpoints.
+  ///
+  /// @tparam T Collection type; requires a `CheckpointCodec<T>`
+  /// @param name Name of the collection in the event store
+  template <typename T>
+  void addCollection(const std::string& name);
+
+  /// Register measurements and their source links to be stored.
+  ///
+  /// The measurements reference their source links and both are thus stored
+  /// and restored together. The source links must be index source links, one
+  /// per measurement, as created by the digitization. The restored source
+  /// links are owned by the `<sourceLinks>__storage` collection.
+  ///
+  /// @param measurements Name of the measurements in the event store
+  /// @param sourceLinks Name of the source links in the event store
+  void addMeasurements(const std::string& measurements,
+                       const std::string& sourceLinks);
+
+  /// Compute the checkpoint key and prepare the checkpoint directory.
+  ///
+  /// @param upstream Names of everything executed up to the algorithm
+  void initialize(const std::vector<std::string>& upstream);
+
+  /// Restore the collections of the event if a checkpoint exists.
+  ///
+  /// @return true if the event was restored
+  /// @throws std::runtime_error on a corrupt checkpoint
+  bool restore(const AlgorithmContext& ctx) const;
+
+  /// Store the collections of the event.
+  void store(const AlgorithmContext& ctx) const;
+
+  /// Hexadecimal checkpoint key; only available after initialization.
+  const std::string& key() const { return m_key; }
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  // type-erased encoding of one event store collection
+  struct ICollection {
+    std::string name;
+    std::string typeTag;
+
+    ICollection(std::string n, std::string t)
+        : name(std::move(n)), typeTag(std::move(t)) {}
+    virtual ~ICollection() = default;
+    virtual void write(const WhiteBoard& store, std::ostream& os) const = 0;
+    virtual void read(std::istream& is, WhiteBoard& store) const = 0;
+  };
+  template <typename T>
+  struct CollectionT : public ICollection {
+    CollectionT(std::string n)
+        : ICollection(std::move(n), CheckpointTypeTag<T>::value) {}
+    void write(const WhiteBoard& store, std::ostream& os) const override {
+      CheckpointCodec<T>::write(os, store.get<T>(name));
+    }
+    void read(std::istream& is, WhiteBoard& store) const override {
+      store.add(name, CheckpointCodec<T>::read(is));
+    }
+  };
+  struct MeasurementsCollection;
+
+  void add(std::unique_ptr<ICollection> collection);
+
+  Config m_cfg;
+  std::vector<std::unique_ptr<ICollection>> m_collections;
+  std::string m_key;
+  std::string m_path;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
+
+template <typename T>
+inline void ActsExamples::EventCheckpoint::addCollection(
+    const std::string& name) {
+  add(std::make_unique<CollectionT<T>>(name));
+}
@@ -0,0 +1,130 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ActsExamples {
+
+/// Counter-based Philox4x32-10 random number engine.
+///
+/// The output is a pure function of a 64bit key and a 128bit counter, see
+/// Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11. The
+/// upper half of the counter selects an independent stream for a given key and
+/// the lower half enumerates the output blocks within that stream. Contrary to
+/// e.g. the Mersenne Twister, there is no expensive state initialization and
+/// arbitrary many streams can be created on the fly in any order.
+///
+/// Satisfies the `RandomNumberEngine` requirements apart from text
+/// (de-)serialization and can be used with the standard distributions.
+class PhiloxEngine {
+ public:
+  using result_type = uint32_t;
+
+  static constexpr uint64_t default_seed = 0u;
+
+  static constexpr result_type min() { return 0u; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  PhiloxEngine() : PhiloxEngine(default_seed) {}
+  /// Construct the engine for the given key and stream.
+  explicit PhiloxEngine(uint64_t key, uint64_t stream = 0u) {
+    seed(key, stream);
+  }
+
+  /// Reset the engine to the beginning of the given key and stream.
+  void seed(uint64_t key = default_seed, uint64_t stream = 0u) {
+    m_key = {lo(key), hi(key)};
+    m_counter = {0u, 0u, lo(stream), hi(stream)};
+    m_index = kBlockSize;
+  }
+
+  result_type operator()() {
+    if (m_index == kBlockSize) {
+      refill();
+    }
+    return m_block[m_index++];
+  }
+
+  /// Advance the engine by n outputs in constant time.
+  void discard(unsigned long long n) {
+    const unsigned long long buffered = kBlockSize - m_index;
+    if (n <= buffered) {
+      m_index += n;
+      return;
+    }
+    n -= buffered;
+    advanceCounter(n / kBlockSize);
+    m_index = kBlockSize;
+    if ((n % kBlockSize) != 0u) {
+      refill();
+      m_index = n % kBlockSize;
+    }
+  }
+
+  /// Compute a single output block for the given counter and key.
+  static std::array<uint32_t, 4> block(std::array<uint32_t, 4> ctr,
+                                       std::array<uint32_t, 2> key) {
+    for (unsigned i = 0; i < kRounds; ++i) {
+      const uint64_t p0 = static_cast<uint64_t>(kMul0) * ctr[0];
+      const uint64_t p1 = static_cast<uint64_t>(kMul1) * ctr[2];
+      ctr = {hi(p1) ^ ctr[1] ^ key[0], lo(p1), hi(p0) ^ ctr[3] ^ key[1],
+             lo(p0)};
+      key[0] += kWeyl0;
+      key[1] += kWeyl1;
+    }
+    return ctr;
+  }
+
+  friend bool operator==(const PhiloxEngine& lhs, const PhiloxEngine& rhs) {
+    // the block buffer is fully determined by key and counter
+    return (lhs.m_key == rhs.m_key) and (lhs.m_counter == rhs.m_counter) and
+           (lhs.m_index == rhs.m_index);
+  }
+  friend bool operator!=(const PhiloxEngine& lhs, const PhiloxEngine& rhs) {
+    return not(lhs == rhs);
+  }
+
+ private:
+  static constexpr unsigned kBlockSize = 4u;
+  static constexpr unsigned kRounds = 10u;
+  static constexpr uint32_t kMul0 = 0xD2511F53u;
+  static constexpr uint32_t kMul1 = 0xCD9E8D57u;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+
+  static constexpr uint32_t lo(uint64_t x) { return static_cast<uint32_t>(x); }
+  static constexpr uint32_t hi(uint64_t x) {
+    return static_cast<uint32_t>(x >> 32);
+  }
+
+  void refill() {
+    m_block = block(m_counter, m_key);
+    advanceCounter(1u);
+    m_index = 0u;
+  }
+  /// Only the lower half of the counter is advanced to stay within the stream.
+  void advanceCounter(uint64_t n) {
+    const uint64_t c = (static_cast<uint64_t>(m_counter[1]) << 32) +
+                       static_cast<uint64_t>(m_counter[0]) + n;
+    m_counter[0] = lo(c);
+    m_counter[1] = hi(c);
+  }
+
+  std::array<uint32_t, 2> m_key = {};
+  std::array<uint32_t, 4> m_counter = {};
+  std::array<uint32_t, 4> m_block = {};
+  unsigned m_index = kBlockSize;
+};
+
+}  // namespace ActsExamples
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/PhiloxEngine.hpp"
 
 #include <cstdint>
 #include <random>
@@ -24,7 +25,7 @@
 namespace ActsExamples {
 
 /// The random number generator used in the framework.
-using RandomEngine = std::mt19937;  ///< Mersenne Twister
+using RandomEngine = PhiloxEngine;  ///< counter-based, cheap to construct
 
 /// Provide event and algorithm specific random number generator.s
 ///
@@ -32,6 +33,12 @@ using RandomEngine = std::mt19937;  ///< Mersenne Twister
 /// thread-safe, lock-free, and reproducible random number generation across
 /// single-threaded and multi-threaded test framework runs.
 ///
+/// Each (algorithm, event) pair selects a separate key of the counter-based
+/// engine. In addition, algorithms can request independent generators for
+/// sub-entities, e.g. particles or detector modules. The random numbers for a
+/// sub-entity then only depend on its identifier and not on the processing
+/// order, which allows parallel processing within an event.
+///
 /// The role of the RandomNumbers is only to spawn local random number
 /// generators. It does not, in and of itself, accomodate requests for specific
 /// random number distributions (uniform, gaussian, etc). For this purpose,
@@ -45,21 +52,37 @@ class RandomNumbers {
 
   RandomNumbers(const Config& cfg);
 
-  /// Spawn an algorithm-local random number generator. To avoid inefficiencies
-  /// and multiple uses of a given RNG seed, this should only be done once per
-  /// Algorithm invocation, after what the generator object should be reused.
+  /// Spawn an algorithm-local random number generator. Repeated calls return
+  /// identical generators. To avoid multiple uses of the same random numbers,
+  /// this should only be done once per Algorithm invocation, after what the
+  /// generator object should be reused.
   ///
   /// It calls generateSeed() for an event driven seed
   ///
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn a random number generator for a sub-entity within the algorithm,
+  /// e.g. a particle or a detector module.
+  ///
+  /// Generators for different sub-entity identifiers are independent. The
+  /// construction is cheap and can be done in the inner loop.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param subId is a unique, non-zero identifier of the sub-entity
+  /// @note Identifier zero is equivalent to the algorithm-local generator.
+  RandomEngine spawnGenerator(const AlgorithmContext& context,
+                              uint64_t subId) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
   /// random engine is used and `spawnGenerator` can not be used.
   uint64_t generateSeed(const AlgorithmContext& context) const;
 
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
  private:
   Config m_cfg;
 };
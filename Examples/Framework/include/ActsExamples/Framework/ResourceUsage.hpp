@@ -0,0 +1,71 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+
+namespace ActsExamples {
+
+/// Resource usage counters at one point in time.
+///
+/// The allocation and hardware counters are accumulated for the calling
+/// thread only; work that an algorithm hands off to other threads is not
+/// included. The peak resident set size is a process-wide high-water mark.
+/// Unavailable counters are set to -1.
+struct ResourceUsage {
+  /// Number of calls to the global `operator new`
+  int64_t allocations = -1;
+  /// Number of bytes requested from the global `operator new`
+  int64_t allocatedBytes = -1;
+  /// Peak resident set size of the process in bytes
+  int64_t peakRss = -1;
+  /// Hardware counters of the calling thread (Linux perf events only)
+  int64_t cycles = -1;
+  int64_t instructions = -1;
+  int64_t cacheMisses = -1;
+
+  /// Difference between two measurements; unavailable counters stay -1.
+  ResourceUsage operator-(const ResourceUsage& start) const;
+};
+
+/// Allocation counts of the calling thread.
+struct AllocationCounts {
+  int64_t allocations = 0;
+  int64_t bytes = 0;
+};
+
+/// Function returning the allocation counts of the calling thread.
+using AllocationCounter = AllocationCounts (*)();
+
+/// Install the source of the allocation counts.
+///
+/// Replacing the global `operator new` is only reliable in executables, and
+/// not for code loaded at runtime, e.g. the Python module. The replacement is
+/// therefore provided by the separate `ActsExamplesFrameworkAllocationCounting`
+/// object library, which installs its counter on startup. It is linked into
+/// the example executables if `ACTS_ENABLE_ALLOCATION_COUNTING` is set.
+void setAllocationCounter(AllocationCounter counter);
+
+/// Check whether the allocation hooks are active in the running program.
+///
+/// Requires the allocation counting hooks to be linked into the program. Even
+/// then, the replacement can be shadowed, e.g. by other libraries that also
+/// replace the global `operator new`.
+bool allocationTrackingAvailable();
+
+/// Read the current resource usage.
+///
+/// @param hardwareCounters also read the hardware counters
+///
+/// The hardware counters of each thread are set up on first use. If this
+/// fails, e.g. because access to perf events is restricted, they are
+/// reported as unavailable.
+ResourceUsage currentResourceUsage(bool hardwareCounters);
+
+}  // namespace ActsExamples
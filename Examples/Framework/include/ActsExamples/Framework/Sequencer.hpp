@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/EventCheckpoint.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/IReader.hpp"
@@ -48,6 +49,11 @@ class Sequencer {
     std::string outputDir;
     /// output name of the timing file
     std::string outputTimingFile = "timing.tsv";
+    /// record allocations, peak memory increase, and hardware counters for
+    /// each algorithm and event
+    bool enableProfiling = false;
+    /// output name of the per-event profiling file
+    std::string outputProfileFile = "profile.csv";
     /// Callback that is invoked in the event loop.
     /// @warning This function can be called from multiple threads and should therefore be thread-safe
     IterationCallback iterationCallback = []() {};
@@ -75,6 +81,13 @@ class Sequencer {
   ///
   /// @throws std::invalid_argument if the writer is NULL.
   void addWriter(std::shared_ptr<IWriter> writer);
+  /// Set the checkpoint to store and restore events after an algorithm.
+  ///
+  /// Events with an existing checkpoint are restored from it and skip all
+  /// readers and algorithms up to and including the checkpoint algorithm.
+  ///
+  /// @throws std::invalid_argument if the checkpoint is NULL or already set.
+  void addCheckpoint(std::shared_ptr<EventCheckpoint> checkpoint);
 
   /// Run the event loop.
   ///
@@ -120,6 +133,7 @@ class Sequencer {
   std::vector<std::shared_ptr<IReader>> m_readers;
   std::vector<std::shared_ptr<IAlgorithm>> m_algorithms;
   std::vector<std::shared_ptr<IWriter>> m_writers;
+  std::shared_ptr<EventCheckpoint> m_checkpoint;
   std::unique_ptr<const Acts::Logger> m_logger;
 
   const Acts::Logger& logger() const { return *m_logger; }
@@ -0,0 +1,120 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
+#include "ActsExamples/Validation/TrackClassification.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Per-event truth association between hits and particles.
+///
+/// All particles are identified by a dense index. The particles of the input
+/// particle container come first in container order, i.e. the dense index of
+/// a particle in the container is identical to its position in the container.
+/// Particles that only appear in the hit-particles map follow afterwards.
+/// Per-particle quantities can thus be stored in plain vectors instead of
+/// maps keyed by the barcode.
+///
+/// The hit-to-particles association is stored as compressed sparse rows and
+/// the barcode-to-index lookup uses a flat open-addressing hash table. The
+/// index is intended to be built once per event and shared by all truth
+/// matching done for that event.
+///
+/// @note The track classification uses internal scratch space. The index must
+///       not be used concurrently from multiple threads.
+class TruthMatchingIndex {
+ public:
+  using ParticleIndex = uint32_t;
+  using ParticleIndexRange = Range<const ParticleIndex*>;
+
+  /// Marker for barcodes without a particle.
+  static constexpr ParticleIndex kInvalidParticle =
+      std::numeric_limits<ParticleIndex>::max();
+
+  /// Build the index for one event.
+  ///
+  /// @param particles The truth particles of the event
+  /// @param hitParticlesMap Map hit indices to contributing particles
+  TruthMatchingIndex(const SimParticleContainer& particles,
+                     const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap);
+
+  /// Number of known particles, including the ones not in the container.
+  size_t numParticles() const { return m_particleIds.size(); }
+  /// Number of hits covered by the hit-particles map.
+  size_t numHits() const { return m_hitOffsets.size() - 1u; }
+
+  /// Barcode of the particle with the given dense index.
+  ActsFatras::Barcode particleId(ParticleIndex particle) const {
+    return m_particleIds[particle];
+  }
+  /// Dense index of the particle or `kInvalidParticle` if it is unknown.
+  ParticleIndex particleIndex(ActsFatras::Barcode particleId) const;
+  /// Check if the particle with the given dense index is in the container.
+  bool isInContainer(ParticleIndex particle) const {
+    return particle < m_numContainerParticles;
+  }
+
+  /// Dense indices of all particles that contribute to the hit.
+  ParticleIndexRange hitParticles(Index hit) const {
+    if (numHits() <= hit) {
+      return {nullptr, nullptr};
+    }
+    const ParticleIndex* data = m_hitParticles.data();
+    return {data + m_hitOffsets[hit], data + m_hitOffsets[hit + 1]};
+  }
+  /// Number of hits the particle with the given dense index contributed to.
+  size_t numParticleHits(ParticleIndex particle) const {
+    return m_particleNumHits[particle];
+  }
+
+  /// Identify all particles that contribute to the proto track.
+  ///
+  /// Equivalent to the free `identifyContributingParticles` function.
+  void identifyContributingParticles(
+      const ProtoTrack& protoTrack,
+      std::vector<ParticleHitCount>& particleHitCounts) const;
+
+  /// Identify all particles that contribute to a trajectory.
+  ///
+  /// Equivalent to the free `identifyContributingParticles` function.
+  void identifyContributingParticles(
+      const Trajectories& trajectories, size_t trajectoryTip,
+      std::vector<ParticleHitCount>& particleHitCounts) const;
+
+ private:
+  void increaseHitCounts(Index hit) const;
+  void collectHitCounts(std::vector<ParticleHitCount>& particleHitCounts) const;
+
+  // dense particle index -> barcode
+  std::vector<ActsFatras::Barcode> m_particleIds;
+  size_t m_numContainerParticles = 0;
+  // flat hash table barcode -> dense particle index w/ power-of-two size
+  std::vector<ParticleIndex> m_lookup;
+  // hit -> dense particle indices as compressed sparse rows
+  std::vector<uint32_t> m_hitOffsets;
+  std::vector<ParticleIndex> m_hitParticles;
+  // dense particle index -> number of hits
+  std::vector<uint32_t> m_particleNumHits;
+  // scratch space for the track classification
+  mutable std::vector<uint32_t> m_counts;
+  mutable std::vector<ParticleIndex> m_touched;
+};
+
+}  // namespace ActsExamples
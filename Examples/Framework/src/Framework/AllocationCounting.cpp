@@ -0,0 +1,65 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Replacement of the global operator new that counts the allocations of each
+// thread. This is compiled into a separate object library and only linked into
+// executables that request it, see `ACTS_ENABLE_ALLOCATION_COUNTING`.
+
+#include "ActsExamples/Framework/ResourceUsage.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// plain thread-local counters; they need no construction and can be used
+// at any time, including during static initialization and thread teardown
+thread_local int64_t tAllocations = 0;
+thread_local int64_t tAllocatedBytes = 0;
+
+void* allocate(std::size_t size, std::size_t alignment) {
+  tAllocations += 1;
+  tAllocatedBytes += size;
+  size = (size == 0) ? 1 : size;
+  while (true) {
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+      ptr = std::malloc(size);
+    } else if (posix_memalign(&ptr, alignment, size) != 0) {
+      ptr = nullptr;
+    }
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+ActsExamples::AllocationCounts allocationCounts() {
+  return {tAllocations, tAllocatedBytes};
+}
+
+// install the counter in the framework on startup
+struct Registration {
+  Registration() { ActsExamples::setAllocationCounter(&allocationCounts); }
+} s_registration;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
@@ -0,0 +1,280 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/EventCheckpoint.hpp"
+
+#include "Acts/Utilities/Helpers.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <sstream>
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S', 'C', 'K', 'P', 'T'};
+constexpr uint32_t kVersion = 2;
+
+// 64bit FNV-1a hash that is stable across platforms and standard libraries
+struct Fnv1a {
+  uint64_t value = 0xcbf29ce484222325u;
+
+  Fnv1a& add(const std::string& text) {
+    for (char c : text) {
+      value ^= static_cast<unsigned char>(c);
+      value *= 0x100000001b3u;
+    }
+    // terminate each string so that the concatenation is unambiguous
+    value ^= 0xffu;
+    value *= 0x100000001b3u;
+    return *this;
+  }
+};
+
+void writeString(std::ostream& os, const std::string& text) {
+  ActsExamples::CheckpointCodec<std::string>::write(os, text);
+}
+
+std::string readString(std::istream& is) {
+  return ActsExamples::CheckpointCodec<std::string>::read(is);
+}
+
+// restore a fixed-size measurement from its subspace and stored values
+template <size_t kSize>
+struct AddMeasurement {
+  static void invoke(ActsExamples::MeasurementContainer& measurements,
+                     const ActsExamples::IndexSourceLink& sourceLink,
+                     uint8_t subspace,
+                     const std::vector<Acts::ActsScalar>& values) {
+    std::array<Acts::BoundIndices, kSize> indices = {};
+    for (uint8_t i = 0u, j = 0u; i < Acts::eBoundSize; ++i) {
+      if ((subspace >> i) & 1u) {
+        indices[j++] = static_cast<Acts::BoundIndices>(i);
+      }
+    }
+    Eigen::Map<const Acts::ActsVector<kSize>> par(values.data());
+    Eigen::Map<const Acts::ActsSymMatrix<kSize>> cov(values.data() + kSize);
+    measurements.push_back(Acts::Measurement<Acts::BoundIndices, kSize>(
+        sourceLink, indices, par, cov));
+  }
+};
+
+}  // namespace
+
+struct ActsExamples::EventCheckpoint::MeasurementsCollection final
+    : public ICollection {
+  std::string sourceLinks;
+
+  MeasurementsCollection(std::string measurements, std::string sl)
+      : ICollection(std::move(measurements),
+                    "MeasurementContainer+IndexSourceLinkContainer:" + sl),
+        sourceLinks(std::move(sl)) {}
+
+  void write(const WhiteBoard& store, std::ostream& os) const override {
+    const auto& measurements = store.get<MeasurementContainer>(name);
+    if (store.get<IndexSourceLinkContainer>(sourceLinks).size() !=
+        measurements.size()) {
+      throw std::runtime_error("Checkpoint requires one source link per "
+                               "measurement in '" +
+                               sourceLinks + "'");
+    }
+
+    CheckpointCodec<uint64_t>::write(os, measurements.size());
+    for (const auto& meas : measurements) {
+      const auto& sourceLink =
+          static_cast<const IndexSourceLink&>(meas.sourceLink());
+      CheckpointCodec<uint64_t>::write(os, sourceLink.geometryId().value());
+      CheckpointCodec<Index>::write(os, sourceLink.index());
+      uint8_t subspace = 0u;
+      for (uint8_t i = 0u; i < Acts::eBoundSize; ++i) {
+        if (meas.contains(static_cast<Acts::BoundIndices>(i))) {
+          subspace |= (1u << i);
+        }
+      }
+      CheckpointCodec<uint8_t>::write(os, subspace);
+      const auto par = meas.parameters();
+      const auto cov = meas.covariance();
+      os.write(reinterpret_cast<const char*>(par.data()),
+               par.size() * sizeof(Acts::ActsScalar));
+      os.write(reinterpret_cast<const char*>(cov.data()),
+               cov.size() * sizeof(Acts::ActsScalar));
+    }
+  }
+
+  void read(std::istream& is, WhiteBoard& store) const override {
+    uint64_t size = CheckpointCodec<uint64_t>::read(is);
+    // the list keeps the source links at fixed addresses
+    std::list<IndexSourceLink> storage;
+    IndexSourceLinkContainer restoredSourceLinks;
+    MeasurementContainer measurements;
+    restoredSourceLinks.reserve(size);
+    measurements.reserve(size);
+
+    std::vector<Acts::ActsScalar> values;
+    for (uint64_t i = 0; i < size; ++i) {
+      Acts::GeometryIdentifier geoId(CheckpointCodec<uint64_t>::read(is));
+      Index index = CheckpointCodec<Index>::read(is);
+      uint8_t subspace = CheckpointCodec<uint8_t>::read(is);
+      size_t n = 0u;
+      for (uint8_t j = 0u; j < 8u; ++j) {
+        n += (subspace >> j) & 1u;
+      }
+      if (n == 0u or (subspace >> Acts::eBoundSize) != 0u) {
+        throw std::runtime_error("Invalid measurement in event checkpoint");
+      }
+      values.resize(n + n * n);
+      is.read(reinterpret_cast<char*>(values.data()),
+              values.size() * sizeof(Acts::ActsScalar));
+      detail::checkStream(is);
+
+      storage.emplace_back(geoId, index);
+      const IndexSourceLink& sourceLink = storage.back();
+      restoredSourceLinks.insert(restoredSourceLinks.end(), sourceLink);
+      Acts::template_switch<AddMeasurement, 1, Acts::eBoundSize>(
+          n, measurements, sourceLink, subspace, values);
+    }
+
+    store.add(sourceLinks + "__storage", std::move(storage));
+    store.add(sourceLinks, std::move(restoredSourceLinks));
+    store.add(name, std::move(measurements));
+  }
+};
+
+ActsExamples::EventCheckpoint::EventCheckpoint(const Config& cfg,
+                                               Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_logger(Acts::getDefaultLogger("EventCheckpoint", lvl)) {
+  if (m_cfg.algorithm.empty()) {
+    throw std::invalid_argument("Missing checkpoint algorithm name");
+  }
+  // the algorithm configurations are not part of the key
+  if (m_cfg.fingerprint.empty()) {
+    throw std::invalid_argument("Missing fingerprint of the configuration "
+                                "upstream of checkpoint '" +
+                                m_cfg.algorithm + "'");
+  }
+}
+
+void ActsExamples::EventCheckpoint::addMeasurements(
+    const std::string& measurements, const std::string& sourceLinks) {
+  if (sourceLinks.empty()) {
+    throw std::invalid_argument("Checkpoint source links can not have an "
+                                "empty name");
+  }
+  add(std::make_unique<MeasurementsCollection>(measurements, sourceLinks));
+}
+
+void ActsExamples::EventCheckpoint::add(
+    std::unique_ptr<ICollection> collection) {
+  if (collection->name.empty()) {
+    throw std::invalid_argument("Checkpoint collection can not have an "
+                                "empty name");
+  }
+  if (not m_key.empty()) {
+    throw std::invalid_argument("Checkpoint '" + m_cfg.algorithm +
+                                "' is already initialized");
+  }
+  m_collections.push_back(std::move(collection));
+}
+
+void ActsExamples::EventCheckpoint::initialize(
+    const std::vector<std::string>& upstream) {
+  if (m_collections.empty()) {
+    throw std::invalid_argument("Checkpoint '" + m_cfg.algorithm +
+                                "' has no collections");
+  }
+
+  Fnv1a hash;
+  for (const auto& name : upstream) {
+    hash.add(name);
+  }
+  for (const auto& collection : m_collections) {
+    hash.add(collection->name).add(collection->typeTag);
+  }
+  if (m_cfg.randomNumbers) {
+    hash.add("seed=" + std::to_string(m_cfg.randomNumbers->config().seed));
+  }
+  hash.add(m_cfg.fingerprint);
+
+  std::ostringstream key;
+  key << std::hex << std::setfill('0') << std::setw(16) << hash.value;
+  m_key = key.str();
+  m_path = ensureWritableDirectory(joinPaths(m_cfg.directory, m_key));
+  ACTS_INFO("Using checkpoints after '" << m_cfg.algorithm << "' in "
+                                        << m_path);
+}
+
+bool ActsExamples::EventCheckpoint::restore(
+    const AlgorithmContext& ctx) const {
+  std::string path =
+      perEventFilepath(m_path, "checkpoint.bin", ctx.eventNumber);
+  std::ifstream is(path, std::ios::in | std::ios::binary);
+  if (not is) {
+    return false;
+  }
+
+  std::array<char, 8> magic = {};
+  is.read(magic.data(), magic.size());
+  if (not is or magic != kMagic or
+      CheckpointCodec<uint32_t>::read(is) != kVersion or
+      readString(is) != m_key) {
+    throw std::runtime_error("Invalid event checkpoint '" + path + "'");
+  }
+  for (const auto& collection : m_collections) {
+    if (readString(is) != collection->name) {
+      throw std::runtime_error("Unexpected collection in event checkpoint '" +
+                               path + "'");
+    }
+    collection->read(is, ctx.eventStore);
+  }
+  // the file must have been consumed completely
+  if (is.peek() != std::ifstream::traits_type::eof()) {
+    throw std::runtime_error("Trailing data in event checkpoint '" + path +
+                             "'");
+  }
+
+  ACTS_DEBUG("Restored event " << ctx.eventNumber << " from " << path);
+  return true;
+}
+
+void ActsExamples::EventCheckpoint::store(const AlgorithmContext& ctx) const {
+  std::string path =
+      perEventFilepath(m_path, "checkpoint.bin", ctx.eventNumber);
+  // write to a temporary file first so that concurrent or aborted runs never
+  // leave a partial checkpoint under the final name
+  std::string tmpPath = path + ".tmp";
+  {
+    std::ofstream os(tmpPath, std::ios::out | std::ios::binary);
+    if (not os) {
+      throw std::runtime_error("Could not open '" + tmpPath + "'");
+    }
+    os.write(kMagic.data(), kMagic.size());
+    CheckpointCodec<uint32_t>::write(os, kVersion);
+    writeString(os, m_key);
+    for (const auto& collection : m_collections) {
+      writeString(os, collection->name);
+      collection->write(ctx.eventStore, os);
+    }
+    if (not os.flush()) {
+      throw std::runtime_error("Could not write '" + tmpPath + "'");
+    }
+  }
+  if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+    throw std::runtime_error("Could not rename '" + tmpPath + "' to '" +
+                             path + "'");
+  }
+
+  ACTS_DEBUG("Stored event " << ctx.eventNumber << " in " << path);
+}
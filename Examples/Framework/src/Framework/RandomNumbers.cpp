@@ -23,6 +23,12 @@ ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
   return RandomEngine(generateSeed(context));
 }
 
+ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
+    const AlgorithmContext& context, uint64_t subId) const {
+  // the sub-entity selects the stream for the event and algorithm key
+  return RandomEngine(generateSeed(context), subId);
+}
+
 uint64_t ActsExamples::RandomNumbers::generateSeed(
     const AlgorithmContext& context) const {
   // use Cantor pairing function to generate a unique generator id from
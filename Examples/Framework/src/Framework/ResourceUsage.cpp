@@ -0,0 +1,149 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/ResourceUsage.hpp"
+
+#include <array>
+#include <atomic>
+#include <new>
+
+#include <sys/resource.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// installed by the optional allocation counting hooks
+std::atomic<ActsExamples::AllocationCounter> s_allocationCounter{nullptr};
+
+#if defined(__linux__)
+// Cycles, instructions, and cache misses of the calling thread.
+class HardwareCounters {
+ public:
+  HardwareCounters() {
+    m_fds[0] = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (m_fds[0] < 0) {
+      return;
+    }
+    m_fds[1] = open(PERF_COUNT_HW_INSTRUCTIONS, m_fds[0]);
+    m_fds[2] = open(PERF_COUNT_HW_CACHE_MISSES, m_fds[0]);
+    m_valid = (0 <= m_fds[1]) and (0 <= m_fds[2]) and
+              (ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) ==
+               0);
+  }
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+  ~HardwareCounters() {
+    for (int fd : m_fds) {
+      if (0 <= fd) {
+        close(fd);
+      }
+    }
+  }
+
+  void read(ActsExamples::ResourceUsage& usage) const {
+    // group read format: number of events followed by the values
+    std::array<uint64_t, 4> data = {};
+    if (not m_valid or
+        ::read(m_fds[0], data.data(), sizeof(data)) != sizeof(data)) {
+      return;
+    }
+    usage.cycles = data[1];
+    usage.instructions = data[2];
+    usage.cacheMisses = data[3];
+  }
+
+ private:
+  std::array<int, 3> m_fds = {-1, -1, -1};
+  bool m_valid = false;
+
+  static int open(uint64_t config, int group) {
+    perf_event_attr attr = {};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    // the group leader starts disabled and enables the whole group
+    attr.disabled = (group == -1) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group,
+                   PERF_FLAG_FD_CLOEXEC);
+  }
+};
+#endif
+
+int64_t difference(int64_t value, int64_t start) {
+  return (value < 0 or start < 0) ? -1 : (value - start);
+}
+
+}  // namespace
+
+ActsExamples::ResourceUsage ActsExamples::ResourceUsage::operator-(
+    const ResourceUsage& start) const {
+  ResourceUsage delta;
+  delta.allocations = difference(allocations, start.allocations);
+  delta.allocatedBytes = difference(allocatedBytes, start.allocatedBytes);
+  delta.peakRss = difference(peakRss, start.peakRss);
+  delta.cycles = difference(cycles, start.cycles);
+  delta.instructions = difference(instructions, start.instructions);
+  delta.cacheMisses = difference(cacheMisses, start.cacheMisses);
+  return delta;
+}
+
+void ActsExamples::setAllocationCounter(AllocationCounter counter) {
+  s_allocationCounter.store(counter);
+}
+
+bool ActsExamples::allocationTrackingAvailable() {
+  AllocationCounter counter = s_allocationCounter.load();
+  if (counter == nullptr) {
+    return false;
+  }
+  int64_t before = counter().allocations;
+  // explicit call; a new-expression could be optimized away
+  ::operator delete(::operator new(1));
+  return before != counter().allocations;
+}
+
+ActsExamples::ResourceUsage ActsExamples::currentResourceUsage(
+    bool hardwareCounters) {
+  static const bool trackAllocations = allocationTrackingAvailable();
+
+  ResourceUsage usage;
+  if (trackAllocations) {
+    AllocationCounts counts = s_allocationCounter.load()();
+    usage.allocations = counts.allocations;
+    usage.allocatedBytes = counts.bytes;
+  }
+
+  struct rusage self = {};
+  if (getrusage(RUSAGE_SELF, &self) == 0) {
+#if defined(__APPLE__)
+    usage.peakRss = self.ru_maxrss;
+#else
+    usage.peakRss = self.ru_maxrss * 1024;
+#endif
+  }
+
+#if defined(__linux__)
+  if (hardwareCounters) {
+    thread_local HardwareCounters counters;
+    counters.read(usage);
+  }
+#else
+  (void)hardwareCounters;
+#endif
+
+  return usage;
+}
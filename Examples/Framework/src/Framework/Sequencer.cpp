@@ -9,13 +9,16 @@
 #include "ActsExamples/Framework/Sequencer.hpp"
 
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/ResourceUsage.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
 #include <algorithm>
 #include <chrono>
 #include <exception>
+#include <iterator>
 #include <numeric>
+#include <tuple>
 
 #include <TROOT.h>
 #include <dfe/dfe_io_dsv.hpp>
@@ -73,6 +76,19 @@ void ActsExamples::Sequencer::addWriter(std::shared_ptr<IWriter> writer) {
   ACTS_INFO("Added writer '" << m_writers.back()->name() << "'");
 }
 
+void ActsExamples::Sequencer::addCheckpoint(
+    std::shared_ptr<EventCheckpoint> checkpoint) {
+  if (not checkpoint) {
+    throw std::invalid_argument("Can not add empty/NULL checkpoint");
+  }
+  if (m_checkpoint) {
+    throw std::invalid_argument("Only a single checkpoint is supported");
+  }
+  m_checkpoint = std::move(checkpoint);
+  ACTS_INFO("Added checkpoint after '" << m_checkpoint->config().algorithm
+                                       << "'");
+}
+
 std::vector<std::string> ActsExamples::Sequencer::listAlgorithmNames() const {
   std::vector<std::string> names;
 
@@ -92,6 +108,9 @@ std::vector<std::string> ActsExamples::Sequencer::listAlgorithmNames() const {
   for (const auto& writer : m_writers) {
     names.push_back("Writer:" + writer->name());
   }
+  if (m_checkpoint) {
+    names.push_back("Checkpoint:" + m_checkpoint->config().algorithm);
+  }
 
   return names;
 }
@@ -212,6 +231,77 @@ struct TimingInfo {
   DFE_NAMEDTUPLE(TimingInfo, identifier, time_total_s, time_perevent_s);
 };
 
+// Resource usage of one algorithm in one event
+struct ProfileEntry {
+  size_t event;
+  size_t index;
+  Duration duration;
+  ActsExamples::ResourceUsage usage;
+};
+
+// RAII-based recorder of the resource usage within a block; disabled for a
+// NULL entries container
+struct UsageRecorder {
+  std::vector<ProfileEntry>* entries;
+  size_t event;
+  size_t index;
+  ActsExamples::ResourceUsage start;
+  Timepoint startTime;
+
+  UsageRecorder(std::vector<ProfileEntry>* e, size_t ev, size_t i)
+      : entries(e), event(ev), index(i) {
+    if (entries != nullptr) {
+      start = ActsExamples::currentResourceUsage(true);
+      startTime = Clock::now();
+    }
+  }
+  ~UsageRecorder() {
+    if (entries != nullptr) {
+      Duration duration = Clock::now() - startTime;
+      auto usage = ActsExamples::currentResourceUsage(true) - start;
+      entries->push_back({event, index, duration, usage});
+    }
+  }
+};
+
+// Store per-event resource usage
+struct ProfileInfo {
+  size_t event;
+  std::string identifier;
+  double time_s;
+  int64_t allocations;
+  int64_t allocated_bytes;
+  int64_t peak_rss_increase_bytes;
+  int64_t cycles;
+  int64_t instructions;
+  int64_t cache_misses;
+
+  DFE_NAMEDTUPLE(ProfileInfo, event, identifier, time_s, allocations,
+                 allocated_bytes, peak_rss_increase_bytes, cycles,
+                 instructions, cache_misses);
+};
+
+void storeProfile(const std::vector<std::string>& identifiers,
+                  std::vector<ProfileEntry> entries, std::string path) {
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+    return std::tie(a.event, a.index) < std::tie(b.event, b.index);
+  });
+  dfe::NamedTupleCsvWriter<ProfileInfo> writer(std::move(path), 6);
+  for (const auto& entry : entries) {
+    ProfileInfo info;
+    info.event = entry.event;
+    info.identifier = identifiers[entry.index];
+    info.time_s = std::chrono::duration_cast<Seconds>(entry.duration).count();
+    info.allocations = entry.usage.allocations;
+    info.allocated_bytes = entry.usage.allocatedBytes;
+    info.peak_rss_increase_bytes = entry.usage.peakRss;
+    info.cycles = entry.usage.cycles;
+    info.instructions = entry.usage.instructions;
+    info.cache_misses = entry.usage.cacheMisses;
+    writer.append(info);
+  }
+}
+
 void storeTiming(const std::vector<std::string>& identifiers,
                  const std::vector<Duration>& durations, std::size_t numEvents,
                  std::string path) {
@@ -234,6 +324,8 @@ int ActsExamples::Sequencer::run() {
   std::vector<std::string> names = listAlgorithmNames();
   std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
   tbb::queuing_mutex clocksAlgorithmsMutex;
+  // optional per-event resource usage
+  std::vector<ProfileEntry> profileEntries;
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
@@ -251,6 +343,38 @@ int ActsExamples::Sequencer::run() {
   ACTS_INFO("  " << m_algorithms.size() << " algorithms");
   ACTS_INFO("  " << m_writers.size() << " writers");
 
+  // events restored from a checkpoint skip everything up to and including
+  // the checkpoint algorithm; the upstream names define the checkpoint key
+  size_t iCheckpoint = SIZE_MAX;
+  if (m_checkpoint) {
+    const auto& algorithm = m_checkpoint->config().algorithm;
+    auto it = std::find_if(
+        m_algorithms.begin(), m_algorithms.end(),
+        [&](const auto& alg) { return alg->name() == algorithm; });
+    if (it == m_algorithms.end()) {
+      ACTS_ERROR("Checkpoint algorithm '" << algorithm << "' does not exist");
+      return EXIT_FAILURE;
+    }
+    iCheckpoint = std::distance(m_algorithms.begin(), it);
+    size_t nUpstream = m_services.size() + m_decorators.size() +
+                       m_readers.size() + iCheckpoint + 1;
+    m_checkpoint->initialize(std::vector<std::string>(
+        names.begin(), std::next(names.begin(), nUpstream)));
+  }
+  // the checkpoint is always the last entry before the end-of-run entries
+  size_t iCheckpointClock = names.size() - 1;
+
+  if (m_cfg.enableProfiling) {
+    ACTS_INFO("Profiling resource usage per algorithm and event");
+    if (not allocationTrackingAvailable()) {
+      ACTS_INFO("Allocation counting is not active, build the executable with "
+                "ACTS_ENABLE_ALLOCATION_COUNTING to record allocations");
+    }
+    if (currentResourceUsage(true).cycles < 0) {
+      ACTS_WARNING("Hardware performance counters are not available");
+    }
+  }
+
   // run start-of-run hooks
   for (auto& service : m_services) {
     names.push_back("Service:" + service->name() + ":startRun");
@@ -261,6 +385,7 @@ int ActsExamples::Sequencer::run() {
 
   // execute the parallel event loop
   std::atomic<size_t> nProcessedEvents = 0;
+  std::atomic<size_t> nRestoredEvents = 0;
   size_t nTotalEvents = eventsRange.second - eventsRange.first;
   m_taskArena.execute([&] {
     tbb::parallel_for(
@@ -268,6 +393,9 @@ int ActsExamples::Sequencer::run() {
         [&](const tbb::blocked_range<size_t>& r) {
           std::vector<Duration> localClocksAlgorithms(names.size(),
                                                       Duration::zero());
+          std::vector<ProfileEntry> localProfileEntries;
+          std::vector<ProfileEntry>* profile =
+              m_cfg.enableProfiling ? &localProfileEntries : nullptr;
 
           for (size_t event = r.begin(); event != r.end(); ++event) {
             m_cfg.iterationCallback();
@@ -281,11 +409,13 @@ int ActsExamples::Sequencer::run() {
 
             // Prepare event store w/ service information
             for (auto& service : m_services) {
+              UsageRecorder ur(profile, event, ialgo);
               StopWatch sw(localClocksAlgorithms[ialgo++]);
               service->prepare(++context);
             }
             /// Decorate the context
             for (auto& cdr : m_decorators) {
+              UsageRecorder ur(profile, event, ialgo);
               StopWatch sw(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute context decorator: " << cdr->name());
               if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
@@ -293,8 +423,24 @@ int ActsExamples::Sequencer::run() {
               }
             }
 
+            bool restored = false;
+            if (m_checkpoint) {
+              UsageRecorder ur(profile, event, iCheckpointClock);
+              StopWatch sw(localClocksAlgorithms[iCheckpointClock]);
+              restored = m_checkpoint->restore(context);
+              nRestoredEvents += restored ? 1 : 0;
+            }
+
+            // skipped entries still advance the algorithm number to keep e.g.
+            // the random numbers of the downstream algorithms unchanged
             ACTS_VERBOSE("Execute readers");
             for (auto& rdr : m_readers) {
+              if (restored) {
+                ++ialgo;
+                ++context;
+                continue;
+              }
+              UsageRecorder ur(profile, event, ialgo);
               StopWatch sw(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute reader: " << rdr->name());
               if (rdr->read(++context) != ProcessCode::SUCCESS) {
@@ -303,16 +449,31 @@ int ActsExamples::Sequencer::run() {
             }
 
             ACTS_VERBOSE("Execute algorithms");
-            for (auto& alg : m_algorithms) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute algorithm: " << alg->name());
-              if (alg->execute(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to process event data");
+            for (size_t i = 0; i < m_algorithms.size(); ++i) {
+              auto& alg = m_algorithms[i];
+              if (restored and i <= iCheckpoint) {
+                ++ialgo;
+                ++context;
+                continue;
+              }
+              {
+                UsageRecorder ur(profile, event, ialgo);
+                StopWatch sw(localClocksAlgorithms[ialgo++]);
+                ACTS_VERBOSE("Execute algorithm: " << alg->name());
+                if (alg->execute(++context) != ProcessCode::SUCCESS) {
+                  throw std::runtime_error("Failed to process event data");
+                }
+              }
+              if (i == iCheckpoint) {
+                UsageRecorder ur(profile, event, iCheckpointClock);
+                StopWatch sw(localClocksAlgorithms[iCheckpointClock]);
+                m_checkpoint->store(context);
               }
             }
 
             ACTS_VERBOSE("Execute writers");
             for (auto& wrt : m_writers) {
+              UsageRecorder ur(profile, event, ialgo);
               StopWatch sw(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute writer: " << wrt->name());
               if (wrt->write(++context) != ProcessCode::SUCCESS) {
@@ -337,6 +498,9 @@ int ActsExamples::Sequencer::run() {
             for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
               clocksAlgorithms[i] += localClocksAlgorithms[i];
             }
+            profileEntries.insert(profileEntries.end(),
+                                  localProfileEntries.begin(),
+                                  localProfileEntries.end());
           }
         });
   });
@@ -359,6 +523,10 @@ int ActsExamples::Sequencer::run() {
   ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
                          << " (wall clock)");
   ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
+  if (m_checkpoint) {
+    ACTS_INFO("Restored " << nRestoredEvents << " events from checkpoint "
+                          << m_checkpoint->key());
+  }
   ACTS_DEBUG("Average time per algorithm:");
   for (size_t i = 0; i < names.size(); ++i) {
     ACTS_DEBUG("  " << names[i] << ": "
@@ -366,6 +534,23 @@ int ActsExamples::Sequencer::run() {
   }
   storeTiming(names, clocksAlgorithms, numEvents,
               joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile));
+  if (m_cfg.enableProfiling) {
+    std::vector<std::pair<int64_t, int64_t>> allocations(names.size());
+    for (const auto& entry : profileEntries) {
+      allocations[entry.index].first += std::max<int64_t>(
+          entry.usage.allocations, 0);
+      allocations[entry.index].second += std::max<int64_t>(
+          entry.usage.allocatedBytes, 0);
+    }
+    ACTS_DEBUG("Average allocations per algorithm:");
+    for (size_t i = 0; i < names.size(); ++i) {
+      ACTS_DEBUG("  " << names[i] << ": "
+                      << allocations[i].first / numEvents << " allocations, "
+                      << allocations[i].second / numEvents << " bytes/event");
+    }
+    storeProfile(names, std::move(profileEntries),
+                 joinPaths(m_cfg.outputDir, m_cfg.outputProfileFile));
+  }
 
   return EXIT_SUCCESS;
 }
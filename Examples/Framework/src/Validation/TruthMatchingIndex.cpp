@@ -0,0 +1,153 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Validation/TruthMatchingIndex.hpp"
+
+#include <algorithm>
+
+namespace {
+
+/// Fibonacci hashing of the barcode value onto the table slots.
+inline size_t slot(ActsFatras::Barcode particleId, size_t mask) {
+  return ((particleId.value() * 0x9E3779B97F4A7C15u) >> 32u) & mask;
+}
+
+}  // namespace
+
+ActsExamples::TruthMatchingIndex::TruthMatchingIndex(
+    const SimParticleContainer& particles,
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap) {
+  m_numContainerParticles = particles.size();
+  m_particleIds.reserve(particles.size());
+  for (const auto& particle : particles) {
+    m_particleIds.push_back(particle.particleId());
+  }
+
+  // keep the load factor of the table at or below 1/2. particles that are only
+  // found via the hits are added later on and might require a rebuild.
+  auto rebuildLookup = [this](size_t numEntries) {
+    size_t capacity = 16u;
+    while (capacity < 2u * numEntries) {
+      capacity *= 2u;
+    }
+    m_lookup.assign(capacity, kInvalidParticle);
+    const size_t mask = capacity - 1u;
+    for (ParticleIndex i = 0; i < m_particleIds.size(); ++i) {
+      size_t s = slot(m_particleIds[i], mask);
+      while (m_lookup[s] != kInvalidParticle) {
+        s = (s + 1u) & mask;
+      }
+      m_lookup[s] = i;
+    }
+  };
+  rebuildLookup(m_particleIds.size());
+
+  const size_t numHits =
+      hitParticlesMap.empty() ? 0u : (hitParticlesMap.rbegin()->first + 1u);
+  m_hitOffsets.assign(numHits + 1u, 0u);
+  m_hitParticles.reserve(hitParticlesMap.size());
+
+  // the map is ordered by hit index; fill the rows sequentially
+  for (const auto& [hit, particleId] : hitParticlesMap) {
+    ParticleIndex particle = particleIndex(particleId);
+    if (particle == kInvalidParticle) {
+      // particle without entry in the container, e.g. a secondary
+      particle = static_cast<ParticleIndex>(m_particleIds.size());
+      m_particleIds.push_back(particleId);
+      if (m_lookup.size() < 2u * m_particleIds.size()) {
+        rebuildLookup(m_particleIds.size());
+      } else {
+        const size_t mask = m_lookup.size() - 1u;
+        size_t s = slot(particleId, mask);
+        while (m_lookup[s] != kInvalidParticle) {
+          s = (s + 1u) & mask;
+        }
+        m_lookup[s] = particle;
+      }
+    }
+    m_hitParticles.push_back(particle);
+    m_hitOffsets[hit + 1u] += 1u;
+  }
+  for (size_t hit = 0; hit < numHits; ++hit) {
+    m_hitOffsets[hit + 1u] += m_hitOffsets[hit];
+  }
+
+  m_particleNumHits.assign(m_particleIds.size(), 0u);
+  for (auto particle : m_hitParticles) {
+    m_particleNumHits[particle] += 1u;
+  }
+  m_counts.assign(m_particleIds.size(), 0u);
+}
+
+ActsExamples::TruthMatchingIndex::ParticleIndex
+ActsExamples::TruthMatchingIndex::particleIndex(
+    ActsFatras::Barcode particleId) const {
+  const size_t mask = m_lookup.size() - 1u;
+  for (size_t s = slot(particleId, mask);; s = (s + 1u) & mask) {
+    const ParticleIndex particle = m_lookup[s];
+    if ((particle == kInvalidParticle) or
+        (m_particleIds[particle] == particleId)) {
+      return particle;
+    }
+  }
+}
+
+void ActsExamples::TruthMatchingIndex::increaseHitCounts(Index hit) const {
+  for (auto particle : hitParticles(hit)) {
+    // remember the order in which the particles were seen
+    if (m_counts[particle] == 0u) {
+      m_touched.push_back(particle);
+    }
+    m_counts[particle] += 1u;
+  }
+}
+
+void ActsExamples::TruthMatchingIndex::collectHitCounts(
+    std::vector<ParticleHitCount>& particleHitCounts) const {
+  particleHitCounts.clear();
+  for (auto particle : m_touched) {
+    particleHitCounts.push_back({m_particleIds[particle], m_counts[particle]});
+    m_counts[particle] = 0u;
+  }
+  m_touched.clear();
+
+  // same ordering as the free function, i.e. majority particle comes first
+  std::sort(particleHitCounts.begin(), particleHitCounts.end(),
+            [](const ParticleHitCount& lhs, const ParticleHitCount& rhs) {
+              return (lhs.hitCount > rhs.hitCount);
+            });
+}
+
+void ActsExamples::TruthMatchingIndex::identifyContributingParticles(
+    const ProtoTrack& protoTrack,
+    std::vector<ParticleHitCount>& particleHitCounts) const {
+  for (auto hit : protoTrack) {
+    increaseHitCounts(hit);
+  }
+  collectHitCounts(particleHitCounts);
+}
+
+void ActsExamples::TruthMatchingIndex::identifyContributingParticles(
+    const Trajectories& trajectories, size_t tip,
+    std::vector<ParticleHitCount>& particleHitCounts) const {
+  if (not trajectories.hasTrajectory(tip)) {
+    particleHitCounts.clear();
+    return;
+  }
+
+  trajectories.multiTrajectory().visitBackwards(tip, [&](const auto& state) {
+    // no truth info with non-measurement state
+    if (not state.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
+      return true;
+    }
+    const auto& sl = static_cast<const IndexSourceLink&>(state.uncalibrated());
+    increaseHitCounts(sl.index());
+    return true;
+  });
+  collectHitCounts(particleHitCounts);
+}
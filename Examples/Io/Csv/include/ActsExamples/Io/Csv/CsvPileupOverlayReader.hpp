@@ -0,0 +1,132 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Generators/EventGenerator.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+class TrackingGeometry;
+}
+
+namespace ActsExamples {
+
+/// Overlay pre-simulated pileup events from a minimum-bias library.
+///
+/// Instead of generating and simulating every pileup vertex for each event,
+/// the pileup is sampled from a library of already simulated minimum-bias
+/// events. The library is a directory with the per-event particle and simhit
+/// files as written by the `CsvParticleWriter` and the `CsvSimHitWriter`, i.e.
+///
+///     event000000000-<particles stem>.csv
+///     event000000000-<simhits stem>.csv
+///     event000000001-<particles stem>.csv
+///     ...
+///
+/// Each library event must contain a single primary vertex, which is checked
+/// when the library event is read. For every event, the number of pileup
+/// vertices and their positions and times are sampled with the configured
+/// generators. Each pileup vertex is filled with a randomly selected library
+/// event: its particles and simhits are shifted from the original primary
+/// vertex to the sampled vertex and get a new, unique primary vertex number in
+/// their barcodes. The pileup is then merged with the optional hard-scatter
+/// particles and simhits.
+///
+/// The shifted simhits are moved along their direction back onto their
+/// original surfaces, i.e. the shifted tracks are approximated by straight
+/// lines close to the surface, and their times are corrected for the changed
+/// path length. A shift along the beam line thus moves hits on barrel modules
+/// along z and hits on disc modules radially. Simhits that end up outside of
+/// the bounds of their surface are dropped, i.e. the overlay only contains the
+/// part of the library event that is still within the acceptance of the
+/// original modules. The curvature of the tracks is neglected, which is a good
+/// approximation for vertex shifts that are small compared to the bending
+/// radius, but the overlay is not a substitute for a full simulation.
+///
+/// @note The hard-scatter collections must be available when the reader is
+///       executed, i.e. they must be provided by previously added readers.
+class CsvPileupOverlayReader final : public IReader {
+ public:
+  struct Config {
+    /// Where to read the minimum-bias library from.
+    std::string inputDir;
+    /// Library particles filename stem.
+    std::string inputParticlesStem = "particles_initial";
+    /// Library simhits filename stem.
+    std::string inputSimHitsStem = "hits";
+    /// Optional input hard-scatter particles collection.
+    std::string inputParticles;
+    /// Optional input hard-scatter simhits collection.
+    std::string inputSimHits;
+    /// Output merged particles collection.
+    std::string outputParticles;
+    /// Output merged simhits collection.
+    std::string outputSimHits;
+    /// Number of pileup vertices per event.
+    std::shared_ptr<EventGenerator::MultiplicityGenerator> multiplicity;
+    /// Position and time of the pileup vertices.
+    std::shared_ptr<EventGenerator::VertexGenerator> vertex;
+    /// The random number service.
+    std::shared_ptr<const RandomNumbers> randomNumbers;
+    /// Tracking geometry to keep shifted simhits on their surfaces.
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry;
+    /// Load the full library into memory during construction.
+    bool preload = false;
+  };
+
+  /// Construct the pileup overlay reader.
+  ///
+  /// @param config is the configuration object
+  /// @param level is the logging level
+  CsvPileupOverlayReader(const Config& config, Acts::Logging::Level level);
+
+  std::string name() const final override;
+
+  /// Available events range. Always [0,SIZE_MAX) since any event can be
+  /// overlaid.
+  std::pair<size_t, size_t> availableEvents() const final override;
+
+  /// Overlay the pileup onto the event.
+  ProcessCode read(const ActsExamples::AlgorithmContext& ctx) final override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// One minimum-bias event from the library.
+  struct LibraryEvent {
+    SimParticleContainer::sequence_type particles;
+    SimHitContainer::sequence_type simHits;
+    /// Position and time of the primary vertex.
+    Acts::Vector4 vertex = Acts::Vector4::Zero();
+  };
+
+  LibraryEvent readLibraryEvent(size_t event) const;
+
+  Config m_cfg;
+  /// Range of the available library events.
+  std::pair<size_t, size_t> m_libraryRange;
+  /// Library events if preloaded.
+  std::vector<LibraryEvent> m_library;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,67 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/detail/CompactSteppingLogger.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// @class CsvPropagationStepsWriter
+///
+/// Write out the compact steps of the test propagations, one file per event
+///
+///     event000000001-propagation-steps.csv
+///     event000000002-propagation-steps.csv
+///     ...
+///
+/// The steps are streamed row by row directly from the compact records.
+/// Intrinsically thread-safe as one file per event.
+class CsvPropagationStepsWriter final
+    : public WriterT<std::vector<Acts::detail::CompactSteps>> {
+ public:
+  struct Config {
+    /// Which compact step collection to write.
+    std::string collection;
+    /// Where to place output files.
+    std::string outputDir;
+    /// Output filename stem.
+    std::string outputStem = "propagation-steps";
+    /// Number of decimal digits for floating point precision in output.
+    size_t outputPrecision = std::numeric_limits<float>::max_digits10;
+  };
+
+  /// Constructor with
+  /// @param config configuration struct
+  /// @param level logging level
+  CsvPropagationStepsWriter(const Config& config,
+                            Acts::Logging::Level level = Acts::Logging::INFO);
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ protected:
+  /// This implementation holds the actual writing method
+  /// and is called by the WriterT<>::write interface
+  ///
+  /// @param ctx The Algorithm context with per event information
+  /// @param stepCollection is the data to be written out
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const std::vector<Acts::detail::CompactSteps>&
+                         stepCollection) final override;
+
+ private:
+  Config m_cfg;
+};
+
+}  // namespace ActsExamples
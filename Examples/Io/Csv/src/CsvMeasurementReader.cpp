@@ -208,8 +208,9 @@ ActsExamples::ProcessCode ActsExamples::CsvMeasurementReader::read(
   }
 
   MeasurementContainer measurements;
-  for (auto& [_, meas] : orderedMeasurements) {
-    measurements.emplace_back(std::move(meas));
+  measurements.reserve(orderedMeasurements.size());
+  for (const auto& [_, meas] : orderedMeasurements) {
+    measurements.push_back(meas);
   }
 
   // Write the data to the EventStore
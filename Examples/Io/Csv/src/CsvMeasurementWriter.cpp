@@ -98,56 +98,54 @@ ActsExamples::ProcessCode ActsExamples::CsvMeasurementWriter::writeT(
       writerMeasurementSimHitMap.append({hitIdx, simHitIdx});
     }
 
-    std::visit(
-        [&](const auto& m) {
-          Acts::GeometryIdentifier geoId = m.sourceLink().geometryId();
-          // MEASUREMENT information ------------------------------------
-
-          // Encoded geometry identifier. same for all hits on the module
-          meas.geometry_id = geoId.value();
-          meas.local_key = 0;
-          // Create a full set of parameters
-          auto parameters = (m.expander() * m.parameters()).eval();
-          meas.local0 = parameters[Acts::eBoundLoc0];
-          meas.local1 = parameters[Acts::eBoundLoc1];
-          meas.phi = parameters[Acts::eBoundPhi];
-          meas.theta = parameters[Acts::eBoundTheta];
-          meas.time = parameters[Acts::eBoundTime] / Acts::UnitConstants::ns;
-
-          auto covariance =
-              (m.expander() * m.covariance() * m.expander().transpose()).eval();
-          meas.var_local0 = covariance(Acts::eBoundLoc0, Acts::eBoundLoc0);
-          meas.var_local1 = covariance(Acts::eBoundLoc1, Acts::eBoundLoc1);
-          meas.var_phi = covariance(Acts::eBoundPhi, Acts::eBoundPhi);
-          meas.var_theta = covariance(Acts::eBoundTheta, Acts::eBoundTheta);
-          meas.var_time = covariance(Acts::eBoundTime, Acts::eBoundTime);
-          for (unsigned int ipar = 0;
-               ipar < static_cast<unsigned int>(Acts::eBoundSize); ++ipar) {
-            if (m.contains(static_cast<Acts::BoundIndices>(ipar))) {
-              meas.local_key = ((1 << (ipar + 1)) | meas.local_key);
-            }
-          }
-
-          writerMeasurements.append(meas);
-
-          // CLUSTER / channel information ------------------------------
-          if (not clusters.empty() && writerCells) {
-            auto cluster = clusters[hitIdx];
-            cell.geometry_id = meas.geometry_id;
-            cell.hit_id = meas.measurement_id;
-            for (auto& c : cluster.channels) {
-              cell.channel0 = c.bin[0];
-              cell.channel1 = c.bin[1];
-              // TODO store digitial timestamp once added to the cell definition
-              cell.timestamp = 0;
-              cell.value = c.activation;
-              writerCells->append(cell);
-            }
-          }
-          // Increase counter
-          meas.measurement_id += 1;
-        },
-        measurement);
+    measurement.visit([&](const auto& m) {
+      Acts::GeometryIdentifier geoId = m.sourceLink().geometryId();
+      // MEASUREMENT information ------------------------------------
+
+      // Encoded geometry identifier. same for all hits on the module
+      meas.geometry_id = geoId.value();
+      meas.local_key = 0;
+      // Create a full set of parameters
+      auto parameters = (m.expander() * m.parameters()).eval();
+      meas.local0 = parameters[Acts::eBoundLoc0];
+      meas.local1 = parameters[Acts::eBoundLoc1];
+      meas.phi = parameters[Acts::eBoundPhi];
+      meas.theta = parameters[Acts::eBoundTheta];
+      meas.time = parameters[Acts::eBoundTime] / Acts::UnitConstants::ns;
+
+      auto covariance =
+          (m.expander() * m.covariance() * m.expander().transpose()).eval();
+      meas.var_local0 = covariance(Acts::eBoundLoc0, Acts::eBoundLoc0);
+      meas.var_local1 = covariance(Acts::eBoundLoc1, Acts::eBoundLoc1);
+      meas.var_phi = covariance(Acts::eBoundPhi, Acts::eBoundPhi);
+      meas.var_theta = covariance(Acts::eBoundTheta, Acts::eBoundTheta);
+      meas.var_time = covariance(Acts::eBoundTime, Acts::eBoundTime);
+      for (unsigned int ipar = 0;
+           ipar < static_cast<unsigned int>(Acts::eBoundSize); ++ipar) {
+        if (m.contains(static_cast<Acts::BoundIndices>(ipar))) {
+          meas.local_key = ((1 << (ipar + 1)) | meas.local_key);
+        }
+      }
+
+      writerMeasurements.append(meas);
+
+      // CLUSTER / channel information ------------------------------
+      if (not clusters.empty() && writerCells) {
+        auto cluster = clusters[hitIdx];
+        cell.geometry_id = meas.geometry_id;
+        cell.hit_id = meas.measurement_id;
+        for (auto& c : cluster.channels) {
+          cell.channel0 = c.bin[0];
+          cell.channel1 = c.bin[1];
+          // TODO store digitial timestamp once added to the cell definition
+          cell.timestamp = 0;
+          cell.value = c.activation;
+          writerCells->append(cell);
+        }
+      }
+      // Increase counter
+      meas.measurement_id += 1;
+    });
   }
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -255,4 +255,22 @@ struct SpacepointData {
   DFE_NAMEDTUPLE(SpacepointData, measurement_id, x, y, z, var_r, var_z);
 };
 
+struct PropagationStepData {
+  /// Index of the test propagation within the event.
+  uint32_t track_id;
+  /// Identifier of the current volume and surface; zero if there is none.
+  uint64_t volume_id, geometry_id;
+  /// Global position and direction.
+  float x, y, z;
+  float dx, dy, dz;
+  /// Step size constraints.
+  float step_acc, step_act, step_abt, step_usr;
+  uint32_t step_trials;
+  /// Whether the current surface carries material.
+  int32_t material;
+  DFE_NAMEDTUPLE(PropagationStepData, track_id, volume_id, geometry_id, x, y, z,
+                 dx, dy, dz, step_acc, step_act, step_abt, step_usr,
+                 step_trials, material);
+};
+
 }  // namespace ActsExamples
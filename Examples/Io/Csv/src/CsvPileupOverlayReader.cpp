@@ -0,0 +1,282 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Csv/CsvPileupOverlayReader.hpp"
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <dfe/dfe_io_dsv.hpp>
+
+#include "CsvOutputData.hpp"
+
+ActsExamples::CsvPileupOverlayReader::CsvPileupOverlayReader(
+    const ActsExamples::CsvPileupOverlayReader::Config& config,
+    Acts::Logging::Level level)
+    : m_cfg(config),
+      m_libraryRange(determineEventFilesRange(
+          m_cfg.inputDir, m_cfg.inputParticlesStem + ".csv")),
+      m_logger(Acts::getDefaultLogger("CsvPileupOverlayReader", level)) {
+  if (m_cfg.inputParticlesStem.empty()) {
+    throw std::invalid_argument("Missing library particles filename stem");
+  }
+  if (m_cfg.inputSimHitsStem.empty()) {
+    throw std::invalid_argument("Missing library simhits filename stem");
+  }
+  if (m_cfg.outputParticles.empty()) {
+    throw std::invalid_argument("Missing output particles collection");
+  }
+  if (m_cfg.outputSimHits.empty()) {
+    throw std::invalid_argument("Missing output simhits collection");
+  }
+  if (not m_cfg.multiplicity) {
+    throw std::invalid_argument("Missing pileup multiplicity generator");
+  }
+  if (not m_cfg.vertex) {
+    throw std::invalid_argument("Missing pileup vertex generator");
+  }
+  if (not m_cfg.randomNumbers) {
+    throw std::invalid_argument("Missing random numbers tool");
+  }
+  if (not m_cfg.trackingGeometry) {
+    throw std::invalid_argument("Missing tracking geometry");
+  }
+  if (m_libraryRange.first >= m_libraryRange.second) {
+    throw std::invalid_argument("Empty minimum-bias library in '" +
+                                m_cfg.inputDir + "'");
+  }
+
+  ACTS_DEBUG("Minimum-bias library contains events "
+             << m_libraryRange.first << " to " << m_libraryRange.second - 1);
+
+  if (m_cfg.preload) {
+    m_library.reserve(m_libraryRange.second - m_libraryRange.first);
+    for (size_t event = m_libraryRange.first; event < m_libraryRange.second;
+         ++event) {
+      m_library.push_back(readLibraryEvent(event));
+    }
+  }
+}
+
+std::string ActsExamples::CsvPileupOverlayReader::name() const {
+  return "CsvPileupOverlayReader";
+}
+
+std::pair<size_t, size_t>
+ActsExamples::CsvPileupOverlayReader::availableEvents() const {
+  return {0u, SIZE_MAX};
+}
+
+ActsExamples::CsvPileupOverlayReader::LibraryEvent
+ActsExamples::CsvPileupOverlayReader::readLibraryEvent(size_t event) const {
+  LibraryEvent libraryEvent;
+
+  // particles; vt and m are optional columns as for the particle reader
+  {
+    auto path = perEventFilepath(m_cfg.inputDir,
+                                 m_cfg.inputParticlesStem + ".csv", event);
+    dfe::NamedTupleCsvReader<ParticleData> reader(path, {"vt", "m"});
+    ParticleData data;
+
+    while (reader.read(data)) {
+      ActsFatras::Particle particle(ActsFatras::Barcode(data.particle_id),
+                                    Acts::PdgParticle(data.particle_type),
+                                    data.q * Acts::UnitConstants::e,
+                                    data.m * Acts::UnitConstants::GeV);
+      particle.setProcess(static_cast<ActsFatras::ProcessType>(data.process));
+      particle.setPosition4(
+          data.vx * Acts::UnitConstants::mm, data.vy * Acts::UnitConstants::mm,
+          data.vz * Acts::UnitConstants::mm, data.vt * Acts::UnitConstants::ns);
+      // Only used for direction; normalization/units do not matter
+      particle.setDirection(data.px, data.py, data.pz);
+      particle.setAbsoluteMomentum(std::hypot(data.px, data.py, data.pz) *
+                                   Acts::UnitConstants::GeV);
+      libraryEvent.particles.push_back(std::move(particle));
+    }
+  }
+
+  // simhits
+  {
+    auto path = perEventFilepath(m_cfg.inputDir,
+                                 m_cfg.inputSimHitsStem + ".csv", event);
+    dfe::NamedTupleCsvReader<SimHitData> reader(path);
+    SimHitData data;
+
+    while (reader.read(data)) {
+      ActsFatras::Hit::Vector4 pos4{
+          data.tx * Acts::UnitConstants::mm,
+          data.ty * Acts::UnitConstants::mm,
+          data.tz * Acts::UnitConstants::mm,
+          data.tt * Acts::UnitConstants::ns,
+      };
+      ActsFatras::Hit::Vector4 mom4{
+          data.tpx * Acts::UnitConstants::GeV,
+          data.tpy * Acts::UnitConstants::GeV,
+          data.tpz * Acts::UnitConstants::GeV,
+          data.te * Acts::UnitConstants::GeV,
+      };
+      ActsFatras::Hit::Vector4 delta4{
+          data.deltapx * Acts::UnitConstants::GeV,
+          data.deltapy * Acts::UnitConstants::GeV,
+          data.deltapz * Acts::UnitConstants::GeV,
+          data.deltae * Acts::UnitConstants::GeV,
+      };
+      libraryEvent.simHits.emplace_back(
+          Acts::GeometryIdentifier(data.geometry_id),
+          ActsFatras::Barcode(data.particle_id), pos4, mom4, mom4 + delta4,
+          data.index);
+    }
+  }
+
+  // the primary vertex number is replaced for the overlay, i.e. multiple
+  // primary vertices would result in duplicated barcodes
+  auto checkPrimaryVertex = [&](ActsFatras::Barcode barcode) {
+    const auto& first = libraryEvent.particles.empty()
+                            ? libraryEvent.simHits.front().particleId()
+                            : libraryEvent.particles.front().particleId();
+    if (barcode.vertexPrimary() != first.vertexPrimary()) {
+      throw std::runtime_error("Minimum-bias library event " +
+                               std::to_string(event) +
+                               " contains more than one primary vertex");
+    }
+  };
+  for (const auto& particle : libraryEvent.particles) {
+    checkPrimaryVertex(particle.particleId());
+  }
+  for (const auto& simHit : libraryEvent.simHits) {
+    checkPrimaryVertex(simHit.particleId());
+  }
+
+  // the primary vertex is given by the particles directly attached to it
+  auto primary = std::find_if(
+      libraryEvent.particles.begin(), libraryEvent.particles.end(),
+      [](const ActsFatras::Particle& particle) {
+        return (particle.particleId().vertexSecondary() == 0u) and
+               (particle.particleId().generation() == 0u);
+      });
+  if (primary != libraryEvent.particles.end()) {
+    libraryEvent.vertex = primary->fourPosition();
+  }
+
+  return libraryEvent;
+}
+
+ActsExamples::ProcessCode ActsExamples::CsvPileupOverlayReader::read(
+    const ActsExamples::AlgorithmContext& ctx) {
+  SimParticleContainer particles;
+  SimHitContainer simHits;
+  if (not m_cfg.inputParticles.empty()) {
+    particles =
+        ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  }
+  if (not m_cfg.inputSimHits.empty()) {
+    simHits = ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimHits);
+  }
+
+  // pileup vertices are numbered after the hard-scatter vertices
+  ActsFatras::Barcode::Value primaryVertex = 0u;
+  for (const auto& particle : particles) {
+    primaryVertex =
+        std::max(primaryVertex, particle.particleId().vertexPrimary());
+  }
+
+  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+  std::uniform_int_distribution<size_t> sampleEvent(
+      m_libraryRange.first, m_libraryRange.second - 1);
+
+  const size_t nPileup = (*m_cfg.multiplicity)(rng);
+  SimParticleContainer::sequence_type pileupParticles;
+  SimHitContainer::sequence_type pileupSimHits;
+  size_t nDroppedSimHits = 0;
+
+  for (size_t n = 0; n < nPileup; ++n) {
+    const Acts::Vector4 vertex = (*m_cfg.vertex)(rng);
+    const size_t event = sampleEvent(rng);
+    primaryVertex += 1;
+
+    LibraryEvent loaded;
+    if (m_library.empty()) {
+      loaded = readLibraryEvent(event);
+    }
+    const LibraryEvent& libraryEvent =
+        m_library.empty() ? loaded : m_library[event - m_libraryRange.first];
+    const Acts::Vector4 shift = vertex - libraryEvent.vertex;
+
+    for (const auto& particle : libraryEvent.particles) {
+      auto shifted = particle.withParticleId(
+          ActsFatras::Barcode(particle.particleId())
+              .setVertexPrimary(primaryVertex));
+      shifted.setPosition4(particle.fourPosition() + shift);
+      pileupParticles.push_back(std::move(shifted));
+    }
+
+    for (const auto& simHit : libraryEvent.simHits) {
+      const Acts::Surface* surface =
+          m_cfg.trackingGeometry->findSurface(simHit.geometryId());
+      if (surface == nullptr) {
+        ACTS_VERBOSE("Drop simhit on unknown surface " << simHit.geometryId());
+        ++nDroppedSimHits;
+        continue;
+      }
+      // the shifted track is approximated locally by a straight line, i.e.
+      // the shifted hit is moved along its direction back onto the surface.
+      // this also moves hits on disc modules radially for a shift along z.
+      const Acts::Vector4 shifted4 = simHit.fourPosition() + shift;
+      const Acts::Vector3 dir = simHit.unitDirection();
+      const auto intersection = surface->intersect(
+          ctx.geoContext, shifted4.segment<3>(Acts::ePos0), dir, true);
+      // the shifted simhit can end up outside of its module
+      if (not intersection) {
+        ++nDroppedSimHits;
+        continue;
+      }
+      const Acts::Vector4& mom4 = simHit.momentum4Before();
+      Acts::Vector4 pos4 = shifted4;
+      pos4.segment<3>(Acts::ePos0) = intersection.intersection.position;
+      // the time changes with the path along the direction, E/p = 1/beta
+      pos4[Acts::eTime] += intersection.intersection.pathLength *
+                           mom4[Acts::eEnergy] /
+                           mom4.segment<3>(Acts::eMom0).norm();
+      pileupSimHits.emplace_back(
+          simHit.geometryId(),
+          ActsFatras::Barcode(simHit.particleId())
+              .setVertexPrimary(primaryVertex),
+          pos4, simHit.momentum4Before(), simHit.momentum4After(),
+          simHit.index());
+    }
+
+    ACTS_VERBOSE("Overlay library event " << event << " as primary vertex "
+                                          << primaryVertex << " with "
+                                          << libraryEvent.particles.size()
+                                          << " particles and "
+                                          << libraryEvent.simHits.size()
+                                          << " simhits");
+  }
+
+  ACTS_DEBUG("Overlay " << nPileup << " pileup vertices with "
+                        << pileupParticles.size() << " particles and "
+                        << pileupSimHits.size() << " simhits, "
+                        << nDroppedSimHits
+                        << " simhits outside of their surface were dropped");
+
+  particles.insert(pileupParticles.begin(), pileupParticles.end());
+  simHits.insert(pileupSimHits.begin(), pileupSimHits.end());
+  ctx.eventStore.add(m_cfg.outputParticles, std::move(particles));
+  ctx.eventStore.add(m_cfg.outputSimHits, std::move(simHits));
+
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,61 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Csv/CsvPropagationStepsWriter.hpp"
+
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <stdexcept>
+
+#include <dfe/dfe_io_dsv.hpp>
+
+#include "CsvOutputData.hpp"
+
+ActsExamples::CsvPropagationStepsWriter::CsvPropagationStepsWriter(
+    const ActsExamples::CsvPropagationStepsWriter::Config& config,
+    Acts::Logging::Level level)
+    : WriterT(config.collection, "CsvPropagationStepsWriter", level),
+      m_cfg(config) {
+  if (m_cfg.collection.empty()) {
+    throw std::invalid_argument("Missing input collection");
+  }
+}
+
+ActsExamples::ProcessCode ActsExamples::CsvPropagationStepsWriter::writeT(
+    const AlgorithmContext& ctx,
+    const std::vector<Acts::detail::CompactSteps>& stepCollection) {
+  std::string path = perEventFilepath(
+      m_cfg.outputDir, m_cfg.outputStem + ".csv", ctx.eventNumber);
+
+  dfe::NamedTupleCsvWriter<PropagationStepData> writer(path,
+                                                       m_cfg.outputPrecision);
+
+  PropagationStepData data;
+  for (size_t itrack = 0; itrack < stepCollection.size(); ++itrack) {
+    const auto& steps = stepCollection[itrack];
+    data.track_id = itrack;
+    for (size_t istep = 0; istep < steps.size(); ++istep) {
+      data.volume_id = steps.volumeId[istep];
+      data.geometry_id = steps.surfaceId[istep];
+      data.x = steps.x[istep];
+      data.y = steps.y[istep];
+      data.z = steps.z[istep];
+      data.dx = steps.dx[istep];
+      data.dy = steps.dy[istep];
+      data.dz = steps.dz[istep];
+      data.step_acc = steps.stepAccuracy[istep];
+      data.step_act = steps.stepActor[istep];
+      data.step_abt = steps.stepAborter[istep];
+      data.step_usr = steps.stepUser[istep];
+      data.step_trials = steps.nStepTrials[istep];
+      data.material = steps.material[istep];
+      writer.append(data);
+    }
+  }
+  return ActsExamples::ProcessCode::SUCCESS;
+}
@@ -102,7 +102,7 @@ Measurement readMeasurement(edm4hep::TrackerHitPlane from,
 /// Known issues:
 /// - cluster channels are written to inappropriate fields
 /// - local 2D coordinates and time are written to position
-void writeMeasurement(const Measurement& from,
+void writeMeasurement(const ConstMeasurementProxy& from,
                       edm4hep::MutableTrackerHitPlane to,
                       const Cluster* fromCluster,
                       edm4hep::TrackerHitCollection& toClusters,
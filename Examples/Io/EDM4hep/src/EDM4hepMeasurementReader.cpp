@@ -66,7 +66,7 @@ ProcessCode EDM4hepMeasurementReader::read(const AlgorithmContext& ctx) {
         trackerHitPlane, m_trackerHitRawCollection, &cluster,
         [](std::uint64_t cellId) { return Acts::GeometryIdentifier(cellId); });
 
-    measurements.push_back(std::move(measurement));
+    measurements.push_back(measurement);
     clusters.push_back(std::move(cluster));
   }
 
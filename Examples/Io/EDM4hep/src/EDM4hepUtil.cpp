@@ -193,58 +193,55 @@ Measurement EDM4hepUtil::readMeasurement(
   return to;
 }
 
-void EDM4hepUtil::writeMeasurement(const Measurement& from,
+void EDM4hepUtil::writeMeasurement(const ConstMeasurementProxy& from,
                                    edm4hep::MutableTrackerHitPlane to,
                                    const Cluster* fromCluster,
                                    edm4hep::TrackerHitCollection& toClusters,
                                    MapGeometryIdTo geometryMapper) {
-  std::visit(
-      [&](const auto& m) {
-        Acts::GeometryIdentifier geoId = m.sourceLink().geometryId();
-
-        if (geometryMapper) {
-          // no need for digitization as we only want to identify the sensor
-          to.setCellID(geometryMapper(geoId));
-        }
-
-        auto parameters = (m.expander() * m.parameters()).eval();
-
-        to.setTime(parameters[Acts::eBoundTime] / Acts::UnitConstants::ns);
-
-        to.setType(EDM4hepUtil::EDM4HEP_ACTS_POSITION_TYPE);
-        // TODO set uv (which are in global spherical coordinates with r=1)
-        to.setPosition({parameters[Acts::eBoundLoc0],
-                        parameters[Acts::eBoundLoc1],
-                        parameters[Acts::eBoundTime]});
-
-        auto covariance =
-            (m.expander() * m.covariance() * m.expander().transpose()).eval();
-        to.setCovMatrix({
-            static_cast<float>(covariance(Acts::eBoundLoc0, Acts::eBoundLoc0)),
-            static_cast<float>(covariance(Acts::eBoundLoc1, Acts::eBoundLoc0)),
-            static_cast<float>(covariance(Acts::eBoundLoc1, Acts::eBoundLoc1)),
-            0,
-            0,
-            0,
-        });
-
-        if (fromCluster) {
-          for (const auto& c : fromCluster->channels) {
-            auto toChannel = toClusters.create();
-            to.addToRawHits(toChannel.getObjectID());
-
-            // TODO digitization channel
-
-            // TODO get EDM4hep fixed
-            // misusing some fields to store ACTS specific information
-            // don't ask ...
-            toChannel.setType(c.bin[0]);
-            toChannel.setQuality(c.bin[1]);
-            toChannel.setTime(c.activation);
-          }
-        }
-      },
-      from);
+  from.visit([&](const auto& m) {
+    Acts::GeometryIdentifier geoId = m.sourceLink().geometryId();
+
+    if (geometryMapper) {
+      // no need for digitization as we only want to identify the sensor
+      to.setCellID(geometryMapper(geoId));
+    }
+
+    auto parameters = (m.expander() * m.parameters()).eval();
+
+    to.setTime(parameters[Acts::eBoundTime] / Acts::UnitConstants::ns);
+
+    to.setType(EDM4hepUtil::EDM4HEP_ACTS_POSITION_TYPE);
+    // TODO set uv (which are in global spherical coordinates with r=1)
+    to.setPosition({parameters[Acts::eBoundLoc0], parameters[Acts::eBoundLoc1],
+                    parameters[Acts::eBoundTime]});
+
+    auto covariance =
+        (m.expander() * m.covariance() * m.expander().transpose()).eval();
+    to.setCovMatrix({
+        static_cast<float>(covariance(Acts::eBoundLoc0, Acts::eBoundLoc0)),
+        static_cast<float>(covariance(Acts::eBoundLoc1, Acts::eBoundLoc0)),
+        static_cast<float>(covariance(Acts::eBoundLoc1, Acts::eBoundLoc1)),
+        0,
+        0,
+        0,
+    });
+
+    if (fromCluster) {
+      for (const auto& c : fromCluster->channels) {
+        auto toChannel = toClusters.create();
+        to.addToRawHits(toChannel.getObjectID());
+
+        // TODO digitization channel
+
+        // TODO get EDM4hep fixed
+        // misusing some fields to store ACTS specific information
+        // don't ask ...
+        toChannel.setType(c.bin[0]);
+        toChannel.setQuality(c.bin[1]);
+        toChannel.setTime(c.activation);
+      }
+    }
+  });
 }
 
 void EDM4hepUtil::writeTrajectory(
@@ -13,6 +13,7 @@
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
+#include "ActsExamples/Validation/TruthMatchingIndex.hpp"
 
 #include <numeric>
 #include <stdexcept>
@@ -89,10 +90,13 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
   const auto& hitParticlesMap =
       ctx.eventStore.get<HitParticlesMap>(m_cfg.inputMeasurementParticlesMap);
 
-  // Counter of truth-matched reco tracks
-  std::map<ActsFatras::Barcode, std::vector<RecoTrackInfo>> matched;
-  // Counter of truth-unmatched reco tracks
-  std::map<ActsFatras::Barcode, size_t> unmatched;
+  // Truth association for this event w/ dense particle indices
+  const TruthMatchingIndex truthIndex(particles, hitParticlesMap);
+
+  // Truth-matched reco tracks per particle
+  std::vector<std::vector<RecoTrackInfo>> matched(truthIndex.numParticles());
+  // Counter of truth-unmatched reco tracks per particle
+  std::vector<size_t> unmatched(truthIndex.numParticles(), 0u);
   // For each particle within a track, how many hits did it contribute
   std::vector<ParticleHitCount> particleHitCounts;
 
@@ -146,8 +150,8 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
                                   trajState.nSharedHits);
 
       // Get the majority truth particle to this track
-      identifyContributingParticles(hitParticlesMap, traj, trackTip,
-                                    particleHitCounts);
+      truthIndex.identifyContributingParticles(traj, trackTip,
+                                               particleHitCounts);
       if (particleHitCounts.empty()) {
         ACTS_WARNING(
             "No truth particle associated with this trajectory with entry "
@@ -158,8 +162,8 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
       // Get the majority particleId and majority particle counts
       // Note that the majority particle might be not in the truth seeds
       // collection
-      ActsFatras::Barcode majorityParticleId =
-          particleHitCounts.front().particleId;
+      const auto majorityParticle =
+          truthIndex.particleIndex(particleHitCounts.front().particleId);
       size_t nMajorityHits = particleHitCounts.front().hitCount;
 
       // Check if the trajectory is matched with truth.
@@ -167,11 +171,10 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
       bool isFake = false;
       if (nMajorityHits * 1. / trajState.nMeasurements >=
           m_cfg.truthMatchProbMin) {
-        matched[majorityParticleId].push_back(
-            {nMajorityHits, fittedParameters});
+        matched[majorityParticle].push_back({nMajorityHits, fittedParameters});
       } else {
         isFake = true;
-        unmatched[majorityParticleId]++;
+        unmatched[majorityParticle]++;
       }
       // Fill fake rate plots
       m_fakeRatePlotTool.fill(m_fakeRatePlotCache, fittedParameters, isFake);
@@ -195,7 +198,7 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
   // Use truth-based classification for duplication rate plots
   if (!m_cfg.duplicatedPredictor) {
     // Loop over all truth-matched reco tracks for duplication rate plots
-    for (auto& [particleId, matchedTracks] : matched) {
+    for (auto& matchedTracks : matched) {
       // Sort the reco tracks matched to this particle by the number of majority
       // hits
       std::sort(matchedTracks.begin(), matchedTracks.end(),
@@ -217,19 +220,16 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
 
   // Loop over all truth particle seeds for efficiency plots and reco details.
   // These are filled w.r.t. truth particle seed info
+  // The dense index of a container particle is its position in the container
+  TruthMatchingIndex::ParticleIndex iparticle = 0;
   for (const auto& particle : particles) {
+    const auto ip = iparticle++;
     if (particle.transverseMomentum() < m_cfg.ptMin) {
       continue;
     }
-    auto particleId = particle.particleId();
     // Investigate the truth-matched tracks
-    size_t nMatchedTracks = 0;
-    bool isReconstructed = false;
-    auto imatched = matched.find(particleId);
-    if (imatched != matched.end()) {
-      nMatchedTracks = imatched->second.size();
-      isReconstructed = true;
-    }
+    size_t nMatchedTracks = matched[ip].size();
+    bool isReconstructed = (nMatchedTracks != 0);
     // Fill efficiency plots
     m_effPlotTool.fill(m_effPlotCache, particle, isReconstructed);
     // Fill number of duplicated tracks for this particle
@@ -237,11 +237,7 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
                                nMatchedTracks - 1);
 
     // Investigate the fake (i.e. truth-unmatched) tracks
-    size_t nFakeTracks = 0;
-    auto ifake = unmatched.find(particleId);
-    if (ifake != unmatched.end()) {
-      nFakeTracks = ifake->second;
-    }
+    size_t nFakeTracks = unmatched[ip];
     // Fill number of reconstructed/truth-matched/fake tracks for this particle
     m_fakeRatePlotTool.fill(m_fakeRatePlotCache, particle, nMatchedTracks,
                             nFakeTracks);
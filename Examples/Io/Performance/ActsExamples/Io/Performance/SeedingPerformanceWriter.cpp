@@ -12,10 +12,11 @@
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
+#include "ActsExamples/Validation/TruthMatchingIndex.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 
 #include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 #include <TFile.h>
 
@@ -106,18 +107,20 @@ ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::writeT(
 
   size_t nSeeds = tracks.size();
   size_t nMatchedSeeds = 0;
-  // Map from particles to how many times they were successfully found by a seed
-  std::unordered_map<ActsFatras::Barcode, std::size_t> truthCount;
+  // Truth association w/ dense particle indices
+  const TruthMatchingIndex truthIndex(particles, hitParticlesMap);
+  // How many times each particle was successfully found by a seed
+  std::vector<std::size_t> truthCount(truthIndex.numParticles(), 0u);
+  // For each particle within a seed, how many hits did it contribute
+  std::vector<ParticleHitCount> particleHitCounts;
 
   for (size_t itrack = 0; itrack < tracks.size(); ++itrack) {
     const auto& track = tracks[itrack];
-    std::vector<ParticleHitCount> particleHitCounts;
-    identifyContributingParticles(hitParticlesMap, track, particleHitCounts);
+    truthIndex.identifyContributingParticles(track, particleHitCounts);
     // All hits matched to the same particle
     if (particleHitCounts.size() == 1) {
-      auto prt = particleHitCounts.at(0);
-      auto it = truthCount.try_emplace(prt.particleId, 0u).first;
-      it->second += 1;
+      auto ip = truthIndex.particleIndex(particleHitCounts.front().particleId);
+      truthCount[ip] += 1;
       nMatchedSeeds++;
     }
   }
@@ -125,14 +128,14 @@ ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::writeT(
   int nMatchedParticles = 0;
   int nDuplicatedParticles = 0;
   // Fill the effeciency and fake rate plots
+  // The dense index of a container particle is its position in the container
+  TruthMatchingIndex::ParticleIndex iparticle = 0;
   for (const auto& particle : particles) {
-    const auto it1 = truthCount.find(particle.particleId());
+    const int nMatchedSeedsForParticle = truthCount[iparticle++];
     bool isMatched = false;
-    int nMatchedSeedsForParticle = 0;
-    if (it1 != truthCount.end()) {
+    if (nMatchedSeedsForParticle > 0) {
       isMatched = true;
       nMatchedParticles++;
-      nMatchedSeedsForParticle = it1->second;
       if (nMatchedSeedsForParticle > 1) {
         nDuplicatedParticles++;
       }
@@ -13,14 +13,13 @@
 #include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
-#include "ActsExamples/Utilities/Range.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
+#include "ActsExamples/Validation/TruthMatchingIndex.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 
 #include <algorithm>
 #include <cstdint>
 #include <mutex>
-#include <unordered_map>
 #include <vector>
 
 #include <TFile.h>
@@ -136,14 +135,12 @@ struct ActsExamples::TrackFinderPerformanceWriter::Impl {
   void write(uint64_t eventId, const SimParticleContainer& particles,
              const HitParticlesMap& hitParticlesMap,
              const ProtoTrackContainer& tracks) {
-    // compute the inverse mapping on-the-fly
-    const auto& particleHitsMap = invertIndexMultimap(hitParticlesMap);
+    // truth association w/ dense particle indices
+    const TruthMatchingIndex truthIndex(particles, hitParticlesMap);
     // How often a particle was reconstructed.
-    std::unordered_map<ActsFatras::Barcode, std::size_t> reconCount;
-    reconCount.reserve(particles.size());
+    std::vector<std::size_t> reconCount(truthIndex.numParticles(), 0u);
     // How often a particle was reconstructed as the majority particle.
-    std::unordered_map<ActsFatras::Barcode, std::size_t> majorityCount;
-    majorityCount.reserve(particles.size());
+    std::vector<std::size_t> majorityCount(truthIndex.numParticles(), 0u);
     // For each particle within a track, how many hits did it contribute
     std::vector<ParticleHitCount> particleHitCounts;
 
@@ -153,21 +150,17 @@ struct ActsExamples::TrackFinderPerformanceWriter::Impl {
       for (size_t itrack = 0; itrack < tracks.size(); ++itrack) {
         const auto& track = tracks[itrack];
 
-        identifyContributingParticles(hitParticlesMap, track,
-                                      particleHitCounts);
+        truthIndex.identifyContributingParticles(track, particleHitCounts);
         // extract per-particle reconstruction counts
         // empty track hits counts could originate from a  buggy track finder
         // that results in empty tracks or from purely noise track where no hits
         // is from a particle.
         if (not particleHitCounts.empty()) {
-          auto it = majorityCount
-                        .try_emplace(particleHitCounts.front().particleId, 0u)
-                        .first;
-          it->second += 1;
+          majorityCount[truthIndex.particleIndex(
+              particleHitCounts.front().particleId)] += 1;
         }
         for (const auto& hc : particleHitCounts) {
-          auto it = reconCount.try_emplace(hc.particleId, 0u).first;
-          it->second += 1;
+          reconCount[truthIndex.particleIndex(hc.particleId)] += 1;
         }
 
         trkEventId = eventId;
@@ -180,9 +173,8 @@ struct ActsExamples::TrackFinderPerformanceWriter::Impl {
         for (const auto& phc : particleHitCounts) {
           trkParticleId.push_back(phc.particleId.value());
           // count total number of hits for this particle
-          auto trueParticleHits =
-              makeRange(particleHitsMap.equal_range(phc.particleId.value()));
-          trkParticleNumHitsTotal.push_back(trueParticleHits.size());
+          trkParticleNumHitsTotal.push_back(truthIndex.numParticleHits(
+              truthIndex.particleIndex(phc.particleId)));
           trkParticleNumHitsOnTrack.push_back(phc.hitCount);
         }
 
@@ -193,10 +185,10 @@ struct ActsExamples::TrackFinderPerformanceWriter::Impl {
     // write per-particle performance measures
     {
       std::lock_guard<std::mutex> guardPrt(trkMutex);
+      // dense index of a container particle is its position in the container
+      TruthMatchingIndex::ParticleIndex iparticle = 0;
       for (const auto& particle : particles) {
-        // find all hits for this particle
-        auto hits =
-            makeRange(particleHitsMap.equal_range(particle.particleId()));
+        const auto ip = iparticle++;
 
         // identification
         prtEventId = eventId;
@@ -214,11 +206,9 @@ struct ActsExamples::TrackFinderPerformanceWriter::Impl {
         prtM = particle.mass() / Acts::UnitConstants::GeV;
         prtQ = particle.charge() / Acts::UnitConstants::e;
         // reconstruction
-        prtNumHits = hits.size();
-        auto nt = reconCount.find(particle.particleId());
-        prtNumTracks = (nt != reconCount.end()) ? nt->second : 0u;
-        auto nm = majorityCount.find(particle.particleId());
-        prtNumTracksMajority = (nm != majorityCount.end()) ? nm->second : 0u;
+        prtNumHits = truthIndex.numParticleHits(ip);
+        prtNumTracks = reconCount[ip];
+        prtNumTracksMajority = majorityCount[ip];
 
         prtTree->Fill();
       }
@@ -13,6 +13,7 @@
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
+#include "ActsExamples/Validation/TruthMatchingIndex.hpp"
 
 #include <stdexcept>
 
@@ -92,9 +93,10 @@ ActsExamples::ProcessCode ActsExamples::TrackFitterPerformanceWriter::writeT(
   const auto& hitParticlesMap =
       ctx.eventStore.get<HitParticlesMap>(m_cfg.inputMeasurementParticlesMap);
 
+  // Truth association w/ dense particle indices
+  const TruthMatchingIndex truthIndex(particles, hitParticlesMap);
   // Truth particles with corresponding reconstructed tracks
-  std::vector<ActsFatras::Barcode> reconParticleIds;
-  reconParticleIds.reserve(particles.size());
+  std::vector<bool> isReconstructed(truthIndex.numParticles(), false);
   // For each particle within a track, how many hits did it contribute
   std::vector<ParticleHitCount> particleHitCounts;
 
@@ -131,21 +133,23 @@ ActsExamples::ProcessCode ActsExamples::TrackFitterPerformanceWriter::writeT(
     const auto& fittedParameters = traj.trackParameters(trackTip);
 
     // Get the majority truth particle for this trajectory
-    identifyContributingParticles(hitParticlesMap, traj, trackTip,
-                                  particleHitCounts);
+    truthIndex.identifyContributingParticles(traj, trackTip,
+                                             particleHitCounts);
     if (particleHitCounts.empty()) {
       ACTS_WARNING("No truth particle associated with this trajectory.");
       continue;
     }
     // Find the truth particle for the majority barcode
-    const auto ip = particles.find(particleHitCounts.front().particleId);
-    if (ip == particles.end()) {
+    const auto majorityParticle =
+        truthIndex.particleIndex(particleHitCounts.front().particleId);
+    if (not truthIndex.isInContainer(majorityParticle)) {
       ACTS_WARNING("Majority particle not found in the particles collection.");
       continue;
     }
+    const auto ip = particles.nth(majorityParticle);
 
-    // Record this majority particle ID of this trajectory
-    reconParticleIds.push_back(ip->particleId());
+    // Record this majority particle of this trajectory
+    isReconstructed[majorityParticle] = true;
     // Fill the residual plots
     m_resPlotTool.fill(m_resPlotCache, ctx.geoContext, *ip,
                        traj.trackParameters(trackTip));
@@ -162,15 +166,10 @@ ActsExamples::ProcessCode ActsExamples::TrackFitterPerformanceWriter::writeT(
   // Fill the efficiency, defined as the ratio between number of tracks with
   // fitted parameter and total truth tracks (assumes one truth partilce has
   // one truth track)
+  // The dense index of a container particle is its position in the container
+  TruthMatchingIndex::ParticleIndex iparticle = 0;
   for (const auto& particle : particles) {
-    bool isReconstructed = false;
-    // Find if the particle has been reconstructed
-    auto it = std::find(reconParticleIds.begin(), reconParticleIds.end(),
-                        particle.particleId());
-    if (it != reconParticleIds.end()) {
-      isReconstructed = true;
-    }
-    m_effPlotTool.fill(m_effPlotCache, particle, isReconstructed);
+    m_effPlotTool.fill(m_effPlotCache, particle, isReconstructed[iparticle++]);
   }
 
   return ProcessCode::SUCCESS;
@@ -109,49 +109,47 @@ ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::writeT(
   for (Index hitIdx = 0u; hitIdx < measurements.size(); ++hitIdx) {
     const auto& meas = measurements[hitIdx];
 
-    std::visit(
-        [&](const auto& m) {
-          Acts::GeometryIdentifier geoId = m.sourceLink().geometryId();
-          // find the corresponding surface
-          const Acts::Surface* surfacePtr =
-              m_cfg.trackingGeometry->findSurface(geoId);
-          if (not surfacePtr) {
-            return;
-          }
-          const Acts::Surface& surface = *surfacePtr;
-          // find the corresponding output tree
-          auto dTreeItr = m_outputTrees.find(geoId);
-          if (dTreeItr == m_outputTrees.end()) {
-            return;
-          }
-          auto& dTree = *dTreeItr;
-
-          // Fill the identification
-          dTree->fillIdentification(ctx.eventNumber, geoId);
-
-          // Find the contributing simulated hits
-          auto indices = makeRange(hitSimHitsMap.equal_range(hitIdx));
-          // Use average truth in the case of multiple contributing sim hits
-          auto [local, pos4, dir] =
-              averageSimHits(ctx.geoContext, surface, simHits, indices);
-          dTree->fillTruthParameters(local, pos4, dir);
-          dTree->fillBoundMeasurement(m);
-          if (not clusters.empty()) {
-            const auto& c = clusters[hitIdx];
-            dTree->fillCluster(c);
-          }
-          dTree->tree->Fill();
-          if (dTree->chValue != nullptr) {
-            dTree->chValue->clear();
-          }
-          if (dTree->chId[0] != nullptr) {
-            dTree->chId[0]->clear();
-          }
-          if (dTree->chId[1] != nullptr) {
-            dTree->chId[1]->clear();
-          }
-        },
-        meas);
+    meas.visit([&](const auto& m) {
+      Acts::GeometryIdentifier geoId = m.sourceLink().geometryId();
+      // find the corresponding surface
+      const Acts::Surface* surfacePtr =
+          m_cfg.trackingGeometry->findSurface(geoId);
+      if (not surfacePtr) {
+        return;
+      }
+      const Acts::Surface& surface = *surfacePtr;
+      // find the corresponding output tree
+      auto dTreeItr = m_outputTrees.find(geoId);
+      if (dTreeItr == m_outputTrees.end()) {
+        return;
+      }
+      auto& dTree = *dTreeItr;
+
+      // Fill the identification
+      dTree->fillIdentification(ctx.eventNumber, geoId);
+
+      // Find the contributing simulated hits
+      auto indices = makeRange(hitSimHitsMap.equal_range(hitIdx));
+      // Use average truth in the case of multiple contributing sim hits
+      auto [local, pos4, dir] =
+          averageSimHits(ctx.geoContext, surface, simHits, indices);
+      dTree->fillTruthParameters(local, pos4, dir);
+      dTree->fillBoundMeasurement(m);
+      if (not clusters.empty()) {
+        const auto& c = clusters[hitIdx];
+        dTree->fillCluster(c);
+      }
+      dTree->tree->Fill();
+      if (dTree->chValue != nullptr) {
+        dTree->chValue->clear();
+      }
+      if (dTree->chId[0] != nullptr) {
+        dTree->chId[0]->clear();
+      }
+      if (dTree->chId[1] != nullptr) {
+        dTree->chId[1]->clear();
+      }
+    });
   }
 
   return ActsExamples::ProcessCode::SUCCESS;
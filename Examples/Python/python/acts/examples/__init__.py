@@ -176,6 +176,32 @@ def defaultKWArgs(**kwargs) -> dict:
     }
 
 
+class EventDataHook(BareAlgorithm):
+    """Hands the event data of each event to a Python callback as NumPy arrays.
+
+    ``collections`` maps the whiteboard names to the view functions, e.g.
+    ``{"simhits": simHitArray, "spacepoints": spacePointArray}``. The callback
+    is called as ``callback(eventNumber, arrays)`` with a dict of read-only
+    structured arrays that point directly into the event store, i.e. nothing is
+    copied. The arrays are only valid during the callback; use ``numpy.copy``
+    to keep data beyond the current event.
+    """
+
+    def __init__(
+        self, callback, collections, name="EventDataHook", level=acts.logging.INFO
+    ):
+        BareAlgorithm.__init__(self, name=name, level=level)
+        self.callback = callback
+        self.collections = dict(collections)
+
+    def execute(self, ctx):
+        arrays = {
+            key: view(ctx.eventStore, key) for key, view in self.collections.items()
+        }
+        self.callback(ctx.eventNumber, arrays)
+        return ProcessCode.SUCCESS
+
+
 def dump_args(func):
     """
     Decorator to print function call details.
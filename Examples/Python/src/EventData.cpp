@@ -0,0 +1,196 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Plugins/Python/Utilities.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+using namespace pybind11::literals;
+
+namespace {
+
+/// Description of a structured NumPy record type on top of a C++ class
+///
+/// The event data classes keep their members private, so the field offsets
+/// are derived from the declaration order and checked against the values
+/// returned by the public accessors of a probe object with distinct values.
+/// A layout change of the classes thus results in an error instead of a
+/// silently wrong view.
+class RecordLayout {
+ public:
+  template <typename T>
+  explicit RecordLayout(const T& probe)
+      : m_probe(reinterpret_cast<const char*>(&probe)),
+        m_itemsize(sizeof(T)) {}
+
+  /// Add the field following the previous one in declaration order
+  template <typename T>
+  RecordLayout& next(const char* name, const char* format, const T& expected) {
+    size_t offset = (m_end + alignof(T) - 1) / alignof(T) * alignof(T);
+    if (offset + sizeof(T) > m_itemsize or
+        std::memcmp(m_probe + offset, &expected, sizeof(T)) != 0) {
+      throw std::runtime_error(std::string("Unexpected memory layout of ") +
+                               "the event data field " + name);
+    }
+    return add(name, format, offset, sizeof(T));
+  }
+
+  /// Add the field referenced by an accessor of the probe
+  template <typename T>
+  RecordLayout& at(const char* name, const char* format, const T& member) {
+    return add(name, format,
+               reinterpret_cast<const char*>(&member) - m_probe, sizeof(T));
+  }
+
+  py::dtype dtype() const {
+    return py::dtype(m_names, m_formats, m_offsets, m_itemsize);
+  }
+
+ private:
+  const char* m_probe = nullptr;
+  size_t m_itemsize = 0;
+  size_t m_end = 0;
+  py::list m_names;
+  py::list m_formats;
+  py::list m_offsets;
+
+  RecordLayout& add(const char* name, const char* format, size_t offset,
+                    size_t size) {
+    m_names.append(name);
+    m_formats.append(format);
+    m_offsets.append(offset);
+    m_end = offset + size;
+    return *this;
+  }
+};
+
+/// Wrap @p n records at @p data into a read-only array without copying
+///
+/// The array references @p base (the Python whiteboard object) but not the
+/// collection itself, which is owned by the whiteboard; the view must not be
+/// used once the event has been processed.
+py::array makeView(const py::dtype& dtype, const void* data, size_t n,
+                   const py::handle& base) {
+  if (n == 0) {
+    return py::array(dtype, {size_t(0)});
+  }
+  py::array view(dtype, {n}, {static_cast<size_t>(dtype.itemsize())}, data,
+                 base);
+  view.attr("setflags")("write"_a = false);
+  return view;
+}
+
+py::dtype simHitDtype() {
+  ActsExamples::SimHit probe(
+      Acts::GeometryIdentifier(0x0123456789abcdef),
+      ActsExamples::SimBarcode().setVertexPrimary(1).setParticle(2),
+      Acts::Vector4(1., 2., 3., 4.), Acts::Vector4(5., 6., 7., 8.),
+      Acts::Vector4(9., 10., 11., 12.), 13);
+  return RecordLayout(probe)
+      .next("geometry_id", "u8", probe.geometryId().value())
+      .next("particle_id", "u8", probe.particleId().value())
+      .next("index", "i4", probe.index())
+      .at("pos4", "(4,)f8", probe.fourPosition())
+      .at("mom4_before", "(4,)f8", probe.momentum4Before())
+      .at("mom4_after", "(4,)f8", probe.momentum4After())
+      .dtype();
+}
+
+py::dtype spacePointDtype() {
+  ActsExamples::SimSpacePoint probe(Acts::Vector3(3., 4., 5.), 6., 7., 8);
+  return RecordLayout(probe)
+      .next("x", "f4", probe.x())
+      .next("y", "f4", probe.y())
+      .next("z", "f4", probe.z())
+      .next("r", "f4", probe.r())
+      .next("var_r", "f4", probe.varianceR())
+      .next("var_z", "f4", probe.varianceZ())
+      .next("measurement_index", "u4", probe.measurementIndex())
+      .dtype();
+}
+
+py::dtype trackParametersDtype(bool withCovariance) {
+  ActsExamples::TrackParameters probe(
+      Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3::Zero()),
+      Acts::BoundVector::Zero(), 1., Acts::BoundSymMatrix::Identity());
+  RecordLayout layout(probe);
+  layout.at("parameters", "(6,)f8", probe.parameters());
+  if (withCovariance) {
+    // symmetric, i.e. the column-major storage can be read row-major
+    layout.at("covariance", "(6,6)f8", *probe.covariance());
+  }
+  return layout.dtype();
+}
+
+}  // namespace
+
+namespace Acts::Python {
+
+void addEventData(Context& ctx) {
+  auto& mex = ctx.get("examples");
+
+  using ActsExamples::WhiteBoard;
+
+  mex.def(
+      "simHitArray",
+      [](const py::object& board, const std::string& name) {
+        const auto& hits =
+            board.cast<const WhiteBoard&>()
+                .get<ActsExamples::SimHitContainer>(name);
+        return makeView(simHitDtype(),
+                        hits.empty() ? nullptr : &*hits.begin(), hits.size(),
+                        board);
+      },
+      py::arg("whiteBoard"), py::arg("name"),
+      "Read-only structured array view of a simulated hit collection");
+
+  mex.def(
+      "spacePointArray",
+      [](const py::object& board, const std::string& name) {
+        const auto& spacePoints =
+            board.cast<const WhiteBoard&>()
+                .get<ActsExamples::SimSpacePointContainer>(name);
+        return makeView(spacePointDtype(), spacePoints.data(),
+                        spacePoints.size(), board);
+      },
+      py::arg("whiteBoard"), py::arg("name"),
+      "Read-only structured array view of a space point collection");
+
+  mex.def(
+      "trackParametersArray",
+      [](const py::object& board, const std::string& name) {
+        const auto& parameters =
+            board.cast<const WhiteBoard&>()
+                .get<ActsExamples::TrackParametersContainer>(name);
+        bool withCovariance = true;
+        for (const auto& params : parameters) {
+          withCovariance = withCovariance and params.covariance().has_value();
+        }
+        return makeView(trackParametersDtype(withCovariance),
+                        parameters.data(), parameters.size(), board);
+      },
+      py::arg("whiteBoard"), py::arg("name"),
+      "Read-only structured array view of a track parameters collection; "
+      "the covariance field is only present if all parameters have one");
+}
+
+}  // namespace Acts::Python
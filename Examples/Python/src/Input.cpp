@@ -9,6 +9,7 @@
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementReader.hpp"
 #include "ActsExamples/Io/Csv/CsvParticleReader.hpp"
+#include "ActsExamples/Io/Csv/CsvPileupOverlayReader.hpp"
 #include "ActsExamples/Io/Csv/CsvPlanarClusterReader.hpp"
 #include "ActsExamples/Io/Csv/CsvSimHitReader.hpp"
 #include "ActsExamples/Io/Csv/CsvSpacePointReader.hpp"
@@ -171,6 +172,33 @@ void addInput(Context& ctx) {
     ACTS_PYTHON_STRUCT_END();
   }
 
+  {
+    using Reader = ActsExamples::CsvPileupOverlayReader;
+    using Config = Reader::Config;
+    auto reader =
+        py::class_<Reader, ActsExamples::IReader, std::shared_ptr<Reader>>(
+            mex, "CsvPileupOverlayReader")
+            .def(py::init<const Config&, Acts::Logging::Level>(),
+                 py::arg("config"), py::arg("level"))
+            .def_property_readonly("config", &Reader::config);
+
+    auto c = py::class_<Config>(reader, "Config").def(py::init<>());
+    ACTS_PYTHON_STRUCT_BEGIN(c, Config);
+    ACTS_PYTHON_MEMBER(inputDir);
+    ACTS_PYTHON_MEMBER(inputParticlesStem);
+    ACTS_PYTHON_MEMBER(inputSimHitsStem);
+    ACTS_PYTHON_MEMBER(inputParticles);
+    ACTS_PYTHON_MEMBER(inputSimHits);
+    ACTS_PYTHON_MEMBER(outputParticles);
+    ACTS_PYTHON_MEMBER(outputSimHits);
+    ACTS_PYTHON_MEMBER(multiplicity);
+    ACTS_PYTHON_MEMBER(vertex);
+    ACTS_PYTHON_MEMBER(randomNumbers);
+    ACTS_PYTHON_MEMBER(trackingGeometry);
+    ACTS_PYTHON_MEMBER(preload);
+    ACTS_PYTHON_STRUCT_END();
+  }
+
   {
     using Reader = ActsExamples::CsvSpacePointReader;
     using Config = Reader::Config;
@@ -9,6 +9,7 @@
 #include "ActsExamples/MagneticField/MagneticField.hpp"
 
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/BinaryBFieldMap.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
@@ -55,6 +56,32 @@ void addMagneticField(Context& ctx) {
              std::shared_ptr<ActsExamples::detail::InterpolatedMagneticField3>>(
       mex, "InterpolatedMagneticField3");
 
+  py::class_<ActsExamples::detail::CompactMagneticField2,
+             Acts::InterpolatedMagneticField, Acts::MagneticFieldProvider,
+             std::shared_ptr<ActsExamples::detail::CompactMagneticField2>>(
+      mex, "CompactMagneticField2");
+
+  py::class_<ActsExamples::detail::CompactMagneticField3,
+             Acts::InterpolatedMagneticField, Acts::MagneticFieldProvider,
+             std::shared_ptr<ActsExamples::detail::CompactMagneticField3>>(
+      mex, "CompactMagneticField3");
+
+  mex.def(
+      "writeBinaryMagneticFieldMap",
+      [](const ActsExamples::detail::InterpolatedMagneticField2& map,
+         const std::string& file) {
+        Acts::BinaryBFieldMap::write(file, map.getGrid());
+      },
+      py::arg("map"), py::arg("file"));
+
+  mex.def(
+      "writeBinaryMagneticFieldMap",
+      [](const ActsExamples::detail::InterpolatedMagneticField3& map,
+         const std::string& file) {
+        Acts::BinaryBFieldMap::write(file, map.getGrid());
+      },
+      py::arg("map"), py::arg("file"));
+
   py::class_<Acts::NullBField, Acts::MagneticFieldProvider,
              std::shared_ptr<Acts::NullBField>>(m, "NullBField")
       .def(py::init<>());
@@ -85,7 +112,8 @@ void addMagneticField(Context& ctx) {
   mex.def(
       "MagneticFieldMapXyz",
       [](std::string filename, std::string tree, double lengthUnit,
-         double BFieldUnit, bool firstOctant) {
+         double BFieldUnit, bool firstOctant)
+          -> std::shared_ptr<Acts::InterpolatedMagneticField> {
         const boost::filesystem::path file = filename;
 
         auto mapBins = [](std::array<size_t, 3> bins,
@@ -100,6 +128,9 @@ void addMagneticField(Context& ctx) {
               firstOctant);
           return std::make_shared<
               ActsExamples::detail::InterpolatedMagneticField3>(std::move(map));
+        } else if (file.extension() == ".actsbf") {
+          return std::make_shared<ActsExamples::detail::CompactMagneticField3>(
+              Acts::BinaryBFieldMap::readXYZ(file.native()));
         } else if (file.extension() == ".txt") {
           auto map = ActsExamples::makeMagneticFieldMapXyzFromText(
               std::move(mapBins), file.native(), lengthUnit, BFieldUnit,
@@ -118,7 +149,8 @@ void addMagneticField(Context& ctx) {
   mex.def(
       "MagneticFieldMapRz",
       [](std::string filename, std::string tree, double lengthUnit,
-         double BFieldUnit, bool firstQuadrant) {
+         double BFieldUnit, bool firstQuadrant)
+          -> std::shared_ptr<Acts::InterpolatedMagneticField> {
         const boost::filesystem::path file = filename;
 
         auto mapBins = [](std::array<size_t, 2> bins,
@@ -132,6 +164,9 @@ void addMagneticField(Context& ctx) {
               firstQuadrant);
           return std::make_shared<
               ActsExamples::detail::InterpolatedMagneticField2>(std::move(map));
+        } else if (file.extension() == ".actsbf") {
+          return std::make_shared<ActsExamples::detail::CompactMagneticField2>(
+              Acts::BinaryBFieldMap::readRZ(file.native()));
         } else if (file.extension() == ".txt") {
           auto map = ActsExamples::makeMagneticFieldMapRzFromText(
               std::move(mapBins), file.native(), lengthUnit, BFieldUnit,
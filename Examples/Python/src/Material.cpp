@@ -6,6 +6,9 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Material/BinaryMaterialDecorator.hpp"
+#include "Acts/Material/BinaryMaterialMap.hpp"
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Material/SurfaceMaterialMapper.hpp"
 #include "Acts/Material/VolumeMaterialMapper.hpp"
@@ -32,6 +35,26 @@ void addMaterial(Context& ctx) {
                                                           "IMaterialDecorator");
   }
 
+  {
+    py::class_<Acts::BinaryMaterialDecorator, Acts::IMaterialDecorator,
+               std::shared_ptr<Acts::BinaryMaterialDecorator>>(
+        m, "BinaryMaterialDecorator")
+        .def(py::init<const std::string&, Acts::Logging::Level, bool, bool>(),
+             py::arg("fileName"), py::arg("level"),
+             py::arg("clearSurfaceMaterial") = true,
+             py::arg("clearVolumeMaterial") = true);
+
+    // converts the material of a geometry decorated from any other format
+    m.def(
+        "writeBinaryMaterialMaps",
+        [](const Acts::TrackingGeometry& tGeometry,
+           const std::string& fileName) {
+          Acts::BinaryMaterialMap::write(
+              fileName, Acts::BinaryMaterialMap::collect(tGeometry));
+        },
+        py::arg("trackingGeometry"), py::arg("fileName"));
+  }
+
   {
     auto rmd =
         py::class_<RootMaterialDecorator, Acts::IMaterialDecorator,
@@ -10,7 +10,13 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/EventCheckpoint.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
@@ -68,6 +74,7 @@ void addUnits(Context& ctx);
 void addLogging(Context& ctx);
 void addPdgParticle(Context& ctx);
 void addAlgebra(Context& ctx);
+void addEventData(Context& ctx);
 
 void addPropagation(Context& ctx);
 
@@ -186,6 +193,7 @@ PYBIND11_MODULE(ActsPythonBindings, m) {
           .def("addAlgorithm", &Sequencer::addAlgorithm, py::keep_alive<1, 2>())
           .def("addReader", &Sequencer::addReader)
           .def("addWriter", &Sequencer::addWriter)
+          .def("addCheckpoint", &Sequencer::addCheckpoint)
           .def_property_readonly("config", &Sequencer::config);
 
   py::class_<Config>(sequencer, "Config")
@@ -195,7 +203,51 @@ PYBIND11_MODULE(ActsPythonBindings, m) {
       .def_readwrite("logLevel", &Config::logLevel)
       .def_readwrite("numThreads", &Config::numThreads)
       .def_readwrite("outputDir", &Config::outputDir)
-      .def_readwrite("outputTimingFile", &Config::outputTimingFile);
+      .def_readwrite("outputTimingFile", &Config::outputTimingFile)
+      .def_readwrite("enableProfiling", &Config::enableProfiling)
+      .def_readwrite("outputProfileFile", &Config::outputProfileFile);
+
+  {
+    using ActsExamples::EventCheckpoint;
+    auto checkpoint =
+        py::class_<EventCheckpoint, std::shared_ptr<EventCheckpoint>>(
+            mex, "EventCheckpoint")
+            .def(py::init<const EventCheckpoint::Config&,
+                          Acts::Logging::Level>(),
+                 py::arg("config"), py::arg("level"))
+            .def("addSimHits",
+                 &EventCheckpoint::addCollection<SimHitContainer>,
+                 py::arg("name"))
+            .def("addSimParticles",
+                 &EventCheckpoint::addCollection<SimParticleContainer>,
+                 py::arg("name"))
+            .def("addSpacePoints",
+                 &EventCheckpoint::addCollection<SimSpacePointContainer>,
+                 py::arg("name"))
+            .def("addProtoTracks",
+                 &EventCheckpoint::addCollection<ProtoTrackContainer>,
+                 py::arg("name"))
+            .def("addHitParticlesMap",
+                 &EventCheckpoint::addCollection<
+                     IndexMultimap<ActsFatras::Barcode>>,
+                 py::arg("name"))
+            .def("addHitSimHitsMap",
+                 &EventCheckpoint::addCollection<IndexMultimap<Index>>,
+                 py::arg("name"))
+            .def("addMeasurements", &EventCheckpoint::addMeasurements,
+                 py::arg("measurements"), py::arg("sourceLinks"))
+            .def_property_readonly("key", &EventCheckpoint::key)
+            .def_property_readonly("config", &EventCheckpoint::config);
+
+    auto c = py::class_<EventCheckpoint::Config>(checkpoint, "Config")
+                 .def(py::init<>());
+    ACTS_PYTHON_STRUCT_BEGIN(c, EventCheckpoint::Config);
+    ACTS_PYTHON_MEMBER(algorithm);
+    ACTS_PYTHON_MEMBER(directory);
+    ACTS_PYTHON_MEMBER(fingerprint);
+    ACTS_PYTHON_MEMBER(randomNumbers);
+    ACTS_PYTHON_STRUCT_END();
+  }
 
   using ActsExamples::RandomNumbers;
   auto randomNumbers =
@@ -213,6 +265,7 @@ PYBIND11_MODULE(ActsPythonBindings, m) {
   addLogging(ctx);
   addPdgParticle(ctx);
   addAlgebra(ctx);
+  addEventData(ctx);
 
   addPropagation(ctx);
   addGeometry(ctx);
@@ -82,6 +82,9 @@ void addPropagation(Context& ctx) {
     ACTS_PYTHON_MEMBER(randomNumberSvc);
     ACTS_PYTHON_MEMBER(mode);
     ACTS_PYTHON_MEMBER(sterileLogger);
+    ACTS_PYTHON_MEMBER(compactStepRecording);
+    ACTS_PYTHON_MEMBER(stepSampling);
+    ACTS_PYTHON_MEMBER(maxStepsPerTrack);
     ACTS_PYTHON_MEMBER(debugOutput);
     ACTS_PYTHON_MEMBER(energyLoss);
     ACTS_PYTHON_MEMBER(multipleScattering);
@@ -172,7 +172,7 @@ def rng():
 
 @pytest.fixture
 def basic_prop_seq(rng):
-    def _basic_prop_seq_factory(geo, s=None):
+    def _basic_prop_seq_factory(geo, s=None, **kwargs):
         if s is None:
             s = acts.examples.Sequencer(events=10, numThreads=1)
 
@@ -187,6 +187,7 @@ def basic_prop_seq(rng):
             ntests=10,
             sterileLogger=False,
             propagationStepCollection="propagation-steps",
+            **kwargs,
         )
         s.addAlgorithm(alg)
         return s, alg
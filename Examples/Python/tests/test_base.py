@@ -58,3 +58,119 @@ def test_constructors():
     print(s1)
     s2 = acts.examples.Sequencer()
     print(s2)
+
+
+def test_sequencer_checkpoint(fatras, rng, tmp_path):
+    from acts.examples import EventCheckpoint, EventDataHook, simHitArray
+
+    with pytest.raises(ValueError):
+        EventCheckpoint(algorithm="alg", level=acts.logging.INFO)
+
+    def run():
+        s = acts.examples.Sequencer(events=3, numThreads=1)
+        evGen, simAlg, digiAlg = fatras(s)
+
+        checkpoint = EventCheckpoint(
+            algorithm=simAlg.name(),
+            directory=str(tmp_path),
+            fingerprint="test",
+            randomNumbers=rng,
+            level=acts.logging.INFO,
+        )
+        checkpoint.addSimHits(simAlg.config.outputSimHits)
+        checkpoint.addSimParticles(simAlg.config.outputParticlesFinal)
+        s.addCheckpoint(checkpoint)
+
+        hits = {}
+
+        def callback(event, arrays):
+            hits[event] = arrays[simAlg.config.outputSimHits].copy()
+
+        s.addAlgorithm(
+            EventDataHook(callback, {simAlg.config.outputSimHits: simHitArray})
+        )
+        s.run()
+        return checkpoint.key, hits
+
+    key, stored = run()
+    assert len(list((tmp_path / key).glob("event*-checkpoint.bin"))) == 3
+
+    restoredKey, restored = run()
+    assert restoredKey == key
+    assert sorted(restored) == sorted(stored) == [0, 1, 2]
+    for event, hits in stored.items():
+        assert len(hits) > 0
+        assert (restored[event] == hits).all()
+
+
+def test_sequencer_profiling(fatras, tmp_path):
+    import csv
+
+    s = acts.examples.Sequencer(
+        events=3, numThreads=1, enableProfiling=True, outputDir=str(tmp_path)
+    )
+    evGen, simAlg, digiAlg = fatras(s)
+    s.run()
+
+    with (tmp_path / "profile.csv").open() as f:
+        rows = list(csv.DictReader(f))
+
+    assert set(rows[0].keys()) == {
+        "event",
+        "identifier",
+        "time_s",
+        "allocations",
+        "allocated_bytes",
+        "peak_rss_increase_bytes",
+        "cycles",
+        "instructions",
+        "cache_misses",
+    }
+    assert sorted({int(r["event"]) for r in rows}) == [0, 1, 2]
+    simRows = [r for r in rows if r["identifier"] == f"Algorithm:{simAlg.name()}"]
+    assert len(simRows) == 3
+    assert all(float(r["time_s"]) > 0 for r in simRows)
+
+
+@pytest.mark.csv
+def test_sequencer_checkpoint_measurements(fatras, rng, tmp_path):
+    from acts.examples import EventCheckpoint, CsvMeasurementWriter
+
+    def run(out):
+        s = acts.examples.Sequencer(events=3, numThreads=1)
+        evGen, simAlg, digiAlg = fatras(s)
+
+        checkpoint = EventCheckpoint(
+            algorithm=digiAlg.name(),
+            directory=str(tmp_path / "checkpoints"),
+            fingerprint="test",
+            randomNumbers=rng,
+            level=acts.logging.INFO,
+        )
+        checkpoint.addSimHits(simAlg.config.outputSimHits)
+        checkpoint.addMeasurements(
+            digiAlg.config.outputMeasurements, digiAlg.config.outputSourceLinks
+        )
+        checkpoint.addHitSimHitsMap(digiAlg.config.outputMeasurementSimHitsMap)
+        s.addCheckpoint(checkpoint)
+
+        out.mkdir()
+        config = CsvMeasurementWriter.Config(
+            inputMeasurements=digiAlg.config.outputMeasurements,
+            inputSimHits=simAlg.config.outputSimHits,
+            inputMeasurementSimHitsMap=digiAlg.config.outputMeasurementSimHitsMap,
+            outputDir=str(out),
+        )
+        s.addWriter(CsvMeasurementWriter(level=acts.logging.INFO, config=config))
+        s.run()
+
+    run(tmp_path / "stored")
+    run(tmp_path / "restored")
+
+    stored = sorted(p.name for p in (tmp_path / "stored").iterdir())
+    assert len(stored) > 0
+    assert stored == sorted(p.name for p in (tmp_path / "restored").iterdir())
+    for name in stored:
+        assert (tmp_path / "stored" / name).read_bytes() == (
+            tmp_path / "restored" / name
+        ).read_bytes()
@@ -0,0 +1,76 @@
+import pytest
+import numpy as np
+
+import acts
+import acts.examples
+from acts.examples import (
+    EventDataHook,
+    ParticleSmearing,
+    Sequencer,
+    simHitArray,
+    trackParametersArray,
+)
+
+
+def test_event_data_views(fatras, rng):
+    s = Sequencer(numThreads=1, events=5)
+    evGen, simAlg, digiAlg = fatras(s)
+
+    s.addAlgorithm(
+        ParticleSmearing(
+            level=acts.logging.INFO,
+            inputParticles=evGen.config.outputParticles,
+            outputTrackParameters="smearedparameters",
+            randomNumbers=rng,
+        )
+    )
+
+    seen = []
+
+    def callback(event, arrays):
+        hits = arrays[simAlg.config.outputSimHits]
+        assert hits.dtype.names == (
+            "geometry_id",
+            "particle_id",
+            "index",
+            "pos4",
+            "mom4_before",
+            "mom4_after",
+        )
+        assert not hits.flags.writeable
+        assert not hits.flags.owndata
+        assert len(hits) > 0
+        assert np.all(hits["geometry_id"] != 0)
+        # hits are sorted by geometry identifier in the container
+        assert np.all(hits["geometry_id"][1:] >= hits["geometry_id"][:-1])
+        assert np.all(np.linalg.norm(hits["pos4"][:, :3], axis=1) > 0)
+
+        params = arrays["smearedparameters"]
+        assert params.dtype.names == ("parameters", "covariance")
+        assert params["parameters"].shape == (len(params), 6)
+        assert params["covariance"].shape == (len(params), 6, 6)
+        assert np.allclose(
+            params["covariance"], np.transpose(params["covariance"], (0, 2, 1))
+        )
+        assert np.all(np.diagonal(params["covariance"], axis1=1, axis2=2) > 0)
+        seen.append(event)
+
+    s.addAlgorithm(
+        EventDataHook(
+            callback,
+            {
+                simAlg.config.outputSimHits: simHitArray,
+                "smearedparameters": trackParametersArray,
+            },
+            level=acts.logging.INFO,
+        )
+    )
+
+    s.run()
+    assert sorted(seen) == list(range(5))
+
+
+def test_event_data_views_missing_collection():
+    wb = acts.examples.WhiteBoard(acts.logging.INFO)
+    with pytest.raises(Exception):
+        simHitArray(wb, "does_not_exist")
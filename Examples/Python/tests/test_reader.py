@@ -26,6 +26,7 @@ from acts.examples import (
     CsvMeasurementReader,
     CsvSimHitWriter,
     CsvSimHitReader,
+    CsvPileupOverlayReader,
     CsvPlanarClusterWriter,
     CsvPlanarClusterReader,
     PlanarSteppingAlgorithm,
@@ -248,6 +249,126 @@ def test_csv_simhits_reader(tmp_path, fatras, conf_const):
     assert alg.events_seen == 10
 
 
+def _write_minbias_library(out, trk_geo, rng, nVertices):
+    s = Sequencer(numThreads=1, events=10)
+    evGen = acts.examples.EventGenerator(
+        level=acts.logging.INFO,
+        generators=[
+            acts.examples.EventGenerator.Generator(
+                multiplicity=acts.examples.FixedMultiplicityGenerator(n=nVertices),
+                vertex=acts.examples.GaussianVertexGenerator(
+                    stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
+                ),
+                particles=acts.examples.ParametricParticleGenerator(
+                    p=(1 * acts.UnitConstants.GeV, 10 * acts.UnitConstants.GeV),
+                    eta=(-2, 2),
+                    randomizeCharge=True,
+                    numParticles=4,
+                ),
+            )
+        ],
+        outputParticles="particles_input",
+        randomNumbers=rng,
+    )
+    s.addReader(evGen)
+    simAlg = acts.examples.FatrasSimulation(
+        level=acts.logging.INFO,
+        inputParticles=evGen.config.outputParticles,
+        outputParticlesInitial="particles_initial",
+        outputParticlesFinal="particles_final",
+        outputSimHits="simhits",
+        randomNumbers=rng,
+        trackingGeometry=trk_geo,
+        magneticField=acts.ConstantBField(
+            acts.Vector3(0, 0, 2 * acts.UnitConstants.T)
+        ),
+        generateHitsOnSensitive=True,
+    )
+    s.addAlgorithm(simAlg)
+
+    out.mkdir()
+    s.addWriter(
+        CsvParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles=simAlg.config.outputParticlesInitial,
+            outputDir=str(out),
+            outputStem="particles_initial",
+        )
+    )
+    s.addWriter(
+        CsvSimHitWriter(
+            level=acts.logging.INFO,
+            inputSimHits=simAlg.config.outputSimHits,
+            outputDir=str(out),
+            outputStem="hits",
+        )
+    )
+
+    s.run()
+
+
+@pytest.mark.csv
+def test_csv_pileup_overlay_reader(tmp_path, ptcl_gun, conf_const, trk_geo, rng):
+    # write a small minimum-bias library first
+    out = tmp_path / "csv"
+    _write_minbias_library(out, trk_geo, rng, nVertices=1)
+
+    s = Sequencer(numThreads=1, events=10)
+    evGen = ptcl_gun(s)
+
+    s.addReader(
+        conf_const(
+            CsvPileupOverlayReader,
+            level=acts.logging.INFO,
+            inputDir=str(out),
+            inputParticles=evGen.config.outputParticles,
+            outputParticles="particles_overlay",
+            outputSimHits="simhits_overlay",
+            multiplicity=acts.examples.PoissonMultiplicityGenerator(mean=5),
+            vertex=acts.examples.GaussianVertexGenerator(
+                stddev=acts.Vector4(0, 0, 50 * acts.UnitConstants.mm, 0),
+                mean=acts.Vector4(0, 0, 0, 0),
+            ),
+            randomNumbers=rng,
+            trackingGeometry=trk_geo,
+        )
+    )
+
+    algs = [
+        AssertCollectionExistsAlg(k, f"check_alg_{k}", acts.logging.WARNING)
+        for k in ("particles_overlay", "simhits_overlay")
+    ]
+    for alg in algs:
+        s.addAlgorithm(alg)
+
+    s.run()
+
+    for alg in algs:
+        assert alg.events_seen == 10
+
+
+@pytest.mark.csv
+def test_csv_pileup_overlay_reader_multiple_vertices(tmp_path, trk_geo, rng):
+    # library events with more than one primary vertex are rejected
+    out = tmp_path / "csv"
+    _write_minbias_library(out, trk_geo, rng, nVertices=2)
+
+    with pytest.raises(RuntimeError):
+        CsvPileupOverlayReader(
+            level=acts.logging.INFO,
+            inputDir=str(out),
+            outputParticles="particles_overlay",
+            outputSimHits="simhits_overlay",
+            multiplicity=acts.examples.FixedMultiplicityGenerator(n=1),
+            vertex=acts.examples.GaussianVertexGenerator(
+                stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
+            ),
+            randomNumbers=rng,
+            trackingGeometry=trk_geo,
+            preload=True,
+        )
+
+
 @pytest.mark.csv
 def test_csv_clusters_reader(tmp_path, fatras, conf_const, trk_geo, rng):
     s = Sequencer(numThreads=1, events=10)  # we're not going to use this one
@@ -43,6 +43,7 @@ from acts.examples import (
     CsvMultiTrajectoryWriter,
     CsvTrackingGeometryWriter,
     CsvMeasurementWriter,
+    CsvPropagationStepsWriter,
     PlanarSteppingAlgorithm,
     JsonMaterialWriter,
     JsonFormat,
@@ -76,6 +77,30 @@ def test_obj_propagation_step_writer(tmp_path, trk_geo, conf_const, basic_prop_s
         assert f.stat().st_size > 1024
 
 
+@pytest.mark.csv
+def test_csv_propagation_step_writer(tmp_path, trk_geo, conf_const, basic_prop_seq):
+    with pytest.raises(TypeError):
+        CsvPropagationStepsWriter()
+
+    out = tmp_path / "csv"
+    out.mkdir()
+
+    s, alg = basic_prop_seq(trk_geo, compactStepRecording=True, stepSampling=2)
+    w = conf_const(
+        CsvPropagationStepsWriter,
+        acts.logging.INFO,
+        collection=alg.config.propagationStepCollection,
+        outputDir=str(out),
+    )
+
+    s.addWriter(w)
+
+    s.run()
+
+    assert len([f for f in out.iterdir() if f.is_file()]) == s.config.events
+    assert all(f.stat().st_size > 1024 for f in out.iterdir())
+
+
 @pytest.mark.csv
 def test_csv_particle_writer(tmp_path, conf_const, ptcl_gun):
     s = Sequencer(numThreads=1, events=10)
@@ -55,6 +55,9 @@ void ActsExamples::Options::addSequencerOptions(
       "The number of events to skip")("jobs,j", value<int>()->default_value(-1),
                                       "Number of parallel jobs, negative for "
                                       "automatic.");
+  opt.add_options()("profile", value<bool>()->default_value(false),
+                    "Record the resource usage of each algorithm and event "
+                    "in profile.csv in the output directory.");
 }
 
 void ActsExamples::Options::addRandomNumbersOptions(
@@ -206,6 +209,7 @@ ActsExamples::Sequencer::Config ActsExamples::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.enableProfiling = vm["profile"].as<bool>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
@@ -0,0 +1,161 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Reconstructed tracks from a number of vertices along the beam line.
+///
+/// The tracks are expressed at a perigee surface at the origin. The impact
+/// parameters are those of straight tracks from the vertex, smeared with
+/// typical resolutions that are also used as covariance.
+std::vector<BoundTrackParameters> generateTracks(Test::StableRandom& rnd,
+                                                 size_t nVertices,
+                                                 size_t nTracksPerVertex) {
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 30_um;
+  stddev[eBoundLoc1] = 50_um;
+  stddev[eBoundPhi] = 1_mrad;
+  stddev[eBoundTheta] = 1_mrad;
+  stddev[eBoundQOverP] = 0.01 / 1_GeV;
+  stddev[eBoundTime] = 1_ns;
+  BoundSymMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  std::vector<BoundTrackParameters> tracks;
+  for (size_t iv = 0; iv < nVertices; ++iv) {
+    Vector3 vertex(rnd.gauss(0., 10_um), rnd.gauss(0., 10_um),
+                   rnd.gauss(0., 50_mm));
+    // vary the multiplicity around the mean
+    size_t nTracks = nTracksPerVertex / 2 + rnd.index(nTracksPerVertex + 1);
+    for (size_t it = 0; it < nTracks; ++it) {
+      double phi = rnd.uniform(-M_PI, M_PI);
+      double theta = 2 * std::atan(std::exp(-rnd.uniform(-2.5, 2.5)));
+      double q = (rnd.uniform(0., 1.) < 0.5) ? -1. : 1.;
+      double p = rnd.uniform(0.5_GeV, 10_GeV);
+
+      BoundVector params;
+      params[eBoundLoc0] = -vertex.x() * std::sin(phi) +
+                           vertex.y() * std::cos(phi) +
+                           rnd.gauss(0., stddev[eBoundLoc0]);
+      params[eBoundLoc1] = vertex.z() + rnd.gauss(0., stddev[eBoundLoc1]);
+      params[eBoundPhi] = phi + rnd.gauss(0., stddev[eBoundPhi]);
+      params[eBoundTheta] = theta + rnd.gauss(0., stddev[eBoundTheta]);
+      params[eBoundQOverP] = q / p + rnd.gauss(0., stddev[eBoundQOverP]);
+      params[eBoundTime] = 0.;
+      tracks.emplace_back(perigee, params, q, cov);
+    }
+  }
+  return tracks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nVertices = 0;
+  size_t nTracksPerVertex = 0;
+
+  po::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ("vertices", po::value<size_t>(&nVertices)->default_value(50), "number of vertices per event")
+      ("tracks-per-vertex", po::value<size_t>(&nTracksPerVertex)->default_value(20), "mean number of tracks per vertex");
+  // clang-format on
+  Test::BenchmarkOptions opts;
+  if (auto exitCode = Test::parseBenchmarkOptions(argc, argv, desc, opts)) {
+    return *exitCode;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("AdaptiveMultiVertexFinder", opts.level));
+
+  Test::MicroBenchmarkCsvWriter csv(opts.output);
+
+  Test::StableRandom rnd(opts.seed);
+  auto tracks = generateTracks(rnd, nVertices, nTracksPerVertex);
+  std::vector<const BoundTrackParameters*> trackPtrs;
+  for (const auto& trk : tracks) {
+    trackPtrs.push_back(&trk);
+  }
+  ACTS_INFO("Generated " << tracks.size() << " tracks from " << nVertices
+                         << " vertices");
+
+  // same setup as in the vertex finding example
+  using Propagator = Acts::Propagator<EigenStepper<>>;
+  using IPEstimator = ImpactPointEstimator<BoundTrackParameters, Propagator>;
+  using Linearizer = HelicalTrackLinearizer<Propagator>;
+  using Fitter = AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>;
+  using SeedFinder =
+      TrackDensityVertexFinder<Fitter,
+                               GaussianTrackDensity<BoundTrackParameters>>;
+  using Finder = AdaptiveMultiVertexFinder<Fitter, SeedFinder>;
+
+  auto bField = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+  auto propagator = std::make_shared<Propagator>(EigenStepper<>(bField));
+
+  IPEstimator::Config ipEstimatorCfg(bField, propagator);
+  IPEstimator ipEstimator(ipEstimatorCfg);
+
+  std::vector<double> temperatures{8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0};
+  AnnealingUtility::Config annealingConfig(temperatures);
+  AnnealingUtility annealingUtility(annealingConfig);
+
+  Fitter::Config fitterCfg(ipEstimator);
+  fitterCfg.annealingTool = annealingUtility;
+  Fitter fitter(fitterCfg);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  SeedFinder seedFinder;
+  Finder::Config finderConfig(std::move(fitter), seedFinder, ipEstimator,
+                              linearizer, bField);
+  finderConfig.useBeamSpotConstraint = false;
+  Finder finder(finderConfig);
+
+  GeometryContext geoCtx;
+  MagneticFieldContext magCtx;
+  VertexingOptions<BoundTrackParameters> vertexingOptions(geoCtx, magCtx);
+
+  size_t nFound = 0;
+  const auto result = Test::microBenchmark(
+      [&] {
+        Finder::State state;
+        auto vertices = finder.find(trackPtrs, vertexingOptions, state);
+        nFound = vertices.ok() ? vertices.value().size() : 0;
+        return nFound;
+      },
+      1, opts.runs, opts.warmup);
+  ACTS_INFO("AdaptiveMultiVertexFinder: " << result);
+  ACTS_INFO("Found " << nFound << " vertices per event");
+  csv.write("AdaptiveMultiVertexFinder", result);
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+namespace Acts {
+namespace Test {
+
+/// Command line options shared by the reconstruction benchmarks.
+struct BenchmarkOptions {
+  /// Number of timed runs per benchmark; at least two for the error estimate
+  size_t runs = 20;
+  /// Warm-up time before the timed runs
+  std::chrono::milliseconds warmup{500};
+  /// Seed of the synthetic inputs
+  uint64_t seed = 42;
+  /// Optional csv file for the results
+  std::string output;
+  Acts::Logging::Level level = Acts::Logging::INFO;
+};
+
+/// Parse the common options plus benchmark-specific ones.
+///
+/// @param desc Benchmark-specific options, extended in place
+/// @return exit code if the program should stop, e.g. after `--help`
+inline std::optional<int> parseBenchmarkOptions(
+    int argc, char* argv[], boost::program_options::options_description& desc,
+    BenchmarkOptions& opts) {
+  namespace po = boost::program_options;
+
+  size_t warmup = opts.warmup.count();
+  unsigned int lvl = opts.level;
+  // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("runs", po::value<size_t>(&opts.runs)->default_value(opts.runs), "number of timed runs")
+      ("warmup", po::value<size_t>(&warmup)->default_value(warmup), "warm-up time in milliseconds")
+      ("seed", po::value<uint64_t>(&opts.seed)->default_value(opts.seed), "seed of the synthetic inputs")
+      ("output", po::value<std::string>(&opts.output), "write the results to this csv file")
+      ("verbose", po::value<unsigned int>(&lvl)->default_value(lvl), "logging level");
+  // clang-format on
+  try {
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+  if (opts.runs < 2) {
+    std::cerr << "error: at least two runs are required" << std::endl;
+    return 1;
+  }
+  opts.warmup = std::chrono::milliseconds(warmup);
+  opts.level = Acts::Logging::Level(lvl);
+  return std::nullopt;
+}
+
+/// Random numbers that are identical on all platforms.
+///
+/// The output of `std::mt19937_64` is fixed by the standard, but the standard
+/// distributions are implementation-defined. The conversions are therefore
+/// done explicitly so that the synthetic inputs, and thus the benchmarked
+/// work, do not depend on the standard library.
+class StableRandom {
+ public:
+  explicit StableRandom(uint64_t seed) : m_engine(seed) {}
+
+  /// Uniform in [min, max)
+  double uniform(double min, double max) {
+    // use the upper 53 bits to fill the double mantissa
+    double u = (m_engine() >> 11) * 0x1.0p-53;
+    return min + u * (max - min);
+  }
+
+  /// Normal distribution using the Box-Muller transform
+  double gauss(double mean, double stddev) {
+    double u1 = 1. - uniform(0., 1.);
+    double u2 = uniform(0., 1.);
+    return mean +
+           stddev * std::sqrt(-2. * std::log(u1)) * std::cos(2. * M_PI * u2);
+  }
+
+  /// Uniform integer in [0, n)
+  uint64_t index(uint64_t n) { return m_engine() % n; }
+
+  /// Direct access to the engine, e.g. to seed other generators
+  std::mt19937_64& engine() { return m_engine; }
+
+ private:
+  std::mt19937_64 m_engine;
+};
+
+}  // namespace Test
+}  // namespace Acts
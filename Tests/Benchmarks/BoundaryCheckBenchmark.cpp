@@ -118,6 +118,23 @@ int main(int /*argc*/, char** /*argv[]*/) {
     run_bench_with_inputs(
         [&](const auto& point) { return check.isInside(point, poly); }, points,
         "Random");
+
+    // The same random points, checked in one batch
+    BoundaryCheck::LocalPositions batch(points.size(), 2);
+    for (size_t i = 0; i < points.size(); ++i) {
+      batch.row(i) = points[i].transpose();
+    }
+    BoundaryCheck::InsideMask inside;
+    const int num_batch_iters = std::max(1, num_inside_points / 100);
+    auto batch_result = Acts::Test::microBenchmark(
+        [&] {
+          check.isInside(batch, poly, inside);
+          return inside.count();
+        },
+        num_batch_iters);
+    std::cout << "- Random batch: "
+              << batch_result.iterTimeAverage().count() / points.size()
+              << "ns per point" << std::endl;
   };
 
   // Benchmark scenarios
@@ -0,0 +1,156 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Clusterization/Clusterization.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+namespace {
+
+struct Cell {
+  int row = 0;
+  int col = 0;
+  Ccl::Label label = Ccl::NO_LABEL;
+};
+
+int getCellRow(const Cell& cell) {
+  return cell.row;
+}
+
+int getCellColumn(const Cell& cell) {
+  return cell.col;
+}
+
+Ccl::Label& getCellLabel(Cell& cell) {
+  return cell.label;
+}
+
+using Cluster = std::vector<Cell>;
+using Module = std::vector<Cell>;
+
+void clusterAddCell(Cluster& cl, const Cell& cell) {
+  cl.push_back(cell);
+}
+
+/// Pixel modules with particle clusters and noise.
+///
+/// Each cluster partially fills a small rectangle whose size mimics tracks
+/// with different incidence angles. Overlapping clusters are merged, i.e.
+/// each cell appears only once.
+std::vector<Module> generateModules(Test::StableRandom& rnd, size_t nModules,
+                                    size_t nClustersPerModule) {
+  constexpr int kRows = 336;
+  constexpr int kColumns = 160;
+  constexpr double kFillProbability = 0.8;
+  constexpr double kNoiseOccupancy = 1e-4;
+
+  std::vector<Module> modules;
+  modules.reserve(nModules);
+  for (size_t im = 0; im < nModules; ++im) {
+    std::set<std::pair<int, int>> hit;
+    Module cells;
+    auto addCell = [&](int row, int col) {
+      if (0 <= row and row < kRows and 0 <= col and col < kColumns and
+          hit.emplace(row, col).second) {
+        cells.push_back({row, col, Ccl::NO_LABEL});
+      }
+    };
+
+    size_t nClusters = rnd.index(2 * nClustersPerModule + 1);
+    for (size_t ic = 0; ic < nClusters; ++ic) {
+      int row0 = rnd.index(kRows);
+      int col0 = rnd.index(kColumns);
+      int nRows = 1 + rnd.index(5);
+      int nCols = 1 + rnd.index(3);
+      addCell(row0, col0);
+      for (int dr = 0; dr < nRows; ++dr) {
+        for (int dc = 0; dc < nCols; ++dc) {
+          if (rnd.uniform(0., 1.) < kFillProbability) {
+            addCell(row0 + dr, col0 + dc);
+          }
+        }
+      }
+    }
+    size_t nNoise = kNoiseOccupancy * kRows * kColumns;
+    for (size_t in = 0; in < nNoise; ++in) {
+      addCell(rnd.index(kRows), rnd.index(kColumns));
+    }
+    modules.push_back(std::move(cells));
+  }
+  return modules;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nModules = 0;
+  size_t nClustersPerModule = 0;
+
+  po::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ("modules", po::value<size_t>(&nModules)->default_value(1000), "number of modules per event")
+      ("clusters-per-module", po::value<size_t>(&nClustersPerModule)->default_value(10), "mean number of clusters per module");
+  // clang-format on
+  Test::BenchmarkOptions opts;
+  if (auto exitCode = Test::parseBenchmarkOptions(argc, argv, desc, opts)) {
+    return *exitCode;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Clusterization", opts.level));
+
+  Test::MicroBenchmarkCsvWriter csv(opts.output);
+
+  Test::StableRandom rnd(opts.seed);
+  const auto modules = generateModules(rnd, nModules, nClustersPerModule);
+  size_t nCells = 0;
+  for (const auto& cells : modules) {
+    nCells += cells.size();
+  }
+  ACTS_INFO("Generated " << nCells << " cells in " << nModules << " modules");
+
+  // the cells are modified by the clusterization and are copied for each
+  // module, as the example algorithm does when converting the input cells
+  for (bool conn8 : {true, false}) {
+    const auto result = Test::microBenchmark(
+        [&](const Module& cells) {
+          Module input = cells;
+          return Ccl::createClusters<Module, std::vector<Cluster>>(
+                     input, Ccl::DefaultConnect<Cell>(conn8))
+              .size();
+        },
+        modules, opts.runs, opts.warmup);
+    std::string name = conn8 ? "Ccl::createClusters/8-connectivity"
+                             : "Ccl::createClusters/4-connectivity";
+    ACTS_INFO(name << ": " << result);
+    csv.write(name, result);
+  }
+
+  const auto batchResult = Test::microBenchmark(
+      [&] {
+        auto input = modules;
+        return Ccl::createClustersBatch<std::vector<Module>,
+                                        std::vector<Cluster>>(input)
+            .size();
+      },
+      1, opts.runs, opts.warmup);
+  ACTS_INFO("Ccl::createClustersBatch: " << batchResult);
+  csv.write("Ccl::createClustersBatch", batchResult);
+
+  return 0;
+}
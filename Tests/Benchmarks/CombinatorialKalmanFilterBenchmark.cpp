@@ -0,0 +1,152 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+#include "TrackingBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+namespace {
+
+using SourceLinkContainer =
+    std::unordered_multimap<GeometryIdentifier, Test::TestSourceLink>;
+
+// Source link access by surface
+struct SourceLinkAccessor {
+  // dereferences to the source link instead of the map entry
+  struct Iterator {
+    using BaseIterator = SourceLinkContainer::const_iterator;
+
+    using iterator_category = BaseIterator::iterator_category;
+    using value_type = BaseIterator::value_type;
+    using difference_type = BaseIterator::difference_type;
+    using pointer = BaseIterator::pointer;
+    using reference = BaseIterator::reference;
+
+    Iterator& operator++() {
+      ++m_iterator;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return m_iterator == other.m_iterator;
+    }
+
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    const Test::TestSourceLink& operator*() const { return m_iterator->second; }
+
+    BaseIterator m_iterator;
+  };
+
+  const SourceLinkContainer* container = nullptr;
+
+  std::pair<Iterator, Iterator> range(const Surface& surface) const {
+    auto [begin, end] = container->equal_range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nTracks = 0;
+
+  po::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ("tracks", po::value<size_t>(&nTracks)->default_value(100), "number of tracks per event");
+  // clang-format on
+  Test::BenchmarkOptions opts;
+  if (auto exitCode = Test::parseBenchmarkOptions(argc, argv, desc, opts)) {
+    return *exitCode;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("CombinatorialKalmanFilter", opts.level));
+
+  Test::MicroBenchmarkCsvWriter csv(opts.output);
+
+  // all tracks form a single event, i.e. the measurements of the other tracks
+  // are candidates as well
+  Test::TrackingBenchmarkDetector detector;
+  Test::StableRandom rnd(opts.seed);
+  auto startParameters = Test::generateStartParameters(rnd, nTracks);
+  SourceLinkContainer sourceLinks;
+  for (auto& measurements :
+       Test::generateMeasurements(detector, rnd, startParameters)) {
+    for (auto& sl : measurements.sourceLinks) {
+      sourceLinks.emplace(sl.geometryId(), std::move(sl));
+    }
+  }
+  ACTS_INFO("Generated " << sourceLinks.size() << " measurements for "
+                         << nTracks << " tracks");
+
+  using Propagator = Acts::Propagator<EigenStepper<>, Navigator>;
+  CombinatorialKalmanFilter<Propagator> ckf(
+      detector.makePropagator<EigenStepper<>>());
+
+  // selection as in the track finding example
+  MeasurementSelector::Config selectorConfig = {
+      {GeometryIdentifier(), {{}, {15.}, {10u}}},
+  };
+  MeasurementSelector measurementSelector(selectorConfig);
+  GainMatrixUpdater kfUpdater;
+  GainMatrixSmoother kfSmoother;
+  CombinatorialKalmanFilterExtensions extensions;
+  extensions.calibrator.connect<&Test::testSourceLinkCalibrator>();
+  extensions.updater.connect<&GainMatrixUpdater::operator()>(&kfUpdater);
+  extensions.smoother.connect<&GainMatrixSmoother::operator()>(&kfSmoother);
+  extensions.measurementSelector.connect<&MeasurementSelector::select>(
+      &measurementSelector);
+
+  SourceLinkAccessor slAccessor;
+  slAccessor.container = &sourceLinks;
+  SourceLinkAccessorDelegate<SourceLinkAccessor::Iterator> slAccessorDelegate;
+  slAccessorDelegate.connect<&SourceLinkAccessor::range>(&slAccessor);
+
+  // the finder logger is kept quiet independent of the benchmark output
+  auto finderLogger = getDefaultLogger("Finder", Logging::WARNING);
+  CombinatorialKalmanFilterOptions<SourceLinkAccessor::Iterator> options(
+      detector.geoCtx, detector.magCtx, detector.calCtx, slAccessorDelegate,
+      extensions, LoggerWrapper{*finderLogger}, PropagatorPlainOptions(),
+      detector.perigee.get());
+
+  size_t nFound = 0;
+  const auto result = Test::microBenchmark(
+      [&] {
+        auto results = ckf.findTracks(startParameters, options);
+        nFound = 0;
+        for (auto& res : results) {
+          if (res.ok()) {
+            nFound += res.value().lastMeasurementIndices.size();
+          }
+        }
+        return nFound;
+      },
+      1, opts.runs, opts.warmup);
+  ACTS_INFO("CombinatorialKalmanFilter: " << result);
+  ACTS_INFO("Found " << nFound << " tracks per event");
+  csv.write("CombinatorialKalmanFilter", result);
+
+  return 0;
+}
@@ -10,6 +10,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Propagator/CovarianceTransport.hpp"
+#include "Acts/Propagator/detail/JacobianEngine.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -89,4 +90,52 @@ int main(int argc, char* argv[]) {
       iterations, runs);
 
   ACTS_INFO("Execution stats: " << cov_transport_bound_bound);
+
+  // A non-trivial transport jacobian and path derivatives, as they would
+  // be accumulated by a stepper
+  FreeMatrix freeTransportJacobian = FreeMatrix::Identity();
+  freeTransportJacobian.block<3, 3>(eFreePos0, eFreeDir0) =
+      0.3 * ActsMatrix<3, 3>::Random();
+  freeTransportJacobian.block<3, 1>(eFreePos0, eFreeQOverP).setRandom();
+  freeTransportJacobian.block<3, 1>(eFreeDir0, eFreeQOverP).setRandom();
+  freeTransportJacobian(eFreeTime, eFreeQOverP) = 0.1;
+  FreeVector freeToPathDerivatives = FreeVector::Random();
+  const BoundToFreeMatrix boundToFreeJacobian =
+      planeSurface->boundToFreeJacobian(tgContext, boundParameters);
+
+  // The full jacobian as a plain product of the dense matrices, for reference
+  const auto jacobian_bound_bound_dense = Acts::Test::microBenchmark(
+      [&] {
+        const FreeToPathMatrix freeToPath =
+            otherSurface->freeToPathDerivative(tgContext, freeParameters);
+        const FreeToBoundMatrix freeToBoundJacobian =
+            otherSurface->freeToBoundJacobian(tgContext, freeParameters);
+        return BoundMatrix(
+            freeToBoundJacobian *
+            (FreeMatrix::Identity() + freeToPathDerivatives * freeToPath) *
+            freeTransportJacobian * boundToFreeJacobian);
+      },
+      iterations, runs);
+
+  ACTS_INFO("Bound to bound jacobian, dense: " << jacobian_bound_bound_dense);
+
+  const auto jacobian_bound_bound = Acts::Test::microBenchmark(
+      [&] {
+        return detail::boundToBoundTransportJacobian(
+            tgContext, freeParameters, boundToFreeJacobian,
+            freeTransportJacobian, freeToPathDerivatives, *otherSurface);
+      },
+      iterations, runs);
+
+  ACTS_INFO("Bound to bound jacobian: " << jacobian_bound_bound);
+
+  const auto jacobian_bound_curvilinear = Acts::Test::microBenchmark(
+      [&] {
+        return detail::boundToCurvilinearTransportJacobian(
+            direction, boundToFreeJacobian, freeTransportJacobian,
+            freeToPathDerivatives);
+      },
+      iterations, runs);
+
+  ACTS_INFO("Bound to curvilinear jacobian: " << jacobian_bound_curvilinear);
 }
@@ -0,0 +1,99 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/GaussianSumFitter.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+#include "TrackingBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+int main(int argc, char* argv[]) {
+  size_t nTracks = 0;
+  size_t maxComponents = 0;
+
+  po::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ("tracks", po::value<size_t>(&nTracks)->default_value(20), "number of fitted tracks per run")
+      ("components", po::value<size_t>(&maxComponents)->default_value(12), "maximum number of components");
+  // clang-format on
+  Test::BenchmarkOptions opts;
+  if (auto exitCode = Test::parseBenchmarkOptions(argc, argv, desc, opts)) {
+    return *exitCode;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("GaussianSumFitter", opts.level));
+
+  Test::MicroBenchmarkCsvWriter csv(opts.output);
+
+  Test::TrackingBenchmarkDetector detector;
+  Test::StableRandom rnd(opts.seed);
+  auto startParameters = Test::generateStartParameters(rnd, nTracks);
+  auto measurements =
+      Test::generateMeasurements(detector, rnd, startParameters);
+  size_t nMeasurements = 0;
+  for (const auto& m : measurements) {
+    nMeasurements += m.sourceLinks.size();
+  }
+  ACTS_INFO("Generated " << nMeasurements << " measurements for " << nTracks
+                         << " tracks");
+
+  using Stepper = MultiEigenStepperLoop<>;
+  using Propagator = Acts::Propagator<Stepper, Navigator>;
+  GaussianSumFitter<Propagator> fitter(detector.makePropagator<Stepper>());
+
+  GainMatrixUpdater kfUpdater;
+  GsfExtensions extensions;
+  extensions.calibrator.connect<&Test::testSourceLinkCalibrator>();
+  extensions.updater.connect<&GainMatrixUpdater::operator()>(&kfUpdater);
+
+  // the fitter logger is kept quiet independent of the benchmark output
+  auto fitterLogger = getDefaultLogger("Fitter", Logging::WARNING);
+  GsfOptions options{detector.geoCtx,
+                     detector.magCtx,
+                     detector.calCtx,
+                     extensions,
+                     LoggerWrapper{*fitterLogger},
+                     PropagatorPlainOptions()};
+  options.referenceSurface = detector.perigee.get();
+  options.maxComponents = maxComponents;
+
+  std::vector<size_t> trackIndices;
+  for (size_t it = 0; it < nTracks; ++it) {
+    trackIndices.push_back(it);
+  }
+
+  size_t nFailures = 0;
+  const auto result = Test::microBenchmark(
+      [&](size_t it) {
+        const auto& sourceLinks = measurements[it].sourceLinks;
+        auto res = fitter.fit(sourceLinks.begin(), sourceLinks.end(),
+                              startParameters[it], options);
+        nFailures += not res.ok();
+        return res.ok();
+      },
+      trackIndices, opts.runs, opts.warmup);
+  ACTS_INFO("GaussianSumFitter: " << result);
+  if (nFailures != 0) {
+    ACTS_WARNING(nFailures << " fits failed");
+  }
+  csv.write("GaussianSumFitter", result);
+
+  return 0;
+}
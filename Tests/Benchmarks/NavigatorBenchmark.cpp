@@ -0,0 +1,77 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+#include "TrackingBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+int main(int argc, char* argv[]) {
+  size_t nTracks = 0;
+
+  po::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ("tracks", po::value<size_t>(&nTracks)->default_value(1000), "number of propagated tracks per run");
+  // clang-format on
+  Test::BenchmarkOptions opts;
+  if (auto exitCode = Test::parseBenchmarkOptions(argc, argv, desc, opts)) {
+    return *exitCode;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Navigator", opts.level));
+
+  Test::MicroBenchmarkCsvWriter csv(opts.output);
+
+  Test::TrackingBenchmarkDetector detector;
+  Test::StableRandom rnd(opts.seed);
+  auto startParameters = Test::generateStartParameters(rnd, nTracks);
+
+  // propagate through the full detector; the straight line stepper keeps the
+  // stepping cheap so that the navigation dominates
+  using Options = PropagatorOptions<ActionList<>, AbortList<EndOfWorldReached>>;
+  Options options(detector.geoCtx, detector.magCtx, getDummyLogger());
+
+  auto run = [&](const auto& propagator, const std::string& name) {
+    size_t nSteps = 0;
+    for (const auto& start : startParameters) {
+      auto res = propagator.propagate(start, options);
+      nSteps += res.ok() ? res.value().steps : 0;
+    }
+    ACTS_INFO(name << " steps per track: "
+                   << static_cast<double>(nSteps) / nTracks);
+
+    const auto result = Test::microBenchmark(
+        [&](const CurvilinearTrackParameters& start) {
+          return propagator.propagate(start, options).ok();
+        },
+        startParameters, opts.runs, opts.warmup);
+    ACTS_INFO(name << ": " << result);
+    csv.write(name, result);
+  };
+
+  Propagator<StraightLineStepper, Navigator> straightPropagator(
+      StraightLineStepper(), detector.makeNavigator());
+  run(straightPropagator, "Navigator/StraightLineStepper");
+  run(detector.makePropagator<EigenStepper<>>(), "Navigator/EigenStepper");
+
+  return 0;
+}
@@ -0,0 +1,259 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonal.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+struct SpacePoint {
+  float m_x;
+  float m_y;
+  float m_z;
+  float m_varianceR;
+  float m_varianceZ;
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+  float r() const { return std::hypot(m_x, m_y); }
+  float varianceR() const { return m_varianceR; }
+  float varianceZ() const { return m_varianceZ; }
+};
+
+// pixel barrel layers of the cylindrical test detector
+const std::vector<double> kLayerRadii = {32_mm, 72_mm, 116_mm, 172_mm};
+constexpr double kLayerHalfZ = 490_mm;
+constexpr double kBz = 2_T;
+
+/// Space points of a ttbar-like event with pile-up in the pixel barrel.
+///
+/// Most particles follow a soft, exponentially falling transverse momentum
+/// spectrum, a small fraction are hard particles with a flat spectrum in
+/// log(pT). Hits are the exact helix intersections with the layers plus a
+/// fraction of uniformly distributed noise hits.
+std::vector<SpacePoint> generateSpacePoints(Test::StableRandom& rnd,
+                                            size_t nParticles,
+                                            double noiseFraction) {
+  constexpr double varianceR = 0.01_mm * 0.01_mm;
+  constexpr double varianceZ = 0.05_mm * 0.05_mm;
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nParticles * kLayerRadii.size());
+  for (size_t ip = 0; ip < nParticles; ++ip) {
+    double pt = (rnd.uniform(0., 1.) < 0.1)
+                    ? std::exp(rnd.uniform(std::log(1_GeV), std::log(50_GeV)))
+                    : 0.4_GeV - 0.6_GeV * std::log(1. - rnd.uniform(0., 1.));
+    double eta = rnd.uniform(-2.5, 2.5);
+    double phi0 = rnd.uniform(-M_PI, M_PI);
+    double q = (rnd.uniform(0., 1.) < 0.5) ? -1. : 1.;
+    double z0 = rnd.gauss(0., 50_mm);
+    // helix radius in the transverse plane in native units
+    double rho = pt / kBz;
+    double cotTheta = std::sinh(eta);
+
+    for (double radius : kLayerRadii) {
+      if (2 * rho <= radius) {
+        break;
+      }
+      double turn = std::asin(radius / (2 * rho));
+      double phi = phi0 - q * turn;
+      double z = z0 + 2 * rho * turn * cotTheta;
+      if (kLayerHalfZ < std::abs(z)) {
+        break;
+      }
+      spacePoints.push_back(
+          {static_cast<float>(radius * std::cos(phi)),
+           static_cast<float>(radius * std::sin(phi)),
+           static_cast<float>(z + rnd.gauss(0., 0.05_mm)),
+           static_cast<float>(varianceR), static_cast<float>(varianceZ)});
+    }
+  }
+  size_t nNoise = noiseFraction * spacePoints.size();
+  for (size_t in = 0; in < nNoise; ++in) {
+    double radius = kLayerRadii[rnd.index(kLayerRadii.size())];
+    double phi = rnd.uniform(-M_PI, M_PI);
+    spacePoints.push_back({static_cast<float>(radius * std::cos(phi)),
+                           static_cast<float>(radius * std::sin(phi)),
+                           static_cast<float>(rnd.uniform(-kLayerHalfZ,
+                                                          kLayerHalfZ)),
+                           static_cast<float>(varianceR),
+                           static_cast<float>(varianceZ)});
+  }
+  return spacePoints;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nParticles = 0;
+  double noiseFraction = 0;
+
+  po::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ("particles", po::value<size_t>(&nParticles)->default_value(5000), "number of charged particles per event")
+      ("noise", po::value<double>(&noiseFraction)->default_value(0.05), "fraction of additional noise hits");
+  // clang-format on
+  Test::BenchmarkOptions opts;
+  if (auto exitCode = Test::parseBenchmarkOptions(argc, argv, desc, opts)) {
+    return *exitCode;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Seedfinder", opts.level));
+
+  Test::StableRandom rnd(opts.seed);
+  std::vector<SpacePoint> spacePoints =
+      generateSpacePoints(rnd, nParticles, noiseFraction);
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+  ACTS_INFO("Generated " << spacePoints.size() << " space points from "
+                         << nParticles << " particles");
+
+  Test::MicroBenchmarkCsvWriter csv(opts.output);
+
+  // binned seed finder with a configuration close to the examples
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 200_mm;
+  config.deltaRMin = 1_mm;
+  config.deltaRMax = 60_mm;
+  config.deltaRMinTopSP = config.deltaRMin;
+  config.deltaRMinBottomSP = config.deltaRMin;
+  config.deltaRMaxTopSP = config.deltaRMax;
+  config.deltaRMaxBottomSP = config.deltaRMax;
+  config.collisionRegionMin = -250_mm;
+  config.collisionRegionMax = 250_mm;
+  config.zMin = -2000_mm;
+  config.zMax = 2000_mm;
+  config.maxSeedsPerSpM = 1;
+  config.cotThetaMax = 7.40627;  // 2.7 eta
+  config.sigmaScattering = 5;
+  config.radLengthPerSeed = 0.1;
+  config.minPt = 500_MeV;
+  config.bFieldInZ = kBz;
+  config.beamPos = {0_mm, 0_mm};
+  config.impactMax = 3_mm;
+  config.useVariableMiddleSPRange = false;
+
+  SeedFilterConfig filterConfig;
+  filterConfig.maxSeedsPerSpM = config.maxSeedsPerSpM;
+  config.seedFilter = std::make_unique<SeedFilter<SpacePoint>>(filterConfig);
+
+  auto bottomBinFinder = std::make_shared<BinFinder<SpacePoint>>(
+      std::vector<std::pair<int, int>>(), 1);
+  auto topBinFinder = std::make_shared<BinFinder<SpacePoint>>(
+      std::vector<std::pair<int, int>>(), 1);
+  auto covarianceTool = [](const SpacePoint& sp, float, float, float) {
+    return std::make_pair(Vector3(sp.x(), sp.y(), sp.z()),
+                          Vector2(sp.varianceR(), sp.varianceZ()));
+  };
+
+  SpacePointGridConfig gridConfig;
+  gridConfig.bFieldInZ = config.bFieldInZ;
+  gridConfig.minPt = config.minPt;
+  gridConfig.rMax = config.rMax;
+  gridConfig.zMax = config.zMax;
+  gridConfig.zMin = config.zMin;
+  gridConfig.deltaRMax = config.deltaRMax;
+  gridConfig.cotThetaMax = config.cotThetaMax;
+
+  Seedfinder<SpacePoint> finder(config);
+  Extent rRangeSPExtent;
+
+  size_t nSeeds = 0;
+  const auto binnedResult = Test::microBenchmark(
+      [&] {
+        // the grid is filled for every event as in the seeding algorithm
+        auto grid = SpacePointGridCreator::createGrid<SpacePoint>(gridConfig);
+        BinnedSPGroup<SpacePoint> spGroup(
+            spacePointPtrs.begin(), spacePointPtrs.end(), covarianceTool,
+            bottomBinFinder, topBinFinder, std::move(grid), config);
+        decltype(finder)::State state;
+        std::vector<Seed<SpacePoint>> seeds;
+        auto groupIt = spGroup.begin();
+        auto endOfGroups = spGroup.end();
+        for (; !(groupIt == endOfGroups); ++groupIt) {
+          finder.createSeedsForGroup(state, std::back_inserter(seeds),
+                                     groupIt.bottom(), groupIt.middle(),
+                                     groupIt.top(), rRangeSPExtent);
+        }
+        nSeeds = seeds.size();
+        return seeds.size();
+      },
+      1, opts.runs, opts.warmup);
+  ACTS_INFO("Seedfinder: " << binnedResult);
+  ACTS_INFO("Seedfinder seeds per event: " << nSeeds);
+  csv.write("Seedfinder", binnedResult);
+
+  // orthogonal seed finder with the same cuts
+  SeedFinderOrthogonalConfig<SpacePoint> orthoConfig;
+  orthoConfig.rMax = config.rMax;
+  orthoConfig.rMin = 0_mm;
+  orthoConfig.rMinMiddle = 60_mm;
+  orthoConfig.rMaxMiddle = 130_mm;
+  orthoConfig.deltaRMin = config.deltaRMin;
+  orthoConfig.deltaRMax = config.deltaRMax;
+  orthoConfig.collisionRegionMin = config.collisionRegionMin;
+  orthoConfig.collisionRegionMax = config.collisionRegionMax;
+  orthoConfig.zMin = config.zMin;
+  orthoConfig.zMax = config.zMax;
+  orthoConfig.maxSeedsPerSpM = config.maxSeedsPerSpM;
+  orthoConfig.cotThetaMax = config.cotThetaMax;
+  orthoConfig.sigmaScattering = config.sigmaScattering;
+  orthoConfig.radLengthPerSeed = config.radLengthPerSeed;
+  orthoConfig.minPt = config.minPt;
+  orthoConfig.bFieldInZ = config.bFieldInZ;
+  orthoConfig.beamPos = config.beamPos;
+  orthoConfig.impactMax = config.impactMax;
+  orthoConfig.seedFilter =
+      std::make_shared<SeedFilter<SpacePoint>>(filterConfig);
+  // derived quantities, computed as in the orthogonal seeding algorithm
+  orthoConfig.highland = 13.6 * std::sqrt(orthoConfig.radLengthPerSeed) *
+                         (1 + 0.038 * std::log(orthoConfig.radLengthPerSeed));
+  float maxScatteringAngle = orthoConfig.highland / orthoConfig.minPt;
+  orthoConfig.maxScatteringAngle2 = maxScatteringAngle * maxScatteringAngle;
+  orthoConfig.pTPerHelixRadius = 300. * orthoConfig.bFieldInZ;
+  orthoConfig.minHelixDiameter2 =
+      std::pow(orthoConfig.minPt * 2 / orthoConfig.pTPerHelixRadius, 2);
+  orthoConfig.pT2perRadius =
+      std::pow(orthoConfig.highland / orthoConfig.pTPerHelixRadius, 2);
+
+  SeedFinderOrthogonal<SpacePoint> orthoFinder(orthoConfig);
+
+  const auto orthoResult = Test::microBenchmark(
+      [&] {
+        auto seeds = orthoFinder.createSeeds(spacePointPtrs);
+        nSeeds = seeds.size();
+        return seeds.size();
+      },
+      1, opts.runs, opts.warmup);
+  ACTS_INFO("SeedFinderOrthogonal: " << orthoResult);
+  ACTS_INFO("SeedFinderOrthogonal seeds per event: " << nSeeds);
+  csv.write("SeedFinderOrthogonal", orthoResult);
+
+  return 0;
+}
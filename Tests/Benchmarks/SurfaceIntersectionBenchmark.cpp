@@ -11,6 +11,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/FrozenSurfaceTable.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
@@ -62,6 +63,15 @@ auto aCylinder = Surface::makeShared<CylinderSurface>(at, std::move(cb));
 // Define a Straw surface
 auto aStraw = Surface::makeShared<StrawSurface>(at, 50_cm, 2_m);
 
+// The same surfaces in a frozen surface table
+FrozenSurfaceTable frozenTable = [] {
+  aPlane->assignGeometryId(GeometryIdentifier().setSensitive(1));
+  aDisc->assignGeometryId(GeometryIdentifier().setSensitive(2));
+  aCylinder->assignGeometryId(GeometryIdentifier().setSensitive(3));
+  return FrozenSurfaceTable(
+      tgContext, {aPlane.get(), aDisc.get(), aCylinder.get()});
+}();
+
 // The orgin of our attempts for plane, disc and cylinder
 Vector3 origin(0., 0., 0.);
 
@@ -86,6 +96,23 @@ MicroBenchmarkResult intersectionTest(const surface_t& surface, double phi,
       nrepts);
 }
 
+MicroBenchmarkResult frozenIntersectionTest(const Surface& surface, double phi,
+                                            double theta) {
+  double cosPhi = std::cos(phi);
+  double sinPhi = std::sin(phi);
+  double cosTheta = std::cos(theta);
+  double sinTheta = std::sin(theta);
+
+  Vector3 direction(cosPhi * sinTheta, sinPhi * sinTheta, cosTheta);
+  size_t index = frozenTable.index(surface.geometryId());
+
+  return Acts::Test::microBenchmark(
+      [&] {
+        return frozenTable.intersect(index, origin, direction, boundaryCheck);
+      },
+      nrepts);
+}
+
 BOOST_DATA_TEST_CASE(
     benchmark_surface_intersections,
     bdata::random(
@@ -105,15 +132,21 @@ BOOST_DATA_TEST_CASE(
     std::cout << "- Plane: "
               << intersectionTest<PlaneSurface>(*aPlane, phi, theta)
               << std::endl;
+    std::cout << "- Plane (frozen): "
+              << frozenIntersectionTest(*aPlane, phi, theta) << std::endl;
   }
   if (testDisc) {
     std::cout << "- Disc: " << intersectionTest<DiscSurface>(*aDisc, phi, theta)
               << std::endl;
+    std::cout << "- Disc (frozen): "
+              << frozenIntersectionTest(*aDisc, phi, theta) << std::endl;
   }
   if (testCylinder) {
     std::cout << "- Cylinder: "
               << intersectionTest<CylinderSurface>(*aCylinder, phi, theta)
               << std::endl;
+    std::cout << "- Cylinder (frozen): "
+              << frozenIntersectionTest(*aCylinder, phi, theta) << std::endl;
   }
   if (testStraw) {
     std::cout << "- Straw: "
@@ -0,0 +1,127 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+
+namespace Acts {
+namespace Test {
+
+/// Detector setup shared by the track finding and fitting benchmarks.
+///
+/// Uses the four layer pixel barrel of the cylindrical test geometry in a
+/// constant solenoid field, i.e. a detector close to the central part of the
+/// generic example detector, but available without the examples.
+struct TrackingBenchmarkDetector {
+  GeometryContext geoCtx;
+  MagneticFieldContext magCtx;
+  CalibrationContext calCtx;
+
+  // the builder owns the detector elements and must outlive the geometry
+  CylindricalTrackingGeometry builder{geoCtx};
+  std::shared_ptr<const TrackingGeometry> geometry = builder();
+  std::shared_ptr<const ConstantBField> field =
+      std::make_shared<ConstantBField>(Vector3(0., 0., 2 * UnitConstants::T));
+  std::shared_ptr<const PerigeeSurface> perigee =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+
+  // two-dimensional pixel measurements on all sensitive surfaces
+  MeasurementResolutionMap resolutions = {
+      {GeometryIdentifier(),
+       {MeasurementType::eLoc01,
+        {15 * UnitConstants::um, 50 * UnitConstants::um}}},
+  };
+
+  Navigator makeNavigator() const {
+    Navigator::Config cfg{geometry};
+    cfg.resolvePassive = false;
+    cfg.resolveMaterial = true;
+    cfg.resolveSensitive = true;
+    return Navigator(cfg);
+  }
+
+  template <typename stepper_t>
+  Propagator<stepper_t, Navigator> makePropagator() const {
+    return Propagator<stepper_t, Navigator>(stepper_t(field), makeNavigator());
+  }
+};
+
+/// Generate particles from the origin that cross the full pixel barrel.
+///
+/// The start parameters carry the typical uncertainties of seeds, but are not
+/// smeared, i.e. they are the true parameters.
+inline std::vector<CurvilinearTrackParameters> generateStartParameters(
+    StableRandom& rnd, size_t nTracks) {
+  using namespace Acts::UnitLiterals;
+
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 100_um;
+  stddev[eBoundLoc1] = 100_um;
+  stddev[eBoundTime] = 25_ns;
+  stddev[eBoundPhi] = 2_degree;
+  stddev[eBoundTheta] = 2_degree;
+  stddev[eBoundQOverP] = 1 / 100_GeV;
+  BoundSymMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  std::vector<CurvilinearTrackParameters> parameters;
+  parameters.reserve(nTracks);
+  for (size_t it = 0; it < nTracks; ++it) {
+    double p = rnd.uniform(1_GeV, 10_GeV);
+    double phi = rnd.uniform(-M_PI, M_PI);
+    // stay within the barrel acceptance, |eta| < 0.8
+    double theta = 2 * std::atan(std::exp(-rnd.uniform(-0.8, 0.8)));
+    double q = (rnd.uniform(0., 1.) < 0.5) ? -1_e : 1_e;
+    Vector4 pos4(rnd.gauss(0., 10_um), rnd.gauss(0., 10_um),
+                 rnd.gauss(0., 20_mm), 0_ns);
+    parameters.emplace_back(pos4, phi, theta, p, q, cov);
+  }
+  return parameters;
+}
+
+/// Simulate the measurements of the given particles.
+///
+/// The measurements are created by propagating the particles through the
+/// detector. The smearing uses a generator seeded from `rnd`, but relies on
+/// the standard normal distribution and can thus differ slightly between
+/// standard library implementations.
+inline std::vector<Measurements> generateMeasurements(
+    const TrackingBenchmarkDetector& detector, StableRandom& rnd,
+    const std::vector<CurvilinearTrackParameters>& parameters) {
+  auto propagator = detector.makePropagator<EigenStepper<>>();
+  std::default_random_engine rng(rnd.engine()());
+  std::vector<Measurements> measurements;
+  measurements.reserve(parameters.size());
+  for (size_t it = 0; it < parameters.size(); ++it) {
+    measurements.push_back(createMeasurements(
+        propagator, detector.geoCtx, detector.magCtx, parameters[it],
+        detector.resolutions, rng, it));
+  }
+  return measurements;
+}
+
+}  // namespace Test
+}  // namespace Acts
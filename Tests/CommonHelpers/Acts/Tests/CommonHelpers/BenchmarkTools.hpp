@@ -14,9 +14,12 @@
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <fstream>
 #include <iomanip>
 #include <numeric>
 #include <ostream>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -340,6 +343,45 @@ struct MicroBenchmarkResult {
   }
 };
 
+// Machine-readable record of benchmark results
+//
+// Writes one comma-separated line per benchmark with the same statistics as
+// the standardized display above, in nanoseconds and without the 95%
+// confidence scaling of the errors. Nothing is written if the path is empty,
+// so benchmarks can always route their results through a writer.
+//
+class MicroBenchmarkCsvWriter {
+ public:
+  explicit MicroBenchmarkCsvWriter(const std::string& path) {
+    if (path.empty()) {
+      return;
+    }
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    if (not m_file) {
+      throw std::runtime_error("Could not open '" + path + "'");
+    }
+    m_file << std::fixed << std::setprecision(1);
+    m_file << "name,runs,iters_per_run,total_ns,run_median_ns,run_error_ns,"
+              "iter_average_ns,iter_error_ns\n";
+  }
+
+  void write(const std::string& name, const MicroBenchmarkResult& res) {
+    if (not m_file.is_open()) {
+      return;
+    }
+    m_file << name << ',' << res.run_timings.size() << ','
+           << res.iters_per_run << ',' << res.totalTime().count() << ','
+           << res.runTimeMedian().count() << ','
+           << res.runTimeError().count() << ','
+           << res.iterTimeAverage().count() << ','
+           << res.iterTimeError().count() << '\n';
+    m_file.flush();
+  }
+
+ private:
+  std::ofstream m_file;
+};
+
 // Implementation details, scroll down for more public API
 namespace benchmark_tools_internal {
 
@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+
+#include <limits>
+#include <utility>
+
+#include "PropagationDatasets.hpp"
+#include "PropagationTests.hpp"
+
+namespace {
+
+namespace ds = ActsTests::PropagationDatasets;
+using namespace Acts::UnitLiterals;
+
+using MagneticField = Acts::ConstantBField;
+using EigenStepper = Acts::EigenStepper<>;
+using EigenPropagator = Acts::Propagator<EigenStepper>;
+using HelixStepper = Acts::HelixStepper;
+using HelixPropagator = Acts::Propagator<HelixStepper>;
+
+// absolute parameter tolerances for position, direction, and absolute momentum
+constexpr auto epsPos = 1_um;
+constexpr auto epsDir = 0.125_mrad;
+constexpr auto epsMom = 1_eV;
+// relative covariance tolerance
+constexpr auto epsCov = 0.1;
+
+const Acts::GeometryContext geoCtx;
+const Acts::MagneticFieldContext magCtx;
+
+inline std::pair<HelixPropagator, EigenPropagator> makePropagators(double bz) {
+  auto field = std::make_shared<MagneticField>(Acts::Vector3(0.0, 0.0, bz));
+  return {HelixPropagator(HelixStepper(field)),
+          EigenPropagator(EigenStepper(field))};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PropagationCompareHelixEigenConstant)
+
+BOOST_DATA_TEST_CASE(Forward,
+                     ds::phi*(ds::thetaWithoutBeam)*ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [helixPropagator, eigenPropagator] = makePropagators(bz);
+  runForwardComparisonTest(
+      helixPropagator, eigenPropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s, epsPos,
+      epsDir, epsMom, epsCov);
+}
+
+BOOST_DATA_TEST_CASE(ToCylinderAlongZ,
+                     ds::phi* ds::thetaWithoutBeam* ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [helixPropagator, eigenPropagator] = makePropagators(bz);
+  runToSurfaceComparisonTest(
+      helixPropagator, eigenPropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s,
+      ZCylinderSurfaceBuilder(), epsPos, epsDir, epsMom, epsCov);
+}
+
+BOOST_DATA_TEST_CASE(
+    ToDisc,
+    ds::phiWithoutAmbiguity* ds::thetaWithoutBeam* ds::absMomentum*
+        ds::chargeNonZero* ds::pathLength* ds::magneticField,
+    phi, theta, p, q, s, bz) {
+  auto [helixPropagator, eigenPropagator] = makePropagators(bz);
+  runToSurfaceComparisonTest(
+      helixPropagator, eigenPropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s,
+      DiscSurfaceBuilder(), epsPos, epsDir, epsMom, epsCov);
+}
+
+BOOST_DATA_TEST_CASE(ToPlane,
+                     ds::phi* ds::thetaWithoutBeam* ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [helixPropagator, eigenPropagator] = makePropagators(bz);
+  runToSurfaceComparisonTest(
+      helixPropagator, eigenPropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s,
+      PlaneSurfaceBuilder(), epsPos, epsDir, epsMom, epsCov);
+}
+
+BOOST_DATA_TEST_CASE(ToStrawAlongZ,
+                     ds::phi* ds::thetaWithoutBeam* ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [helixPropagator, eigenPropagator] = makePropagators(bz);
+  runToSurfaceComparisonTest(
+      helixPropagator, eigenPropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s,
+      ZStrawSurfaceBuilder(), epsPos, epsDir, epsMom, epsCov);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,214 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Clusterization/Clusterization.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+struct Cell {
+  int row = 0;
+  int col = 0;
+  Ccl::Label label = Ccl::NO_LABEL;
+};
+
+int getCellRow(const Cell& cell) {
+  return cell.row;
+}
+
+int getCellColumn(const Cell& cell) {
+  return cell.col;
+}
+
+Ccl::Label& getCellLabel(Cell& cell) {
+  return cell.label;
+}
+
+using Cluster = std::vector<Cell>;
+
+void clusterAddCell(Cluster& cl, const Cell& cell) {
+  cl.push_back(cell);
+}
+
+using CellSet = std::set<std::pair<int, int>>;
+
+// Random cells on a grid, no duplicates
+std::vector<Cell> generateCells(std::mt19937& rng, int size, double occupancy) {
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::vector<Cell> cells;
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < size; ++col) {
+      if (uniform(rng) < occupancy) {
+        cells.push_back({row, col, Ccl::NO_LABEL});
+      }
+    }
+  }
+  std::shuffle(cells.begin(), cells.end(), rng);
+  return cells;
+}
+
+// Reference clusterization: brute-force flood fill
+std::set<CellSet> floodFill(const std::vector<Cell>& cells, bool conn8) {
+  CellSet remaining;
+  for (const auto& cell : cells) {
+    remaining.emplace(cell.row, cell.col);
+  }
+  std::set<CellSet> clusters;
+  while (not remaining.empty()) {
+    CellSet cluster;
+    std::vector<std::pair<int, int>> todo = {*remaining.begin()};
+    remaining.erase(remaining.begin());
+    while (not todo.empty()) {
+      auto [row, col] = todo.back();
+      todo.pop_back();
+      cluster.emplace(row, col);
+      for (int dr = -1; dr <= 1; ++dr) {
+        for (int dc = -1; dc <= 1; ++dc) {
+          if ((dr == 0 and dc == 0) or (not conn8 and dr != 0 and dc != 0)) {
+            continue;
+          }
+          auto it = remaining.find({row + dr, col + dc});
+          if (it != remaining.end()) {
+            todo.push_back(*it);
+            remaining.erase(it);
+          }
+        }
+      }
+    }
+    clusters.insert(std::move(cluster));
+  }
+  return clusters;
+}
+
+std::set<CellSet> toCellSets(const std::vector<Cluster>& clusters) {
+  std::set<CellSet> out;
+  for (const auto& cl : clusters) {
+    CellSet cs;
+    for (const auto& cell : cl) {
+      cs.emplace(cell.row, cell.col);
+    }
+    out.insert(std::move(cs));
+  }
+  return out;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Clusterization)
+
+BOOST_AUTO_TEST_CASE(DisjointSetsReuse) {
+  Ccl::DisjointSets ds(4);
+  for (int pass = 0; pass < 2; ++pass) {
+    ds.clear();
+    for (Ccl::Label lbl = 1; lbl <= 6; ++lbl) {
+      BOOST_CHECK_EQUAL(ds.makeSet(), lbl);
+    }
+    ds.unionSet(5, 2);
+    ds.unionSet(6, 5);
+    ds.unionSet(4, 3);
+    BOOST_CHECK_EQUAL(ds.findSet(6), 2);
+    BOOST_CHECK_EQUAL(ds.findSet(4), 3);
+    BOOST_CHECK_EQUAL(ds.size(), 6u);
+
+    BOOST_CHECK_EQUAL(ds.compact(), 3u);
+    BOOST_CHECK_EQUAL(ds.compactLabel(1), 1);
+    BOOST_CHECK_EQUAL(ds.compactLabel(2), 2);
+    BOOST_CHECK_EQUAL(ds.compactLabel(3), 3);
+    BOOST_CHECK_EQUAL(ds.compactLabel(4), 3);
+    BOOST_CHECK_EQUAL(ds.compactLabel(5), 2);
+    BOOST_CHECK_EQUAL(ds.compactLabel(6), 2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CreateClustersMatchesFloodFill) {
+  std::mt19937 rng(42);
+  for (bool conn8 : {true, false}) {
+    for (int i = 0; i < 20; ++i) {
+      auto cells = generateCells(rng, 40, 0.3);
+      auto expected = floodFill(cells, conn8);
+      auto clusters =
+          Ccl::createClusters<std::vector<Cell>, std::vector<Cluster>>(
+              cells, Ccl::DefaultConnect<Cell>(conn8));
+      BOOST_CHECK_EQUAL(clusters.size(), expected.size());
+      BOOST_CHECK(toCellSets(clusters) == expected);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LabelSortedClustersDense) {
+  std::mt19937 rng(1234);
+  auto cells = generateCells(rng, 30, 0.4);
+  auto expected = floodFill(cells, true);
+
+  // Order column-wise as required
+  std::sort(cells.begin(), cells.end(), [](const Cell& a, const Cell& b) {
+    return (a.col == b.col) ? a.row < b.row : a.col < b.col;
+  });
+  auto sorted = cells;
+
+  Ccl::DisjointSets ds;
+  size_t nClusters = Ccl::labelSortedClusters(cells, ds);
+  BOOST_CHECK_EQUAL(nClusters, expected.size());
+
+  std::set<Ccl::Label> labels;
+  for (size_t i = 0; i < cells.size(); ++i) {
+    // cell order must not change
+    BOOST_CHECK_EQUAL(cells[i].row, sorted[i].row);
+    BOOST_CHECK_EQUAL(cells[i].col, sorted[i].col);
+    BOOST_CHECK_GE(cells[i].label, 1);
+    BOOST_CHECK_LE(cells[i].label, static_cast<Ccl::Label>(nClusters));
+    labels.insert(cells[i].label);
+  }
+  BOOST_CHECK_EQUAL(labels.size(), nClusters);
+}
+
+BOOST_AUTO_TEST_CASE(CreateClustersBatch) {
+  std::mt19937 rng(7);
+  std::vector<std::vector<Cell>> modules;
+  for (int i = 0; i < 10; ++i) {
+    modules.push_back(generateCells(rng, 20 + i, 0.25));
+  }
+  modules.emplace_back();
+
+  std::vector<std::set<CellSet>> expected;
+  for (const auto& cells : modules) {
+    expected.push_back(floodFill(cells, true));
+  }
+
+  auto batch =
+      Ccl::createClustersBatch<std::vector<std::vector<Cell>>,
+                               std::vector<Cluster>>(modules);
+  BOOST_CHECK_EQUAL(batch.size(), modules.size());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    BOOST_CHECK(toCellSets(batch[i]) == expected[i]);
+  }
+
+  // Modules are now sorted and can be processed again without sorting
+  auto again =
+      Ccl::createClustersBatch<std::vector<std::vector<Cell>>,
+                               std::vector<Cluster>>(
+          modules, Ccl::DefaultConnect<Cell>(true), true);
+  for (size_t i = 0; i < again.size(); ++i) {
+    BOOST_CHECK(toCellSets(again[i]) == expected[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
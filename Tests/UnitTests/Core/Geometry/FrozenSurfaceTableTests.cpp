@@ -0,0 +1,179 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/FrozenSurfaceTable.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext();
+
+std::vector<std::shared_ptr<Surface>> makeSurfaces() {
+  Transform3 transform = Transform3::Identity() *
+                         Translation3(10_cm, -5_cm, 1_m) *
+                         AngleAxis3(0.15, Vector3(1.2, 1.2, 0.12).normalized());
+
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(
+      transform, std::make_shared<RectangleBounds>(40_cm, 30_cm)));
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(
+      transform, std::make_shared<TrapezoidBounds>(20_cm, 40_cm, 30_cm)));
+  surfaces.push_back(Surface::makeShared<DiscSurface>(
+      transform, std::make_shared<RadialBounds>(10_cm, 60_cm)));
+  surfaces.push_back(Surface::makeShared<DiscSurface>(
+      transform, std::make_shared<RadialBounds>(10_cm, 60_cm, 0.5)));
+  surfaces.push_back(Surface::makeShared<CylinderSurface>(
+      transform, std::make_shared<CylinderBounds>(50_cm, 80_cm)));
+  surfaces.push_back(Surface::makeShared<CylinderSurface>(
+      transform, std::make_shared<CylinderBounds>(50_cm, 80_cm, 0.7)));
+  surfaces.push_back(Surface::makeShared<StrawSurface>(transform, 5_cm, 1_m));
+
+  // the table requires unique identifiers
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    surfaces[i]->assignGeometryId(
+        GeometryIdentifier().setVolume(1).setLayer(2).setSensitive(i + 1));
+  }
+  return surfaces;
+}
+
+void checkIntersection(const Intersection3D& table,
+                       const Intersection3D& reference) {
+  BOOST_CHECK_EQUAL(static_cast<int>(table.status),
+                    static_cast<int>(reference.status));
+  if (reference.status != Intersection3D::Status::unreachable) {
+    CHECK_CLOSE_OR_SMALL(table.pathLength, reference.pathLength, 1e-9, 1e-9);
+    CHECK_CLOSE_OR_SMALL(table.position, reference.position, 1e-9, 1e-9);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(FrozenSurfaceTableConstruction) {
+  auto surfaces = makeSurfaces();
+  // pass in reverse order to check the sorting
+  std::vector<const Surface*> input;
+  for (auto it = surfaces.rbegin(); it != surfaces.rend(); ++it) {
+    input.push_back(it->get());
+  }
+  FrozenSurfaceTable table(tgContext, input);
+  BOOST_CHECK_EQUAL(table.size(), surfaces.size());
+
+  for (const auto& surface : surfaces) {
+    size_t index = table.index(surface->geometryId());
+    BOOST_CHECK_LT(index, table.size());
+    BOOST_CHECK_EQUAL(&table.surface(index), surface.get());
+    CHECK_CLOSE_ABS(table.center(index), surface->center(tgContext), 1e-12);
+    CHECK_CLOSE_ABS(table.rotation(index),
+                    surface->transform(tgContext).rotation(), 1e-12);
+
+    Vector3 global(1_cm, 2_cm, 3_cm);
+    CHECK_CLOSE_ABS(table.globalToLocal3D(index, global),
+                    surface->transform(tgContext).inverse() * global, 1e-9);
+  }
+  BOOST_CHECK_EQUAL(
+      table.index(GeometryIdentifier().setVolume(1).setLayer(3)),
+      table.size());
+
+  // duplicated identifiers are not allowed
+  input.push_back(surfaces.front().get());
+  BOOST_CHECK_THROW(FrozenSurfaceTable(tgContext, input),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(FrozenSurfaceTableIntersection) {
+  auto surfaces = makeSurfaces();
+  std::vector<const Surface*> input;
+  for (const auto& surface : surfaces) {
+    input.push_back(surface.get());
+  }
+  FrozenSurfaceTable table(tgContext, input);
+
+  std::vector<BoundaryCheck> bchecks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, true, 1_cm, 2_cm)};
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> posDist(-20_cm, 20_cm);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-0.6, 0.6);
+
+  for (size_t itest = 0; itest < 500; ++itest) {
+    Vector3 position(posDist(rng), posDist(rng), posDist(rng));
+    double phi = phiDist(rng);
+    double theta = 2 * std::atan(std::exp(-etaDist(rng)));
+    Vector3 direction(std::cos(phi) * std::sin(theta),
+                      std::sin(phi) * std::sin(theta), std::cos(theta));
+
+    for (const auto& surface : surfaces) {
+      size_t index = table.index(surface->geometryId());
+      for (const auto& bcheck : bchecks) {
+        auto reference =
+            surface->intersect(tgContext, position, direction, bcheck);
+        auto frozen = table.intersect(index, position, direction, bcheck);
+        BOOST_CHECK_EQUAL(frozen.object, reference.object);
+        checkIntersection(frozen.intersection, reference.intersection);
+        checkIntersection(frozen.alternative, reference.alternative);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FrozenSurfaceTableInsideBounds) {
+  auto surfaces = makeSurfaces();
+  std::vector<const Surface*> input;
+  for (const auto& surface : surfaces) {
+    input.push_back(surface.get());
+  }
+  FrozenSurfaceTable table(tgContext, input);
+
+  std::vector<BoundaryCheck> bchecks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, false, 1_cm, 0.),
+      BoundaryCheck(true, true, 1_cm, 2_cm)};
+
+  std::mt19937 rng(23);
+  std::uniform_real_distribution<double> locDist(-60_cm, 60_cm);
+  for (size_t itest = 0; itest < 1000; ++itest) {
+    Vector2 lposition(locDist(rng), locDist(rng));
+    for (const auto& surface : surfaces) {
+      size_t index = table.index(surface->geometryId());
+      for (const auto& bcheck : bchecks) {
+        BOOST_CHECK_EQUAL(table.insideBounds(index, lposition, bcheck),
+                          surface->insideBounds(lposition, bcheck));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
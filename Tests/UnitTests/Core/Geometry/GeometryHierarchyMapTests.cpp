@@ -191,4 +191,67 @@ BOOST_AUTO_TEST_CASE(FindWithGlobalDefault) {
   CHECK_ENTRY(c, makeId(5), makeId());
 }
 
+BOOST_AUTO_TEST_CASE(FindCompiled) {
+  Container c = {
+      {makeId(2, 4, 6), {-23.0}},
+      {makeId(2, 8), {5.0}},
+      {makeId(2), {1.0}},
+      {makeId(12, 16), {-1.0}},
+  };
+
+  // all the identifiers queried in the Find test plus some more
+  std::vector<GeometryIdentifier> queries;
+  for (int vol : {2, 3, 12}) {
+    for (int lay : {0, 4, 8, 13, 16}) {
+      for (int sen : {0, 6, 7, 13, 20}) {
+        queries.push_back(makeId(vol, lay, sen));
+      }
+    }
+  }
+  // compile only every other identifier to test the fallback as well
+  std::vector<GeometryIdentifier> compiled;
+  for (size_t i = 0; i < queries.size(); i += 2) {
+    compiled.push_back(queries[i]);
+  }
+
+  std::vector<Container::Iterator> expected;
+  for (const auto& id : queries) {
+    expected.push_back(c.find(id));
+  }
+
+  BOOST_CHECK(not c.isCompiled());
+  c.compile(compiled);
+  BOOST_CHECK(c.isCompiled());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    BOOST_CHECK_EQUAL(c.find(queries[i]), expected[i]);
+  }
+
+  // the compiled lookup must survive a copy
+  Container copy = c;
+  for (size_t i = 0; i < queries.size(); ++i) {
+    BOOST_CHECK_EQUAL(std::distance(copy.begin(), copy.find(queries[i])),
+                      std::distance(c.begin(), expected[i]));
+  }
+
+  c.compile(std::vector<GeometryIdentifier>());
+  BOOST_CHECK(not c.isCompiled());
+  CHECK_ENTRY(c, makeId(2, 4, 7), makeId(2));
+}
+
+BOOST_AUTO_TEST_CASE(FindCompiledWithGlobalDefault) {
+  Container c = {
+      {makeId(), {1.0}},
+      {makeId(2, 3), {2.0}},
+      {makeId(4), {4.0}},
+  };
+  c.compile({makeId(2, 3, 4), makeId(2, 4, 5), makeId(4, 5), makeId(5)});
+
+  CHECK_ENTRY(c, makeId(2, 3, 4), makeId(2, 3));
+  CHECK_ENTRY(c, makeId(2, 4, 5), makeId());
+  CHECK_ENTRY(c, makeId(4, 5), makeId(4));
+  CHECK_ENTRY(c, makeId(5), makeId());
+  // not compiled
+  CHECK_ENTRY(c, makeId(4, 1, 1), makeId(4));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,273 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/BinaryMaterialDecorator.hpp"
+#include "Acts/Material/BinaryMaterialMap.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext();
+
+void checkSurface(const Surface& original, const Surface& restored) {
+  BOOST_CHECK_EQUAL(restored.geometryId(), original.geometryId());
+  BOOST_CHECK_EQUAL(restored.type(), original.type());
+  BOOST_CHECK(restored.bounds() == original.bounds());
+  BOOST_CHECK(restored.transform(tgContext).isApprox(
+      original.transform(tgContext)));
+  BOOST_CHECK_EQUAL(restored.surfaceMaterial() != nullptr,
+                    original.surfaceMaterial() != nullptr);
+  if (original.surfaceMaterial() != nullptr and
+      restored.surfaceMaterial() != nullptr) {
+    BOOST_CHECK_EQUAL(restored.surfaceMaterial()->materialSlab(0, 0),
+                      original.surfaceMaterial()->materialSlab(0, 0));
+  }
+}
+
+void checkLayer(const Layer& original, const Layer& restored) {
+  checkSurface(original.surfaceRepresentation(),
+               restored.surfaceRepresentation());
+  BOOST_CHECK_EQUAL(restored.layerType(), original.layerType());
+  BOOST_CHECK_EQUAL(restored.thickness(), original.thickness());
+
+  BOOST_REQUIRE_EQUAL(restored.surfaceArray() != nullptr,
+                      original.surfaceArray() != nullptr);
+  if (original.surfaceArray() != nullptr) {
+    const auto& oArray = *original.surfaceArray();
+    const auto& rArray = *restored.surfaceArray();
+    BOOST_REQUIRE_EQUAL(rArray.surfaces().size(), oArray.surfaces().size());
+    for (size_t isf = 0; isf < oArray.surfaces().size(); ++isf) {
+      checkSurface(*oArray.surfaces()[isf], *rArray.surfaces()[isf]);
+      BOOST_CHECK_EQUAL(rArray.surfaces()[isf]->associatedLayer(), &restored);
+    }
+    BOOST_REQUIRE_EQUAL(rArray.size(), oArray.size());
+    auto ids = [](const std::vector<const Surface*>& surfaces) {
+      std::vector<GeometryIdentifier> result;
+      for (const auto* surface : surfaces) {
+        result.push_back(surface->geometryId());
+      }
+      return result;
+    };
+    for (size_t bin = 0; bin < oArray.size(); ++bin) {
+      BOOST_CHECK(ids(rArray.at(bin)) == ids(oArray.at(bin)));
+    }
+    // the lookups and the neighbor caches agree
+    for (const auto* surface : oArray.surfaces()) {
+      Vector3 position = surface->center(tgContext);
+      BOOST_CHECK(ids(rArray.at(position)) == ids(oArray.at(position)));
+      BOOST_CHECK(ids(rArray.neighbors(position)) ==
+                  ids(oArray.neighbors(position)));
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(restored.approachDescriptor() != nullptr,
+                      original.approachDescriptor() != nullptr);
+  if (original.approachDescriptor() != nullptr) {
+    const auto& oSurfaces = original.approachDescriptor()->containedSurfaces();
+    const auto& rSurfaces = restored.approachDescriptor()->containedSurfaces();
+    BOOST_REQUIRE_EQUAL(rSurfaces.size(), oSurfaces.size());
+    for (size_t isf = 0; isf < oSurfaces.size(); ++isf) {
+      checkSurface(*oSurfaces[isf], *rSurfaces[isf]);
+    }
+  }
+}
+
+void checkVolume(const TrackingVolume& original,
+                 const TrackingVolume& restored) {
+  BOOST_CHECK_EQUAL(restored.volumeName(), original.volumeName());
+  BOOST_CHECK_EQUAL(restored.geometryId(), original.geometryId());
+  BOOST_CHECK(restored.volumeBounds() == original.volumeBounds());
+  BOOST_CHECK(restored.transform().isApprox(original.transform()));
+
+  const auto& oBoundaries = original.boundarySurfaces();
+  const auto& rBoundaries = restored.boundarySurfaces();
+  BOOST_REQUIRE_EQUAL(rBoundaries.size(), oBoundaries.size());
+  for (size_t ib = 0; ib < oBoundaries.size(); ++ib) {
+    checkSurface(oBoundaries[ib]->surfaceRepresentation(),
+                 rBoundaries[ib]->surfaceRepresentation());
+    for (auto navDir :
+         {NavigationDirection::Backward, NavigationDirection::Forward}) {
+      const auto* oVolume = oBoundaries[ib]->attachedVolume(navDir);
+      const auto* rVolume = rBoundaries[ib]->attachedVolume(navDir);
+      BOOST_REQUIRE_EQUAL(rVolume != nullptr, oVolume != nullptr);
+      if (oVolume != nullptr) {
+        BOOST_CHECK_EQUAL(rVolume->geometryId(), oVolume->geometryId());
+      }
+      BOOST_CHECK_EQUAL(
+          rBoundaries[ib]->attachedVolumeArray(navDir) != nullptr,
+          oBoundaries[ib]->attachedVolumeArray(navDir) != nullptr);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(restored.confinedLayers() != nullptr,
+                      original.confinedLayers() != nullptr);
+  if (original.confinedLayers() != nullptr) {
+    const auto& oLayers = original.confinedLayers()->arrayObjects();
+    const auto& rLayers = restored.confinedLayers()->arrayObjects();
+    BOOST_REQUIRE_EQUAL(rLayers.size(), oLayers.size());
+    for (size_t il = 0; il < oLayers.size(); ++il) {
+      checkLayer(*oLayers[il], *rLayers[il]);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(restored.confinedVolumes() != nullptr,
+                      original.confinedVolumes() != nullptr);
+  if (original.confinedVolumes() != nullptr) {
+    const auto& oVolumes = original.confinedVolumes()->arrayObjects();
+    const auto& rVolumes = restored.confinedVolumes()->arrayObjects();
+    BOOST_REQUIRE_EQUAL(rVolumes.size(), oVolumes.size());
+    for (size_t iv = 0; iv < oVolumes.size(); ++iv) {
+      checkVolume(*oVolumes[iv], *rVolumes[iv]);
+    }
+  }
+}
+
+void checkGeometry(const TrackingGeometry& original,
+                   const TrackingGeometry& restored,
+                   const std::vector<Vector3>& positions) {
+  checkVolume(*original.highestTrackingVolume(),
+              *restored.highestTrackingVolume());
+
+  std::map<GeometryIdentifier, const Surface*> oSurfaces, rSurfaces;
+  original.visitSurfaces([&](const Surface* surface) {
+    oSurfaces[surface->geometryId()] = surface;
+  });
+  restored.visitSurfaces([&](const Surface* surface) {
+    rSurfaces[surface->geometryId()] = surface;
+  });
+  BOOST_CHECK_EQUAL(rSurfaces.size(), oSurfaces.size());
+  for (const auto& [geoId, surface] : oSurfaces) {
+    BOOST_CHECK_EQUAL(restored.findSurface(geoId), rSurfaces[geoId]);
+  }
+
+  for (const auto& position : positions) {
+    const auto* oVolume = original.lowestTrackingVolume(tgContext, position);
+    const auto* rVolume = restored.lowestTrackingVolume(tgContext, position);
+    BOOST_REQUIRE_EQUAL(rVolume != nullptr, oVolume != nullptr);
+    if (oVolume != nullptr) {
+      BOOST_CHECK_EQUAL(rVolume->geometryId(), oVolume->geometryId());
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotCylindrical) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto original = cGeometry();
+
+  const std::string fileName = "TrackingGeometrySnapshotCylindrical.actsgeo";
+  const std::string materialFileName =
+      "TrackingGeometrySnapshotCylindrical.actsmat";
+  TrackingGeometrySnapshot::write(fileName, *original);
+  BinaryMaterialMap::write(materialFileName,
+                           BinaryMaterialMap::collect(*original));
+
+  BinaryMaterialDecorator decorator(materialFileName, Logging::INFO);
+  auto restored = TrackingGeometrySnapshot::read(fileName, &decorator);
+  std::remove(fileName.c_str());
+  std::remove(materialFileName.c_str());
+
+  BOOST_REQUIRE(restored != nullptr);
+  checkGeometry(*original, *restored,
+                {{0., 0., 0.},
+                 {10., 5., 400.},
+                 {50., 0., -200.},
+                 {0., 120., 700.},
+                 {-200., -150., 10.},
+                 {0., 0., 2000.}});
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotCubic) {
+  CubicTrackingGeometry cGeometry(tgContext);
+  auto original = cGeometry();
+
+  const std::string fileName = "TrackingGeometrySnapshotCubic.actsgeo";
+  TrackingGeometrySnapshot::write(fileName, *original);
+  // without a material decorator the restored geometry has no material
+  auto restored = TrackingGeometrySnapshot::read(fileName);
+  std::remove(fileName.c_str());
+
+  BOOST_REQUIRE(restored != nullptr);
+  std::vector<GeometryIdentifier> oIds, rIds;
+  original->visitSurfaces(
+      [&](const Surface* surface) { oIds.push_back(surface->geometryId()); });
+  restored->visitSurfaces([&](const Surface* surface) {
+    rIds.push_back(surface->geometryId());
+    BOOST_CHECK_EQUAL(surface->surfaceMaterial(), nullptr);
+  });
+  BOOST_CHECK(rIds == oIds);
+  for (double x : {-1500., -500., 0., 500., 1500.}) {
+    Vector3 position(x, 0., 0.);
+    BOOST_CHECK_EQUAL(
+        restored->lowestTrackingVolume(tgContext, position)->geometryId(),
+        original->lowestTrackingVolume(tgContext, position)->geometryId());
+    BOOST_CHECK_EQUAL(
+        restored->associatedLayer(tgContext, position)->geometryId(),
+        original->associatedLayer(tgContext, position)->geometryId());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotInvalidFiles) {
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot::read("DoesNotExist.actsgeo"),
+                    std::runtime_error);
+
+  const std::string fileName = "TrackingGeometrySnapshotInvalid.actsgeo";
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs << "This is not a tracking geometry snapshot";
+  }
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot::read(fileName),
+                    std::runtime_error);
+
+  // truncated file
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  TrackingGeometrySnapshot::write(fileName, *cGeometry());
+  std::vector<char> bytes;
+  {
+    std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(ifs),
+                 std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs.write(bytes.data(), bytes.size() / 2);
+  }
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot::read(fileName),
+                    std::runtime_error);
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,193 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/BinaryBFieldMap.hpp"
+#include "Acts/MagneticField/CompactBFieldGrid.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using Grid3D =
+    detail::Grid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+                 detail::EquidistantAxis>;
+
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+InterpolatedBFieldMap<Grid3D> makeFieldMapXYZ() {
+  std::vector<double> xPos, yPos, zPos;
+  std::vector<Vector3> bField;
+  for (int ix = 0; ix < 5; ++ix) {
+    for (int iy = 0; iy < 4; ++iy) {
+      for (int iz = 0; iz < 6; ++iz) {
+        xPos.push_back(-100. + 50. * ix);
+        yPos.push_back(-60. + 40. * iy);
+        zPos.push_back(-250. + 100. * iz);
+        bField.emplace_back(0.1 * ix - 0.05 * iz, 0.2 * iy + 0.01 * ix * iz,
+                            2. - 0.1 * iz + 0.03 * iy);
+      }
+    }
+  }
+  auto localToGlobalBin = [](std::array<size_t, 3> bins,
+                             std::array<size_t, 3> sizes) {
+    return (bins[0] * (sizes[1] * sizes[2]) + bins[1] * sizes[2] + bins[2]);
+  };
+  return fieldMapXYZ(localToGlobalBin, xPos, yPos, zPos, bField,
+                     UnitConstants::mm, UnitConstants::T);
+}
+
+std::vector<Vector3> testPositions() {
+  std::vector<Vector3> positions;
+  for (double x : {-99., -31.3, 0., 12.5, 149.}) {
+    for (double y : {-59.5, -7.2, 33.3, 99.}) {
+      for (double z : {-249., -101.7, 0.1, 77.7, 349.}) {
+        positions.emplace_back(x, y, z);
+      }
+    }
+  }
+  return positions;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MagneticField)
+
+BOOST_AUTO_TEST_CASE(CompactBFieldGridConversion) {
+  auto map = makeFieldMapXYZ();
+  const auto& grid = map.getGrid();
+  CompactBFieldGrid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+                    detail::EquidistantAxis>
+      compact(grid);
+
+  BOOST_CHECK_EQUAL(compact.size(), grid.size());
+  BOOST_CHECK(compact.numLocalBins() == grid.numLocalBins());
+  BOOST_CHECK(compact.minPosition() == grid.minPosition());
+  BOOST_CHECK(compact.maxPosition() == grid.maxPosition());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    BOOST_CHECK(compact.at(bin) == grid.at(bin).cast<float>().cast<double>());
+  }
+  BOOST_CHECK_THROW(compact.at(grid.size()), std::out_of_range);
+
+  for (const auto& position : testPositions()) {
+    std::array<double, 3> point = {position.x(), position.y(), position.z()};
+    CHECK_CLOSE_ABS(compact.interpolate(point), grid.interpolate(point),
+                    1e-6 * UnitConstants::T);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryBFieldMapXYZ) {
+  const std::string fileName = "BinaryBFieldMapXYZ.actsbf";
+  auto map = makeFieldMapXYZ();
+  BinaryBFieldMap::write(fileName, map.getGrid());
+  auto readMap = BinaryBFieldMap::readXYZ(fileName);
+  std::remove(fileName.c_str());
+
+  BOOST_CHECK(readMap.getNBins() == map.getNBins());
+  BOOST_CHECK(readMap.getMin() == map.getMin());
+  BOOST_CHECK(readMap.getMax() == map.getMax());
+  // the single precision values are stored in place
+  BOOST_CHECK_EQUAL(readMap.getGrid().at(42)[1],
+                    static_cast<float>(map.getGrid().at(42)[1]));
+
+  auto cache = map.makeCache(mfContext);
+  auto readCache = readMap.makeCache(mfContext);
+  for (const auto& position : testPositions()) {
+    BOOST_CHECK_EQUAL(readMap.isInside(position), map.isInside(position));
+    if (not map.isInside(position)) {
+      BOOST_CHECK(not readMap.getField(position).ok());
+      BOOST_CHECK(not readMap.getField(position, readCache).ok());
+      continue;
+    }
+    CHECK_CLOSE_ABS(*readMap.getField(position), *map.getField(position),
+                    1e-6 * UnitConstants::T);
+    CHECK_CLOSE_ABS(*readMap.getField(position, readCache),
+                    *map.getField(position, cache), 1e-6 * UnitConstants::T);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryBFieldMapRZ) {
+  const std::string fileName = "BinaryBFieldMapRZ.actsbf";
+  SolenoidBField solenoid({1200., 6000., 1194, 2. * UnitConstants::T});
+  auto map = solenoidFieldMap({0., 1200.}, {-3000., 3000.}, {60, 100},
+                              solenoid);
+  BinaryBFieldMap::write(fileName, map.getGrid());
+  auto readMap = BinaryBFieldMap::readRZ(fileName);
+  std::remove(fileName.c_str());
+
+  BOOST_CHECK(readMap.getNBins() == map.getNBins());
+  BOOST_CHECK(readMap.getMin() == map.getMin());
+  BOOST_CHECK(readMap.getMax() == map.getMax());
+
+  auto cache = map.makeCache(mfContext);
+  auto readCache = readMap.makeCache(mfContext);
+  for (double r : {0., 10., 333.3, 1000.}) {
+    for (double phi : {0., 1., -2.5}) {
+      for (double z : {-2900., -120., 0., 1570.}) {
+        Vector3 position(r * std::cos(phi), r * std::sin(phi), z);
+        CHECK_CLOSE_OR_SMALL(*readMap.getField(position),
+                             *map.getField(position), 1e-6,
+                             1e-6 * UnitConstants::T);
+        CHECK_CLOSE_OR_SMALL(*readMap.getField(position, readCache),
+                             *map.getField(position, cache), 1e-6,
+                             1e-6 * UnitConstants::T);
+      }
+    }
+  }
+  BOOST_CHECK(not readMap.getField({0., 0., 3500.}).ok());
+}
+
+BOOST_AUTO_TEST_CASE(BinaryBFieldMapInvalidFiles) {
+  BOOST_CHECK_THROW(BinaryBFieldMap::readXYZ("DoesNotExist.actsbf"),
+                    std::runtime_error);
+
+  const std::string fileName = "BinaryBFieldMapInvalid.actsbf";
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs << "This is not a field map, but it is long enough for a header. "
+           "This is not a field map, but it is long enough for a header.";
+  }
+  BOOST_CHECK_THROW(BinaryBFieldMap::readXYZ(fileName), std::runtime_error);
+
+  // wrong field map type
+  BinaryBFieldMap::write(fileName, makeFieldMapXYZ().getGrid());
+  BOOST_CHECK_THROW(BinaryBFieldMap::readRZ(fileName), std::runtime_error);
+
+  // truncated file
+  std::vector<char> bytes;
+  {
+    std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(ifs),
+                 std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs.write(bytes.data(), bytes.size() - 4);
+  }
+  BOOST_CHECK_THROW(BinaryBFieldMap::readXYZ(fileName), std::runtime_error);
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
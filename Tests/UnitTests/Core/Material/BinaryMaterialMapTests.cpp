@@ -0,0 +1,303 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/BinaryMaterialMap.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/BinnedSurfaceMaterialView.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/MaterialGridHelper.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Material/ProtoVolumeMaterial.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using Grid3DMap = InterpolatedMaterialMap<MaterialMapper<MaterialGrid3D>>;
+
+const GeometryIdentifier binnedId =
+    GeometryIdentifier().setVolume(1).setLayer(2).setSensitive(3);
+const GeometryIdentifier homogeneousId =
+    GeometryIdentifier().setVolume(1).setLayer(2).setSensitive(4);
+const GeometryIdentifier protoId =
+    GeometryIdentifier().setVolume(1).setLayer(4);
+const GeometryIdentifier homogeneousVolumeId =
+    GeometryIdentifier().setVolume(1);
+const GeometryIdentifier gridVolumeId = GeometryIdentifier().setVolume(2);
+const GeometryIdentifier protoVolumeId = GeometryIdentifier().setVolume(3);
+
+BinUtility surfaceBinning() {
+  std::vector<float> boundaries = {-1., -0.5, 0.2, 1.};
+  BinUtility bu(4, -2., 2., open, binX,
+                Transform3(Translation3(Vector3(0., 0., 10.))));
+  bu += BinUtility(boundaries, closed, binY);
+  return bu;
+}
+
+DetectorMaterialMaps makeMaps() {
+  DetectorMaterialMaps maps;
+
+  BinUtility bu = surfaceBinning();
+  MaterialSlabMatrix matrix;
+  for (size_t i1 = 0; i1 < 3; ++i1) {
+    MaterialSlabVector row;
+    for (size_t i0 = 0; i0 < 4; ++i0) {
+      row.emplace_back(i0 % 2 == 0 ? makeSilicon() : makeBeryllium(),
+                       0.1 * (1 + i0 + 4 * i1));
+    }
+    matrix.push_back(std::move(row));
+  }
+  maps.first[binnedId] = std::make_shared<BinnedSurfaceMaterial>(
+      bu, std::move(matrix), 0.25, MappingType::PostMapping);
+  maps.first[homogeneousId] = std::make_shared<HomogeneousSurfaceMaterial>(
+      MaterialSlab(makeSilicon(), 0.5), 0.75, MappingType::Sensor);
+  maps.first[protoId] = std::make_shared<ProtoSurfaceMaterial>(
+      bu, MappingType::PreMapping);
+
+  maps.second[homogeneousVolumeId] =
+      std::make_shared<HomogeneousVolumeMaterial>(makeBeryllium());
+  BinUtility vbu(4, -1., 1., open, binX);
+  vbu += BinUtility(3, -2., 2., open, binY);
+  vbu += BinUtility(2, -1., 1., open, binZ);
+  maps.second[protoVolumeId] = std::make_shared<ProtoVolumeMaterial>(vbu);
+
+  std::function<Vector3(Vector3)> transfoGlobalToLocal;
+  Grid3D grid = createGrid3D(vbu, transfoGlobalToLocal);
+  Grid3D::point_t min = grid.minPosition();
+  Grid3D::point_t max = grid.maxPosition();
+  Grid3D::index_t nBins = grid.numLocalBins();
+  MaterialGrid3D mGrid(std::make_tuple(EAxis(min[0], max[0], nBins[0]),
+                                       EAxis(min[1], max[1], nBins[1]),
+                                       EAxis(min[2], max[2], nBins[2])));
+  for (size_t bin = 0; bin < mGrid.size(); ++bin) {
+    mGrid.at(bin) = (bin % 3 == 0 ? makeSilicon() : makeBeryllium())
+                        .parameters() *
+                    (1. + 0.01 * bin);
+  }
+  MaterialMapper<MaterialGrid3D> matMap(transfoGlobalToLocal, mGrid);
+  maps.second[gridVolumeId] =
+      std::make_shared<Grid3DMap>(std::move(matMap), vbu);
+  return maps;
+}
+
+double splitFactor(const ISurfaceMaterial& material) {
+  return material.factor(NavigationDirection::Forward,
+                         MaterialUpdateStage::PostUpdate);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Material)
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMapRoundTrip) {
+  const std::string fileName = "BinaryMaterialMapRoundTrip.actsmat";
+  auto maps = makeMaps();
+  BinaryMaterialMap::write(fileName, maps);
+  auto readMaps = BinaryMaterialMap::read(fileName);
+  std::remove(fileName.c_str());
+
+  BOOST_CHECK_EQUAL(readMaps.first.size(), maps.first.size());
+  BOOST_CHECK_EQUAL(readMaps.second.size(), maps.second.size());
+
+  // binned surface material is read into a view
+  const auto& binned =
+      dynamic_cast<const BinnedSurfaceMaterial&>(*maps.first.at(binnedId));
+  auto view = std::dynamic_pointer_cast<const BinnedSurfaceMaterialView>(
+      readMaps.first.at(binnedId));
+  BOOST_REQUIRE(view != nullptr);
+  BOOST_CHECK(view->binUtility() == binned.binUtility());
+  BOOST_CHECK_EQUAL(view->bins0(), 4u);
+  BOOST_CHECK_EQUAL(view->bins1(), 3u);
+  BOOST_CHECK_EQUAL(view->mappingType(), MappingType::PostMapping);
+  BOOST_CHECK_EQUAL(splitFactor(*view), splitFactor(binned));
+  for (size_t i1 = 0; i1 < 3; ++i1) {
+    for (size_t i0 = 0; i0 < 4; ++i0) {
+      BOOST_CHECK_EQUAL(view->materialSlab(i0, i1),
+                        binned.materialSlab(i0, i1));
+    }
+  }
+  for (double x : {-1.9, -0.3, 0.4, 1.7, 3.}) {
+    for (double y : {-0.9, -0.1, 0.5, 0.99}) {
+      Vector2 lposition(x, y);
+      BOOST_CHECK_EQUAL(view->materialSlab(lposition),
+                        binned.materialSlab(lposition));
+      Vector3 gposition(x, y, 10.);
+      BOOST_CHECK_EQUAL(view->materialSlab(gposition),
+                        binned.materialSlab(gposition));
+    }
+  }
+
+  const auto& homogeneous = *readMaps.first.at(homogeneousId);
+  BOOST_CHECK_EQUAL(homogeneous.materialSlab(0, 0),
+                    MaterialSlab(makeSilicon(), 0.5));
+  BOOST_CHECK_EQUAL(homogeneous.mappingType(), MappingType::Sensor);
+  BOOST_CHECK_EQUAL(splitFactor(homogeneous), 0.75);
+
+  auto proto = std::dynamic_pointer_cast<const ProtoSurfaceMaterial>(
+      readMaps.first.at(protoId));
+  BOOST_REQUIRE(proto != nullptr);
+  BOOST_CHECK(proto->binUtility() == surfaceBinning());
+  BOOST_CHECK_EQUAL(proto->mappingType(), MappingType::PreMapping);
+
+  // volume material
+  BOOST_CHECK_EQUAL(
+      readMaps.second.at(homogeneousVolumeId)->material({1., 2., 3.}),
+      makeBeryllium());
+  auto protoVolume = std::dynamic_pointer_cast<const ProtoVolumeMaterial>(
+      readMaps.second.at(protoVolumeId));
+  BOOST_REQUIRE(protoVolume != nullptr);
+  BOOST_CHECK(
+      protoVolume->binUtility() ==
+      dynamic_cast<const ProtoVolumeMaterial&>(*maps.second.at(protoVolumeId))
+          .binUtility());
+
+  const auto& grid = *maps.second.at(gridVolumeId);
+  auto readGrid = std::dynamic_pointer_cast<const Grid3DMap>(
+      readMaps.second.at(gridVolumeId));
+  BOOST_REQUIRE(readGrid != nullptr);
+  for (double x : {-0.9, -0.2, 0.35, 0.8}) {
+    for (double y : {-1.5, 0.1, 1.2}) {
+      for (double z : {-0.7, 0.2, 0.9}) {
+        Vector3 position(x, y, z);
+        BOOST_CHECK_EQUAL(readGrid->material(position),
+                          grid.material(position));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMapScaling) {
+  const std::string fileName = "BinaryMaterialMapScaling.actsmat";
+  BinaryMaterialMap::write(fileName, makeMaps());
+
+  auto first = BinaryMaterialMap::read(fileName);
+  auto second = BinaryMaterialMap::read(fileName);
+  auto material = std::const_pointer_cast<ISurfaceMaterial>(
+      first.first.at(binnedId));
+  MaterialSlab original = material->materialSlab(1, 2);
+  *material *= 2.;
+  CHECK_CLOSE_REL(material->materialSlab(1, 2).thickness(),
+                  2 * original.thickness(), 1e-6);
+  // scaling must neither touch the file nor other mappings of it
+  BOOST_CHECK_EQUAL(second.first.at(binnedId)->materialSlab(1, 2), original);
+  BOOST_CHECK_EQUAL(
+      BinaryMaterialMap::read(fileName).first.at(binnedId)->materialSlab(1, 2),
+      original);
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMapInvalidFiles) {
+  BOOST_CHECK_THROW(BinaryMaterialMap::read("DoesNotExist.actsmat"),
+                    std::runtime_error);
+
+  const std::string fileName = "BinaryMaterialMapInvalid.actsmat";
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs << "This is not a material map, but it is long enough for a header";
+  }
+  BOOST_CHECK_THROW(BinaryMaterialMap::read(fileName), std::runtime_error);
+
+  // truncated file
+  BinaryMaterialMap::write(fileName, makeMaps());
+  std::vector<char> bytes;
+  {
+    std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(ifs),
+                 std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs.write(bytes.data(), bytes.size() / 2);
+  }
+  BOOST_CHECK_THROW(BinaryMaterialMap::read(fileName), std::runtime_error);
+
+  // invalid number of bins in the arbitrary surface binning, i.e. the record
+  // {arbitrary, closed, binY, 3 bins}
+  const uint32_t binningRecord[] = {arbitrary, closed, binY, 3u};
+  for (uint32_t bins : {0u, std::numeric_limits<uint32_t>::max()}) {
+    std::vector<char> corrupted = bytes;
+    size_t nReplaced = 0;
+    for (size_t pos = 0; pos + sizeof(binningRecord) <= corrupted.size();
+         pos += alignof(uint32_t)) {
+      if (std::memcmp(&corrupted[pos], binningRecord, sizeof(binningRecord)) ==
+          0) {
+        std::memcpy(&corrupted[pos + 3 * sizeof(uint32_t)], &bins,
+                    sizeof(bins));
+        ++nReplaced;
+      }
+    }
+    BOOST_REQUIRE_NE(nReplaced, 0u);
+    {
+      std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+      ofs.write(corrupted.data(), corrupted.size());
+    }
+    BOOST_CHECK_THROW(BinaryMaterialMap::read(fileName), std::runtime_error);
+  }
+
+  // invalid slab matrix size of the binned surface material, i.e. the
+  // {bins0, bins1} = {4, 3} entries of its record following the identifier
+  const uint64_t binnedRecordId = binnedId.value();
+  const uint64_t binnedBins[] = {4u, 3u};
+  const uint64_t invalidBins[][2] = {
+      {2u, 3u}, {4u, 1u}, {uint64_t{1} << 62, 4u}, {0u, 3u}};
+  for (const auto& bins : invalidBins) {
+    std::vector<char> corrupted = bytes;
+    size_t nReplaced = 0;
+    for (size_t pos = 0; pos + 7 * sizeof(uint64_t) <= corrupted.size();
+         pos += alignof(uint64_t)) {
+      char* binsPos = &corrupted[pos + 5 * sizeof(uint64_t)];
+      if (std::memcmp(&corrupted[pos], &binnedRecordId, sizeof(uint64_t)) ==
+              0 and
+          std::memcmp(binsPos, binnedBins, sizeof(binnedBins)) == 0) {
+        std::memcpy(binsPos, bins, sizeof(binnedBins));
+        ++nReplaced;
+      }
+    }
+    BOOST_REQUIRE_EQUAL(nReplaced, 1u);
+    {
+      std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+      ofs.write(corrupted.data(), corrupted.size());
+    }
+    BOOST_CHECK_THROW(BinaryMaterialMap::read(fileName), std::runtime_error);
+  }
+  std::remove(fileName.c_str());
+
+  // unsupported material types are rejected when writing
+  DetectorMaterialMaps maps;
+  BinUtility sub(2, 0., 0.5, open, binX);
+  std::unique_ptr<const BinningData> subData =
+      std::make_unique<const BinningData>(sub.binningData()[0]);
+  BinUtility subBinned(BinningData(open, binX, 2, 0., 1., std::move(subData)));
+  maps.first[protoId] = std::make_shared<ProtoSurfaceMaterial>(subBinned);
+  BOOST_CHECK_THROW(BinaryMaterialMap::write(fileName, maps),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,141 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/CompactSteppingLogger.hpp"
+#include "Acts/Propagator/detail/SteppingLogger.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+using EigenPropagatorType = Propagator<EigenStepper<>, Navigator>;
+
+EigenPropagatorType makePropagator() {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  return EigenPropagatorType(EigenStepper<>(bField),
+                             Navigator({tGeometry}));
+}
+
+CurvilinearTrackParameters makeStart() {
+  return CurvilinearTrackParameters(Vector4(0, 0, 0, 0), 0.25 * M_PI,
+                                    0.4 * M_PI, 2_GeV, 1_e);
+}
+
+using Loggers =
+    ActionList<detail::SteppingLogger, detail::CompactSteppingLogger>;
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(CompactSteppingLogger)
+
+BOOST_AUTO_TEST_CASE(SameStepsAsSteppingLogger) {
+  auto propagator = makePropagator();
+  PropagatorOptions<Loggers> options(tgContext, mfContext, getDummyLogger());
+  options.maxStepSize = 5_cm;
+
+  auto result = propagator.propagate(makeStart(), options);
+  BOOST_REQUIRE(result.ok());
+  const auto& steps =
+      result.value().get<detail::SteppingLogger::result_type>().steps;
+  const auto& compact =
+      result.value().get<detail::CompactSteppingLogger::result_type>();
+
+  BOOST_REQUIRE(not steps.empty());
+  BOOST_REQUIRE_EQUAL(compact.size(), steps.size());
+  BOOST_CHECK_EQUAL(compact.nSkipped, 0u);
+  size_t nSurfaces = 0;
+  for (size_t i = 0; i < steps.size(); ++i) {
+    const auto& step = steps[i];
+    CHECK_CLOSE_ABS(compact.x[i], step.position.x(), 1e-3);
+    CHECK_CLOSE_ABS(compact.y[i], step.position.y(), 1e-3);
+    CHECK_CLOSE_ABS(compact.z[i], step.position.z(), 1e-3);
+    const Vector3 dir = step.momentum.normalized();
+    CHECK_CLOSE_ABS(compact.dx[i], dir.x(), 1e-6);
+    CHECK_CLOSE_ABS(compact.dy[i], dir.y(), 1e-6);
+    CHECK_CLOSE_ABS(compact.dz[i], dir.z(), 1e-6);
+    if (step.surface) {
+      BOOST_CHECK_EQUAL(compact.surfaceId[i], step.surface->geometryId());
+      ++nSurfaces;
+    } else {
+      BOOST_CHECK_EQUAL(compact.surfaceId[i], 0u);
+    }
+    BOOST_CHECK_EQUAL(compact.volumeId[i],
+                      step.volume ? step.volume->geometryId().value() : 0u);
+  }
+  BOOST_CHECK_GT(nSurfaces, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(SamplingAndCapacity) {
+  auto propagator = makePropagator();
+  PropagatorOptions<Loggers> options(tgContext, mfContext, getDummyLogger());
+  options.maxStepSize = 5_cm;
+  auto& compactLogger = options.actionList.get<detail::CompactSteppingLogger>();
+  compactLogger.sampling = 3;
+
+  auto result = propagator.propagate(makeStart(), options);
+  BOOST_REQUIRE(result.ok());
+  const auto& steps =
+      result.value().get<detail::SteppingLogger::result_type>().steps;
+  const auto& compact =
+      result.value().get<detail::CompactSteppingLogger::result_type>();
+
+  // all steps are accounted for and all geometry surfaces are kept
+  BOOST_CHECK_EQUAL(compact.size() + compact.nSkipped, steps.size());
+  BOOST_CHECK_LT(compact.size(), steps.size());
+  size_t nSurfaces = 0;
+  for (const auto& step : steps) {
+    // the start surface is not part of the geometry and has no identifier
+    nSurfaces += (step.surface != nullptr) and
+                 (step.surface->geometryId() != GeometryIdentifier());
+  }
+  size_t nCompactSurfaces = 0;
+  for (auto id : compact.surfaceId) {
+    nCompactSurfaces += (id != 0u);
+  }
+  BOOST_CHECK_EQUAL(nCompactSurfaces, nSurfaces);
+
+  // capacity limit
+  compactLogger.sampling = 1;
+  compactLogger.maxSteps = 4;
+  result = propagator.propagate(makeStart(), options);
+  BOOST_REQUIRE(result.ok());
+  const auto& capped =
+      result.value().get<detail::CompactSteppingLogger::result_type>();
+  BOOST_CHECK_EQUAL(capped.size(), 4u);
+  BOOST_CHECK_EQUAL(capped.size() + capped.nSkipped, steps.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
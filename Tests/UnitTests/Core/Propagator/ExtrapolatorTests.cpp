@@ -13,6 +13,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/FrozenSurfaceTable.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
@@ -180,6 +181,59 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+// This test case checks that the navigation with a frozen surface table
+// collects the same surfaces as the regular navigation
+BOOST_DATA_TEST_CASE(
+    test_frozen_surface_navigation_,
+    bdata::random((bdata::seed = 15,
+                   bdata::distribution =
+                       std::uniform_real_distribution<>(0.4_GeV, 10_GeV))) ^
+        bdata::random((bdata::seed = 16,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-M_PI, M_PI))) ^
+        bdata::random((bdata::seed = 17,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(1.0, M_PI - 1.0))) ^
+        bdata::random(
+            (bdata::seed = 18,
+             bdata::distribution = std::uniform_int_distribution<>(0, 1))) ^
+        bdata::xrange(ntests),
+    pT, phi, theta, charge, index) {
+  double p = pT / sin(theta);
+  double q = -1 + 2 * charge;
+  (void)index;
+
+  CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), phi, theta, p, q);
+
+  // The same propagator, but navigating with the frozen surface table
+  Navigator::Config frozenCfg{tGeometry};
+  frozenCfg.frozenSurfaces =
+      std::make_shared<const FrozenSurfaceTable>(tgContext, *tGeometry);
+  EigenPropagatorType frozenPropagator{EigenStepperType(bField),
+                                       Navigator(frozenCfg)};
+
+  using SensitiveCollector = SurfaceCollector<SurfaceSelector>;
+
+  PropagatorOptions<ActionList<SensitiveCollector>> options(
+      tgContext, mfContext, getDummyLogger());
+  options.maxStepSize = 10_cm;
+  options.pathLimit = 25_cm;
+
+  const auto& result = epropagator.propagate(start, options).value();
+  const auto& frozenResult = frozenPropagator.propagate(start, options).value();
+
+  const auto& collected =
+      result.get<SensitiveCollector::result_type>().collected;
+  const auto& frozenCollected =
+      frozenResult.get<SensitiveCollector::result_type>().collected;
+  BOOST_REQUIRE_EQUAL(frozenCollected.size(), collected.size());
+  for (size_t i = 0; i < collected.size(); ++i) {
+    BOOST_CHECK_EQUAL(frozenCollected[i].surface, collected[i].surface);
+    CHECK_CLOSE_ABS(frozenCollected[i].position, collected[i].position,
+                    1_um);
+  }
+}
+
 // This test case checks that no segmentation fault appears
 // - this tests the collection of surfaces
 BOOST_DATA_TEST_CASE(
@@ -0,0 +1,172 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/OrderedSurfaceNavigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/detail/SteppingLogger.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+using Options = PropagatorOptions<ActionList<detail::SteppingLogger>>;
+
+/// Collect the surfaces that were hit during the propagation
+template <typename propagator_t, typename parameters_t>
+std::vector<const Surface*> hitSurfaces(const propagator_t& propagator,
+                                        const parameters_t& start,
+                                        NavigationDirection navDir) {
+  Options options(tgContext, mfContext, getDummyLogger());
+  options.direction = navDir;
+  auto result = propagator.propagate(start, options);
+  BOOST_REQUIRE(result.ok());
+  std::vector<const Surface*> surfaces;
+  for (const auto& step :
+       result.value().template get<detail::SteppingLogger::result_type>()
+           .steps) {
+    if (step.surface and step.surface.get() != &start.referenceSurface()) {
+      surfaces.push_back(step.surface.get());
+    }
+  }
+  return surfaces;
+}
+
+std::shared_ptr<const PlaneSurface> makePlane(double z, double halfLength) {
+  return Surface::makeShared<PlaneSurface>(
+      Transform3(Translation3(0., 0., z)),
+      std::make_shared<const RectangleBounds>(halfLength, halfLength));
+}
+
+std::shared_ptr<const CylinderSurface> makeCylinder(double r) {
+  return Surface::makeShared<CylinderSurface>(Transform3::Identity(), r,
+                                              500_mm);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(OrderedSurfaceNavigator)
+
+BOOST_AUTO_TEST_CASE(Construction) {
+  BOOST_CHECK_THROW(TelescopeNavigator(tgContext, {}), std::invalid_argument);
+  BOOST_CHECK_THROW(TelescopeNavigator(tgContext, {{nullptr}, nullptr}),
+                    std::invalid_argument);
+
+  // surfaces are sorted along the telescope axis
+  auto p0 = makePlane(100_mm, 50_mm);
+  auto p1 = makePlane(200_mm, 50_mm);
+  auto p2 = makePlane(300_mm, 50_mm);
+  TelescopeNavigator navigator(tgContext, {{p2, p0, p1}, nullptr});
+  BOOST_CHECK_EQUAL(navigator.surfaces().size(), 3u);
+  BOOST_CHECK_EQUAL(navigator.surfaces()[0], p0.get());
+  BOOST_CHECK_EQUAL(navigator.surfaces()[1], p1.get());
+  BOOST_CHECK_EQUAL(navigator.surfaces()[2], p2.get());
+
+  auto c0 = makeCylinder(30_mm);
+  auto c1 = makeCylinder(60_mm);
+  BarrelNavigator barrel(tgContext, {{c1, c0}, nullptr});
+  BOOST_CHECK_EQUAL(barrel.surfaces()[0], c0.get());
+  BOOST_CHECK_EQUAL(barrel.surfaces()[1], c1.get());
+}
+
+BOOST_AUTO_TEST_CASE(Telescope) {
+  std::vector<std::shared_ptr<const PlaneSurface>> planes;
+  for (double z : {500_mm, 100_mm, 400_mm, 200_mm, 300_mm}) {
+    // the plane at 300mm is too small to be hit by the test tracks
+    planes.push_back(makePlane(z, z == 300_mm ? 1_mm : 50_mm));
+  }
+  TelescopeNavigator navigator(tgContext, {planes, nullptr});
+  const auto& ordered = navigator.surfaces();
+  Propagator<StraightLineStepper, TelescopeNavigator> propagator(
+      StraightLineStepper(), navigator);
+
+  // forward through all planes, skipping the missed one
+  CurvilinearTrackParameters start(Vector4(10_mm, 0, 0, 0), 0., 0.05, 1_GeV,
+                                   1_e);
+  auto surfaces = hitSurfaces(propagator, start, NavigationDirection::Forward);
+  BOOST_CHECK_EQUAL(surfaces.size(), 4u);
+  std::vector<const Surface*> expected = {ordered[0], ordered[1], ordered[3],
+                                          ordered[4]};
+  BOOST_CHECK_EQUAL_COLLECTIONS(surfaces.begin(), surfaces.end(),
+                                expected.begin(), expected.end());
+
+  // start on a plane and propagate backwards
+  auto onPlane =
+      BoundTrackParameters::create(ordered[3]->getSharedPtr(), tgContext,
+                                   Vector4(10_mm, 0, 400_mm, 0),
+                                   Vector3(0, 0, 1), 1_GeV, 1_e)
+          .value();
+  surfaces = hitSurfaces(propagator, onPlane, NavigationDirection::Backward);
+  expected = {ordered[1], ordered[0]};
+  BOOST_CHECK_EQUAL_COLLECTIONS(surfaces.begin(), surfaces.end(),
+                                expected.begin(), expected.end());
+
+  // moving away from the telescope
+  CurvilinearTrackParameters away(Vector4(0, 0, 0, 0), 0., M_PI, 1_GeV, 1_e);
+  surfaces = hitSurfaces(propagator, away, NavigationDirection::Forward);
+  BOOST_CHECK(surfaces.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Barrel) {
+  std::vector<std::shared_ptr<const CylinderSurface>> cylinders;
+  for (double r : {120_mm, 30_mm, 90_mm, 60_mm}) {
+    cylinders.push_back(makeCylinder(r));
+  }
+  BarrelNavigator navigator(tgContext, {cylinders, nullptr});
+  const auto& ordered = navigator.surfaces();
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  Propagator<EigenStepper<>, BarrelNavigator> propagator(
+      EigenStepper<>(bField), navigator);
+
+  // outwards through all cylinders
+  CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), 0.3, M_PI_2, 1_GeV,
+                                   1_e);
+  auto surfaces = hitSurfaces(propagator, start, NavigationDirection::Forward);
+  BOOST_CHECK_EQUAL_COLLECTIONS(surfaces.begin(), surfaces.end(),
+                                ordered.begin(), ordered.end());
+
+  // low momentum track turns around before the outermost cylinder
+  CurvilinearTrackParameters looper(Vector4(0, 0, 0, 0), 0.3, M_PI_2, 30_MeV,
+                                    1_e);
+  surfaces = hitSurfaces(propagator, looper, NavigationDirection::Forward);
+  BOOST_CHECK_EQUAL_COLLECTIONS(surfaces.begin(), surfaces.end(),
+                                ordered.begin(), ordered.begin() + 3);
+
+  // leaves the barrel through the end before the outer cylinders
+  CurvilinearTrackParameters forward(Vector4(0, 0, 0, 0), 0.3, 0.1, 10_GeV,
+                                     1_e);
+  surfaces = hitSurfaces(propagator, forward, NavigationDirection::Forward);
+  BOOST_CHECK_EQUAL_COLLECTIONS(surfaces.begin(), surfaces.end(),
+                                ordered.begin(), ordered.begin() + 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -354,5 +354,54 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+BOOST_AUTO_TEST_CASE(reused_result) {
+  using Options = PropagatorOptions<ActionList<PerpendicularMeasure>>;
+  Options options(tgContext, mfContext, getDummyLogger());
+  options.pathLimit = 10_m;
+  options.maxStepSize = 1_cm;
+
+  Covariance cov = Covariance::Identity();
+  EigenPropagatorType::ResultType<BoundTrackParameters, Options> result;
+  const BoundTrackParameters* storage = nullptr;
+  for (double phi : {-2., -0.5, 1., 2.5}) {
+    CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), phi, 1.2, 1_GeV,
+                                     1_e, cov);
+    // reference with a fresh result
+    auto reference = epropagator.propagate(start, *cSurface, options);
+    BOOST_REQUIRE(reference.ok());
+
+    BOOST_REQUIRE(
+        epropagator.propagate(start, *cSurface, options, result).ok());
+    // the storage of the end parameters is allocated only once
+    if (storage == nullptr) {
+      storage = result.endParameters.get();
+    }
+    BOOST_CHECK_EQUAL(result.endParameters.get(), storage);
+
+    // results must not depend on the previous propagations
+    const auto& ref = *reference;
+    BOOST_CHECK_EQUAL(result.steps, ref.steps);
+    CHECK_CLOSE_ABS(result.pathLength, ref.pathLength, 1e-9);
+    CHECK_CLOSE_ABS(result.endParameters->parameters(),
+                    ref.endParameters->parameters(), 1e-9);
+    CHECK_CLOSE_ABS(*result.transportJacobian, *ref.transportJacobian, 1e-9);
+    CHECK_CLOSE_ABS(result.get<PerpendicularMeasure::result_type>().distance,
+                    ref.get<PerpendicularMeasure::result_type>().distance,
+                    1e-9);
+  }
+
+  // no covariance transport, no jacobian
+  EigenPropagatorType::ResultType<CurvilinearTrackParameters, Options>
+      curvResult;
+  CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), 0., 1.2, 1_GeV, 1_e,
+                                   cov);
+  BOOST_REQUIRE(epropagator.propagate(start, options, curvResult).ok());
+  BOOST_CHECK(curvResult.transportJacobian);
+  CurvilinearTrackParameters noCov(Vector4(0, 0, 0, 0), 0., 1.2, 1_GeV, 1_e);
+  BOOST_REQUIRE(epropagator.propagate(noCov, options, curvResult).ok());
+  BOOST_CHECK(not curvResult.transportJacobian);
+  BOOST_CHECK(curvResult.endParameters);
+}
+
 }  // namespace Test
 }  // namespace Acts
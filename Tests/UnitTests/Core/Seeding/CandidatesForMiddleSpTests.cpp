@@ -0,0 +1,167 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using InternalSP = InternalSpacePoint<SpacePoint>;
+
+std::vector<SpacePoint> makeSpacePoints(size_t n, std::mt19937& rng) {
+  std::uniform_real_distribution<float> xyDist(-300., 300.);
+  std::uniform_real_distribution<float> zDist(-1000., 1000.);
+  std::vector<SpacePoint> spacePoints;
+  for (size_t i = 0; i < n; ++i) {
+    SpacePoint sp{xyDist(rng), xyDist(rng), zDist(rng), 0., 0, 0., 0.};
+    sp.m_r = std::hypot(sp.m_x, sp.m_y);
+    spacePoints.push_back(sp);
+  }
+  return spacePoints;
+}
+
+std::vector<std::unique_ptr<InternalSP>> makeInternal(
+    const std::vector<SpacePoint>& spacePoints) {
+  std::vector<std::unique_ptr<InternalSP>> internal;
+  for (const auto& sp : spacePoints) {
+    internal.push_back(std::make_unique<InternalSP>(
+        sp, Vector3(sp.x(), sp.y(), sp.z()), Vector2(0., 0.),
+        Vector2(0., 0.)));
+  }
+  return internal;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Seeding)
+
+BOOST_AUTO_TEST_CASE(CandidatesForMiddleSpKeepsBest) {
+  std::mt19937 rng(42);
+  auto spacePoints = makeSpacePoints(50, rng);
+  auto internal = makeInternal(spacePoints);
+
+  CandidatesForMiddleSp<SpacePoint> collector;
+  collector.setMaxElements(5, 2);
+
+  std::vector<float> lowWeights;
+  std::vector<float> highWeights;
+  std::uniform_real_distribution<float> weightDist(-100., 100.);
+  for (size_t i = 2; i < internal.size(); ++i) {
+    float weight = weightDist(rng);
+    bool isQuality = (i % 3 == 0);
+    (isQuality ? highWeights : lowWeights).push_back(weight);
+    collector.push(*internal[0], *internal[1], *internal[i], weight, 0.,
+                   isQuality);
+  }
+  BOOST_CHECK_EQUAL(collector.nLowQualityCandidates(), 5u);
+  BOOST_CHECK_EQUAL(collector.nHighQualityCandidates(), 2u);
+
+  std::sort(lowWeights.begin(), lowWeights.end(), std::greater<float>());
+  std::sort(highWeights.begin(), highWeights.end(), std::greater<float>());
+  std::vector<float> expected(lowWeights.begin(), lowWeights.begin() + 5);
+  expected.insert(expected.end(), highWeights.begin(), highWeights.begin() + 2);
+  std::sort(expected.begin(), expected.end(), std::greater<float>());
+
+  const auto& sorted = collector.sortedCandidates();
+  BOOST_CHECK_EQUAL(sorted.size(), expected.size());
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    BOOST_CHECK_EQUAL(sorted[i].weight, expected[i]);
+  }
+
+  collector.clear();
+  BOOST_CHECK_EQUAL(collector.nLowQualityCandidates(), 0u);
+  BOOST_CHECK_EQUAL(collector.nHighQualityCandidates(), 0u);
+  BOOST_CHECK(collector.sortedCandidates().empty());
+}
+
+// The seed filter must select the same seeds with the candidates collector as
+// with the owning seed vector.
+BOOST_AUTO_TEST_CASE(SeedFilterCandidatesMatchSeedVector) {
+  std::mt19937 rng(1234);
+  auto spacePoints = makeSpacePoints(60, rng);
+  // seeds modify the quality of their space points, use separate copies
+  auto internalVector = makeInternal(spacePoints);
+  auto internalCollector = makeInternal(spacePoints);
+
+  for (bool sorting : {false, true}) {
+    SeedFilterConfig cfg;
+    cfg.maxSeedsPerSpM = 3;
+    cfg.curvatureSortingInFilter = sorting;
+    SeedFilter<SpacePoint> filter(cfg);
+
+    std::vector<
+        std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
+        seedVector;
+    CandidatesForMiddleSp<SpacePoint> collector;
+    collector.setMaxElements(cfg.maxSeedsPerSpM + 1,
+                             std::numeric_limits<int>::max());
+    int numQualityVector = 0;
+    int numSeedsVector = 0;
+    int numQualityCollector = 0;
+    int numSeedsCollector = 0;
+
+    std::uniform_real_distribution<float> curvatureDist(-0.01, 0.01);
+    std::uniform_real_distribution<float> impactDist(0., 2.);
+    // one middle SP, a few bottom SP and the remaining ones as top SP
+    for (size_t b = 1; b < 5; ++b) {
+      std::vector<InternalSP*> topVector;
+      std::vector<InternalSP*> topCollector;
+      std::vector<float> curvatures;
+      std::vector<float> impacts;
+      for (size_t t = 5; t < spacePoints.size(); ++t) {
+        topVector.push_back(internalVector[t].get());
+        topCollector.push_back(internalCollector[t].get());
+        curvatures.push_back(curvatureDist(rng));
+        impacts.push_back(impactDist(rng));
+      }
+      float zOrigin = spacePoints[b].z() * 0.01;
+      filter.filterSeeds_2SpFixed(*internalVector[b], *internalVector[0],
+                                  topVector, curvatures, impacts, zOrigin,
+                                  numQualityVector, numSeedsVector,
+                                  seedVector);
+      filter.filterSeeds_2SpFixed(*internalCollector[b], *internalCollector[0],
+                                  topCollector, curvatures, impacts, zOrigin,
+                                  numQualityCollector, numSeedsCollector,
+                                  collector);
+    }
+
+    std::vector<Seed<SpacePoint>> seedsVector;
+    std::vector<Seed<SpacePoint>> seedsCollector;
+    filter.filterSeeds_1SpFixed(seedVector, numQualityVector,
+                                std::back_inserter(seedsVector));
+    filter.filterSeeds_1SpFixed(collector, numQualityCollector,
+                                std::back_inserter(seedsCollector));
+
+    BOOST_CHECK_EQUAL(seedsVector.size(), cfg.maxSeedsPerSpM + 1);
+    BOOST_CHECK_EQUAL(seedsCollector.size(), seedsVector.size());
+    for (size_t i = 0; i < seedsVector.size(); ++i) {
+      BOOST_CHECK(seedsCollector[i].sp() == seedsVector[i].sp());
+      BOOST_CHECK_EQUAL(seedsCollector[i].z(), seedsVector[i].z());
+      BOOST_CHECK_EQUAL(seedsCollector[i].seedQuality(),
+                        seedsVector[i].seedQuality());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
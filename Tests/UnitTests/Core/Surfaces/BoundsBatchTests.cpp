@@ -0,0 +1,168 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Surfaces/detail/BoundsBatchHelper.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <random>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+/// Random points in the given box plus a regular grid that also hits the
+/// edges and corners of the bounds exactly
+BoundaryCheck::LocalPositions makePoints(const Vector2& lowerLeft,
+                                         const Vector2& upperRight,
+                                         double gridStep) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> loc0(lowerLeft[0], upperRight[0]);
+  std::uniform_real_distribution<double> loc1(lowerLeft[1], upperRight[1]);
+  std::vector<Vector2> points;
+  for (int i = 0; i < 2000; ++i) {
+    points.emplace_back(loc0(rng), loc1(rng));
+  }
+  for (double x = lowerLeft[0]; x <= upperRight[0]; x += gridStep) {
+    for (double y = lowerLeft[1]; y <= upperRight[1]; y += gridStep) {
+      points.emplace_back(x, y);
+    }
+  }
+  BoundaryCheck::LocalPositions result(points.size(), 2);
+  for (size_t i = 0; i < points.size(); ++i) {
+    result.row(i) = points[i].transpose();
+  }
+  return result;
+}
+
+std::vector<BoundaryCheck> makeChecks(const SymMatrix2& cov) {
+  return {BoundaryCheck(false), BoundaryCheck(true),
+          BoundaryCheck(true, false, 0.5, 0.),
+          BoundaryCheck(true, true, 0.5, 0.25), BoundaryCheck(cov, 1.),
+          BoundaryCheck(cov, 3.)};
+}
+
+/// The batched check must be identical to the single position check
+void checkBatch(const SurfaceBounds& bounds,
+                const BoundaryCheck::LocalPositions& points,
+                const std::vector<BoundaryCheck>& checks) {
+  BoundaryCheck::InsideMask inside;
+  for (const auto& bcheck : checks) {
+    bounds.insideBatch(points, bcheck, inside);
+    BOOST_REQUIRE_EQUAL(inside.size(), points.rows());
+    size_t nMismatches = 0;
+    for (Eigen::Index i = 0; i < points.rows(); ++i) {
+      const Vector2 point = points.row(i).transpose();
+      nMismatches += (inside[i] != bounds.inside(point, bcheck));
+    }
+    BOOST_CHECK_EQUAL(nMismatches, 0u);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+BOOST_AUTO_TEST_CASE(BoundaryCheckBatch) {
+  const std::vector<Vector2> poly = {
+      {0.4, 0.25}, {0.6, 0.25}, {0.8, 0.75}, {0.2, 0.75}};
+  const Vector2 ll(0.2, 0.25);
+  const Vector2 ur(0.8, 0.75);
+  SymMatrix2 cov;
+  cov << 0.02, 0.005, 0.005, 0.03;
+  auto points = makePoints({-0.5, -0.5}, {1.5, 1.5}, 0.05);
+
+  BoundaryCheck::InsideMask insidePoly, insideBox;
+  BoundaryCheck::Distances distancesPoly, distancesBox;
+  for (const auto& bcheck : makeChecks(cov)) {
+    bcheck.isInside(points, poly, insidePoly);
+    bcheck.isInside(points, ll, ur, insideBox);
+    bcheck.distance(points, poly, distancesPoly);
+    bcheck.distance(points, ll, ur, distancesBox);
+    for (Eigen::Index i = 0; i < points.rows(); ++i) {
+      const Vector2 point = points.row(i).transpose();
+      BOOST_CHECK_EQUAL(insidePoly[i], bcheck.isInside(point, poly));
+      BOOST_CHECK_EQUAL(insideBox[i], bcheck.isInside(point, ll, ur));
+      CHECK_CLOSE_ABS(distancesPoly[i], bcheck.distance(point, poly), 1e-12);
+      CHECK_CLOSE_ABS(distancesBox[i], bcheck.distance(point, ll, ur), 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PlanarBoundsBatch) {
+  SymMatrix2 cov;
+  cov << 0.5, 0.1, 0.1, 0.3;
+  auto checks = makeChecks(cov);
+  auto points = makePoints({-6., -6.}, {6., 6.}, 0.5);
+
+  checkBatch(RectangleBounds(Vector2(-3., -2.), Vector2(4., 5.)), points,
+             checks);
+  checkBatch(TrapezoidBounds(2., 4., 3.), points, checks);
+  checkBatch(TrapezoidBounds(4., 1., 5.), points, checks);
+  checkBatch(DiamondBounds(2., 4., 1., 2., 3.), points, checks);
+  checkBatch(ConvexPolygonBounds<3>({{-3., -2.}, {4., -1.}, {0., 5.}}),
+             points, checks);
+  checkBatch(ConvexPolygonBounds<PolygonDynamic>(
+                 {{-4., -2.}, {1., -3.}, {4., 0.}, {2., 4.}, {-3., 3.}}),
+             points, checks);
+}
+
+BOOST_AUTO_TEST_CASE(AnnulusBoundsBatch) {
+  SymMatrix2 cov;
+  cov << 0.5, 0., 0., 0.001;
+  auto checks = makeChecks(cov);
+  // local positions are in the polar coordinates of the strip system
+  auto points = makePoints({5., 0.5}, {15., 1.6}, 0.05);
+
+  checkBatch(AnnulusBounds(7.2, 12.0, 0.74195, 1.33970, Vector2(-2., 2.)),
+             points, checks);
+}
+
+BOOST_AUTO_TEST_CASE(RectangleBoundsManyBounds) {
+  SymMatrix2 cov;
+  cov << 0.5, 0.1, 0.1, 0.3;
+  std::vector<RectangleBounds> rectangles;
+  for (double x = -5.; x < 5.; x += 0.5) {
+    for (double y = -5.; y < 5.; y += 1.) {
+      rectangles.emplace_back(Vector2(x, y), Vector2(x + 1., y + 0.5));
+    }
+  }
+  std::vector<const RectangleBounds*> bounds;
+  for (const auto& rectangle : rectangles) {
+    bounds.push_back(&rectangle);
+  }
+
+  BoundaryCheck::InsideMask inside;
+  for (const auto& bcheck : makeChecks(cov)) {
+    for (const Vector2& lposition :
+         {Vector2(0.2, 0.3), Vector2(0., 0.), Vector2(1., 0.5),
+          Vector2(-4.75, 4.2)}) {
+      detail::BoundsBatchHelper::insideBounds(bounds, lposition, bcheck,
+                                              inside);
+      BOOST_REQUIRE_EQUAL(inside.size(), bounds.size());
+      for (size_t i = 0; i < bounds.size(); ++i) {
+        BOOST_CHECK_EQUAL(inside[i], bounds[i]->inside(lposition, bcheck));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
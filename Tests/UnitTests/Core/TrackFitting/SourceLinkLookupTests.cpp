@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFitting/detail/SourceLinkLookup.hpp"
+
+#include <vector>
+
+using namespace Acts;
+using Acts::detail::SourceLinkLookup;
+using Acts::Test::TestSourceLink;
+
+namespace {
+
+GeometryIdentifier makeId(GeometryIdentifier::Value layer,
+                          GeometryIdentifier::Value sensitive) {
+  return GeometryIdentifier().setVolume(2).setLayer(layer).setSensitive(
+      sensitive);
+}
+
+TestSourceLink makeSourceLink(GeometryIdentifier geoId, size_t sourceId) {
+  return TestSourceLink(eBoundLoc0, 0.0, 1.0, geoId, sourceId);
+}
+
+size_t sourceId(SourceLinkLookup::const_iterator it) {
+  return static_cast<const TestSourceLink&>(it->second.get()).sourceId;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFittingSourceLinkLookup)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+  std::vector<TestSourceLink> sourceLinks;
+  SourceLinkLookup lookup(sourceLinks.begin(), sourceLinks.end());
+  BOOST_CHECK(lookup.empty());
+  BOOST_CHECK_EQUAL(lookup.size(), 0u);
+  BOOST_CHECK(lookup.find(makeId(2, 1)) == lookup.end());
+}
+
+BOOST_AUTO_TEST_CASE(UnsortedWithDuplicates) {
+  std::vector<TestSourceLink> sourceLinks = {
+      makeSourceLink(makeId(6, 1), 0u), makeSourceLink(makeId(2, 3), 1u),
+      makeSourceLink(makeId(4, 2), 2u), makeSourceLink(makeId(2, 3), 3u),
+      makeSourceLink(makeId(2, 1), 4u),
+  };
+  SourceLinkLookup lookup(sourceLinks.begin(), sourceLinks.end());
+
+  // the duplicated identifier only keeps the first source link
+  BOOST_CHECK_EQUAL(lookup.size(), 4u);
+  BOOST_CHECK(std::is_sorted(
+      lookup.begin(), lookup.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }));
+  BOOST_CHECK_EQUAL(sourceId(lookup.find(makeId(2, 3))), 1u);
+
+  // lookups in any order, including identifiers that are not present
+  BOOST_CHECK_EQUAL(sourceId(lookup.find(makeId(6, 1))), 0u);
+  BOOST_CHECK_EQUAL(sourceId(lookup.find(makeId(2, 1))), 4u);
+  BOOST_CHECK(lookup.find(makeId(4, 1)) == lookup.end());
+  BOOST_CHECK(lookup.find(makeId(8, 1)) == lookup.end());
+  BOOST_CHECK_EQUAL(sourceId(lookup.find(makeId(4, 2))), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(TrajectoryOrder) {
+  std::vector<TestSourceLink> sourceLinks;
+  for (GeometryIdentifier::Value layer = 2; layer <= 60; layer += 2) {
+    sourceLinks.push_back(makeSourceLink(makeId(layer, 1), layer));
+  }
+  SourceLinkLookup lookup(sourceLinks.begin(), sourceLinks.end());
+  BOOST_CHECK_EQUAL(lookup.size(), sourceLinks.size());
+
+  // forward and backward along the trajectory with surfaces in between
+  for (GeometryIdentifier::Value layer = 2; layer <= 60; ++layer) {
+    auto it = lookup.find(makeId(layer, 1));
+    BOOST_CHECK_EQUAL(it != lookup.end(), layer % 2 == 0);
+    BOOST_CHECK((it == lookup.end()) or (sourceId(it) == layer));
+  }
+  for (GeometryIdentifier::Value layer = 60; 2 <= layer; layer -= 2) {
+    auto it = lookup.find(makeId(layer, 1));
+    BOOST_REQUIRE(it != lookup.end());
+    BOOST_CHECK_EQUAL(sourceId(it), layer);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
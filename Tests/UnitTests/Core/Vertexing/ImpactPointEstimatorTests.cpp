@@ -235,4 +235,65 @@ BOOST_DATA_TEST_CASE(SingeTrackImpactParameters, tracks* vertices, d0, l0, t0,
   // restricted further?
 }
 
+// Check that the batched `.estimateImpactParameters` and
+// `.estimate3DImpactParameters` agree with the single track versions.
+BOOST_AUTO_TEST_CASE(MultipleTrackImpactParameters) {
+  Estimator ipEstimator = makeEstimator(1_T);
+  Estimator::State state(magFieldCache());
+
+  Vector3 refPosition(0., 0., 0.);
+  auto perigeeSurface = Surface::makeShared<PerigeeSurface>(refPosition);
+  Vertex<BoundTrackParameters> myConstraint(Vector4(10_um, -10_um, 5_mm, 0.),
+                                            makeVertexCovariance(), {});
+
+  std::vector<BoundTrackParameters> tracks;
+  for (double phi : {-45_degree, 0_degree, 135_degree}) {
+    for (double theta : {20_degree, 90_degree, 160_degree}) {
+      for (double q : {-1_e, 1_e}) {
+        BoundVector par;
+        par[eBoundLoc0] = 25_um;
+        par[eBoundLoc1] = -1_mm;
+        par[eBoundTime] = 1_ns;
+        par[eBoundPhi] = phi;
+        par[eBoundTheta] = theta;
+        par[eBoundQOverP] = q / 2_GeV;
+        tracks.emplace_back(perigeeSurface, par,
+                            makeBoundParametersCovariance());
+      }
+    }
+  }
+  std::vector<const BoundTrackParameters*> trackPtrs;
+  for (const auto& track : tracks) {
+    trackPtrs.push_back(&track);
+  }
+
+  auto batchIPs = ipEstimator.estimateImpactParameters(
+      trackPtrs, myConstraint, geoContext, magFieldContext);
+  auto batch3D = ipEstimator.estimate3DImpactParameters(
+      geoContext, magFieldContext, trackPtrs,
+      myConstraint.position(), state);
+  BOOST_CHECK_EQUAL(batchIPs.size(), tracks.size());
+  BOOST_CHECK_EQUAL(batch3D.size(), tracks.size());
+
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    ImpactParametersAndSigma single =
+        ipEstimator
+            .estimateImpactParameters(tracks[i], myConstraint, geoContext,
+                                      magFieldContext)
+            .value();
+    ImpactParametersAndSigma batch = batchIPs[i].value();
+    BOOST_CHECK_EQUAL(batch.IPd0, single.IPd0);
+    BOOST_CHECK_EQUAL(batch.IPz0, single.IPz0);
+    BOOST_CHECK_EQUAL(batch.sigmad0, single.sigmad0);
+    BOOST_CHECK_EQUAL(batch.sigmaz0, single.sigmaz0);
+
+    auto single3D = ipEstimator.estimate3DImpactParameters(
+        geoContext, magFieldContext, tracks[i], myConstraint.position(),
+        state);
+    BOOST_CHECK(single3D.ok());
+    BOOST_CHECK(batch3D[i].ok());
+    BOOST_CHECK_EQUAL((*batch3D[i])->parameters(), (*single3D)->parameters());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
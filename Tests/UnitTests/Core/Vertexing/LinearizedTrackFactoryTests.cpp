@@ -20,6 +20,7 @@
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/LinearizerConcept.hpp"
 
 namespace bdata = boost::unit_test::data;
 using namespace Acts::UnitLiterals;
@@ -57,6 +58,25 @@ std::uniform_real_distribution<> resAngDist(0., 0.1);
 // Track q/p resolution distribution
 std::uniform_real_distribution<> resQoPDist(-0.1, 0.1);
 
+// A linearizer that only provides the single track interface
+struct SingleTrackLinearizer {
+  using Propagator_t = Linearizer::Propagator_t;
+  using State = Linearizer::State;
+
+  const Linearizer* linearizer = nullptr;
+
+  Result<LinearizedTrack> linearizeTrack(const BoundTrackParameters& params,
+                                         const Vector4& linPoint,
+                                         const GeometryContext& gctx,
+                                         const MagneticFieldContext& mctx,
+                                         State& state) const {
+    return linearizer->linearizeTrack(params, linPoint, gctx, mctx, state);
+  }
+};
+
+static_assert(LinearizerConcept<SingleTrackLinearizer>,
+              "The batched interface must be optional");
+
 ///
 /// @brief Unit test for HelicalTrackLinearizer
 ///
@@ -241,5 +261,82 @@ BOOST_AUTO_TEST_CASE(linearized_track_factory_straightline_test) {
   }
 }
 
+///
+/// @brief Unit test for the batched HelicalTrackLinearizer interface
+///
+BOOST_AUTO_TEST_CASE(linearized_track_factory_batch_test) {
+  // Number of tracks
+  unsigned int nTracks = 50;
+
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up constant B-Field
+  auto bField = std::make_shared<ConstantBField>(Vector3{0.0, 0.0, 2_T});
+
+  // Set up propagator with void navigator
+  EigenStepper<> stepper(bField);
+  auto propagator = std::make_shared<Propagator<EigenStepper<>>>(stepper);
+
+  // Create perigee surface
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+
+  std::vector<BoundTrackParameters> tracks;
+  for (unsigned int iTrack = 0; iTrack < nTracks; iTrack++) {
+    double q = qDist(gen) < 0 ? -1. : 1.;
+    BoundVector paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), phiDist(gen), thetaDist(gen),
+        q / pTDist(gen), 0.;
+    BoundVector stddev;
+    stddev << resIPDist(gen), resIPDist(gen), resAngDist(gen),
+        resAngDist(gen), resQoPDist(gen), 1.;
+    Covariance covMat = stddev.cwiseProduct(stddev).asDiagonal();
+    tracks.emplace_back(perigeeSurface, paramVec, std::move(covMat));
+  }
+  std::vector<const BoundTrackParameters*> trackPtrs;
+  for (const auto& track : tracks) {
+    trackPtrs.push_back(&track);
+  }
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linFactory(ltConfig);
+  Linearizer::State state(bField->makeCache(magFieldContext));
+
+  Vector4 linPoint(0.05_mm, -0.05_mm, 1_mm, 0.);
+  auto linTracks = linFactory.linearizeTracks(trackPtrs, linPoint, geoContext,
+                                              magFieldContext, state);
+  BOOST_CHECK_EQUAL(linTracks.size(), tracks.size());
+
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    LinearizedTrack single = linFactory
+                                 .linearizeTrack(tracks[i], linPoint,
+                                                 geoContext, magFieldContext,
+                                                 state)
+                                 .value();
+    LinearizedTrack batch = linTracks[i].value();
+    BOOST_CHECK_EQUAL(batch.parametersAtPCA, single.parametersAtPCA);
+    BOOST_CHECK_EQUAL(batch.covarianceAtPCA, single.covarianceAtPCA);
+    BOOST_CHECK_EQUAL(batch.linearizationPoint, single.linearizationPoint);
+    BOOST_CHECK_EQUAL(batch.positionJacobian, single.positionJacobian);
+    BOOST_CHECK_EQUAL(batch.momentumJacobian, single.momentumJacobian);
+    BOOST_CHECK_EQUAL(batch.constantTerm, single.constantTerm);
+  }
+
+  // Linearizers without the batched interface fall back to single tracks
+  SingleTrackLinearizer singleLinFactory{&linFactory};
+  auto fallbackTracks = Acts::linearizeTracks(
+      singleLinFactory, trackPtrs, linPoint, geoContext, magFieldContext,
+      state);
+  BOOST_CHECK_EQUAL(fallbackTracks.size(), tracks.size());
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_CHECK_EQUAL(fallbackTracks[i].value().parametersAtPCA,
+                      linTracks[i].value().parametersAtPCA);
+    BOOST_CHECK_EQUAL(fallbackTracks[i].value().covarianceAtPCA,
+                      linTracks[i].value().covarianceAtPCA);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,128 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+const GeometryIdentifier kGeometryId = GeometryIdentifier().setVolume(2);
+
+template <size_t kSize>
+void checkMeasurement(const ConstMeasurementProxy& proxy,
+                      const Acts::Measurement<BoundIndices, kSize>& reference) {
+  BOOST_CHECK_EQUAL(proxy.size(), kSize);
+  BOOST_CHECK_EQUAL(&proxy.sourceLink(), &reference.sourceLink());
+  for (uint8_t i = 0; i < eBoundSize; ++i) {
+    auto index = static_cast<BoundIndices>(i);
+    BOOST_CHECK_EQUAL(proxy.contains(index), reference.contains(index));
+  }
+  BOOST_CHECK_EQUAL(proxy.parameters(), reference.parameters());
+  BOOST_CHECK_EQUAL(proxy.covariance(), reference.covariance());
+
+  auto fixed = proxy.template fixedSize<kSize>();
+  BOOST_CHECK_EQUAL(&fixed.sourceLink(), &reference.sourceLink());
+  BOOST_CHECK_EQUAL(fixed.parameters(), reference.parameters());
+  BOOST_CHECK_EQUAL(fixed.covariance(), reference.covariance());
+  BOOST_CHECK_EQUAL(fixed.projector(), reference.projector());
+
+  size_t visitedSize = proxy.visit([](const auto& m) { return m.size(); });
+  BOOST_CHECK_EQUAL(visitedSize, kSize);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesMeasurementContainer)
+
+BOOST_AUTO_TEST_CASE(MixedSizes) {
+  std::vector<IndexSourceLink> sourceLinks = {
+      IndexSourceLink(kGeometryId, 0u),
+      IndexSourceLink(kGeometryId, 1u),
+      IndexSourceLink(kGeometryId, 2u),
+  };
+
+  ActsVector<1> par1(0.5);
+  ActsSymMatrix<1> cov1(0.01);
+  auto meas1 = makeMeasurement(sourceLinks[0], par1, cov1, eBoundLoc1);
+
+  ActsVector<3> par3(-1.0, 2.0, 10.0);
+  ActsSymMatrix<3> cov3;
+  cov3 << 0.01, 0.002, 0.0, 0.002, 0.04, 0.0, 0.0, 0.0, 1.0;
+  auto meas3 = makeMeasurement(sourceLinks[1], par3, cov3, eBoundLoc0,
+                               eBoundLoc1, eBoundTime);
+
+  BoundVector par6 = BoundVector::LinSpaced(1.0, 6.0);
+  BoundSymMatrix cov6 = BoundSymMatrix::Identity();
+  cov6(eBoundPhi, eBoundTheta) = cov6(eBoundTheta, eBoundPhi) = 0.1;
+  auto meas6 = makeMeasurement(sourceLinks[2], par6, cov6, eBoundLoc0,
+                               eBoundLoc1, eBoundPhi, eBoundTheta,
+                               eBoundQOverP, eBoundTime);
+
+  MeasurementContainer measurements;
+  BOOST_CHECK(measurements.empty());
+  measurements.reserve(3u);
+  measurements.push_back(meas1);
+  measurements.push_back(ActsExamples::Measurement(meas3));
+  measurements.push_back(meas6);
+  BOOST_CHECK_EQUAL(measurements.size(), 3u);
+
+  checkMeasurement(measurements[0], meas1);
+  checkMeasurement(measurements[1], meas3);
+  checkMeasurement(measurements.at(2), meas6);
+  BOOST_CHECK_THROW(measurements.at(3), std::out_of_range);
+
+  Index expected = 0u;
+  for (auto proxy : measurements) {
+    BOOST_CHECK_EQUAL(proxy.index(), expected);
+    BOOST_CHECK_EQUAL(
+        static_cast<const IndexSourceLink&>(proxy.sourceLink()).index(),
+        expected);
+    ++expected;
+  }
+  BOOST_CHECK_EQUAL(expected, 3u);
+
+  measurements.clear();
+  BOOST_CHECK(measurements.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Calibrator) {
+  IndexSourceLink sourceLink(kGeometryId, 0u);
+  ActsVector<2> par(0.1, -0.2);
+  ActsSymMatrix<2> cov = ActsSymMatrix<2>::Identity() * 0.25;
+  auto meas = makeMeasurement(sourceLink, par, cov, eBoundLoc0, eBoundTime);
+
+  MeasurementContainer measurements;
+  measurements.push_back(meas);
+  MeasurementCalibrator calibrator(measurements);
+
+  MultiTrajectory traj;
+  auto trackState = traj.getTrackState(traj.addTrackState());
+  trackState.setUncalibrated(sourceLink);
+  calibrator.calibrate(GeometryContext(), trackState);
+
+  BOOST_CHECK_EQUAL(trackState.calibratedSize(), 2u);
+  BOOST_CHECK_EQUAL(&trackState.calibratedSourceLink(), &sourceLink);
+  CHECK_CLOSE_ABS(trackState.effectiveCalibrated(), par, 1e-12);
+  CHECK_CLOSE_ABS(trackState.effectiveCalibratedCovariance(), cov, 1e-12);
+  BOOST_CHECK_EQUAL(trackState.effectiveProjector(), meas.projector());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/PhiloxEngine.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+std::vector<uint32_t> draw(RandomEngine& rng, size_t n) {
+  std::vector<uint32_t> values;
+  for (size_t i = 0; i < n; ++i) {
+    values.push_back(rng());
+  }
+  return values;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesRandomNumbers)
+
+// known answers from the Random123 reference implementation
+BOOST_AUTO_TEST_CASE(PhiloxKnownAnswers) {
+  using Block = std::array<uint32_t, 4>;
+  using Key = std::array<uint32_t, 2>;
+
+  BOOST_CHECK((PhiloxEngine::block({0u, 0u, 0u, 0u}, {0u, 0u}) ==
+               Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+  BOOST_CHECK((PhiloxEngine::block(
+                   {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                   Key{0xffffffffu, 0xffffffffu}) ==
+               Block{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+  BOOST_CHECK((PhiloxEngine::block(
+                   {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                   Key{0xa4093822u, 0x299f31d0u}) ==
+               Block{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+BOOST_AUTO_TEST_CASE(PhiloxEngineSequence) {
+  PhiloxEngine rng(0u);
+  auto values = draw(rng, 8);
+  auto first = PhiloxEngine::block({0u, 0u, 0u, 0u}, {0u, 0u});
+  auto second = PhiloxEngine::block({1u, 0u, 0u, 0u}, {0u, 0u});
+  for (size_t i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(values[i], first[i]);
+    BOOST_CHECK_EQUAL(values[4 + i], second[i]);
+  }
+
+  // reseeding restarts the sequence
+  rng.seed(0u);
+  BOOST_CHECK(draw(rng, 8) == values);
+  BOOST_CHECK(rng != PhiloxEngine(0u));
+}
+
+BOOST_AUTO_TEST_CASE(PhiloxEngineDiscard) {
+  for (unsigned long long n : {0ull, 1ull, 3ull, 4ull, 5ull, 17ull, 1000ull}) {
+    for (size_t offset : {0u, 1u, 3u}) {
+      PhiloxEngine sequential(123u, 4u);
+      PhiloxEngine skipped(123u, 4u);
+      draw(sequential, offset);
+      draw(skipped, offset);
+      for (unsigned long long i = 0; i < n; ++i) {
+        sequential();
+      }
+      skipped.discard(n);
+      BOOST_CHECK(sequential == skipped);
+      BOOST_CHECK(draw(sequential, 9) == draw(skipped, 9));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PhiloxEngineDistributions) {
+  PhiloxEngine rng(42u);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  double sum = 0.;
+  const size_t n = 100000;
+  for (size_t i = 0; i < n; ++i) {
+    double x = uniform(rng);
+    BOOST_CHECK_LE(0., x);
+    BOOST_CHECK_LT(x, 1.);
+    sum += x;
+  }
+  BOOST_CHECK_CLOSE(sum / n, 0.5, 1.);
+}
+
+BOOST_AUTO_TEST_CASE(SpawnGenerators) {
+  WhiteBoard store;
+  RandomNumbers::Config cfg;
+  RandomNumbers randomNumbers(cfg);
+
+  AlgorithmContext ctx(3, 7, store);
+  AlgorithmContext otherAlgorithm(4, 7, store);
+  AlgorithmContext otherEvent(3, 8, store);
+
+  // generators are reproducible
+  auto rng = randomNumbers.spawnGenerator(ctx);
+  auto reference = draw(rng, 16);
+  rng = randomNumbers.spawnGenerator(ctx);
+  BOOST_CHECK(draw(rng, 16) == reference);
+  // sub-entity zero is the algorithm-local generator
+  rng = randomNumbers.spawnGenerator(ctx, 0u);
+  BOOST_CHECK(draw(rng, 16) == reference);
+
+  // all others are different
+  rng = randomNumbers.spawnGenerator(otherAlgorithm);
+  BOOST_CHECK(draw(rng, 16) != reference);
+  rng = randomNumbers.spawnGenerator(otherEvent);
+  BOOST_CHECK(draw(rng, 16) != reference);
+  rng = randomNumbers.spawnGenerator(ctx, 1u);
+  BOOST_CHECK(draw(rng, 16) != reference);
+
+  // sub-entity generators do not depend on the order in which they are used
+  std::vector<std::vector<uint32_t>> forward;
+  for (uint64_t id = 1; id <= 8; ++id) {
+    auto subRng = randomNumbers.spawnGenerator(ctx, id);
+    forward.push_back(draw(subRng, 5));
+  }
+  for (uint64_t id = 8; 1 <= id; --id) {
+    auto subRng = randomNumbers.spawnGenerator(ctx, id);
+    BOOST_CHECK(draw(subRng, 5) == forward[id - 1]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2022 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Validation/TrackClassification.hpp"
+#include "ActsExamples/Validation/TruthMatchingIndex.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ActsExamples;
+using ActsFatras::Barcode;
+
+namespace {
+
+Barcode makeId(Barcode::Value vertex, Barcode::Value particle) {
+  return Barcode().setVertexPrimary(vertex).setParticle(particle);
+}
+
+SimParticleContainer makeParticles(const std::vector<Barcode>& ids) {
+  SimParticleContainer particles;
+  for (auto id : ids) {
+    particles.insert(ActsFatras::Particle(id, Acts::PdgParticle::eMuon));
+  }
+  return particles;
+}
+
+void checkHitCounts(const std::vector<ParticleHitCount>& result,
+                    const std::vector<ParticleHitCount>& reference) {
+  BOOST_CHECK_EQUAL(result.size(), reference.size());
+  for (size_t i = 0; i < std::min(result.size(), reference.size()); ++i) {
+    BOOST_CHECK_EQUAL(result[i].particleId, reference[i].particleId);
+    BOOST_CHECK_EQUAL(result[i].hitCount, reference[i].hitCount);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesTruthMatchingIndex)
+
+BOOST_AUTO_TEST_CASE(Association) {
+  const Barcode a = makeId(1, 1);
+  const Barcode b = makeId(1, 2);
+  const Barcode c = makeId(2, 1);
+  // only found via the hits
+  const Barcode d = makeId(3, 7);
+  auto particles = makeParticles({c, a, b});
+
+  IndexMultimap<Barcode> hitParticlesMap;
+  hitParticlesMap.emplace(0u, a);
+  hitParticlesMap.emplace(1u, a);
+  hitParticlesMap.emplace(1u, b);
+  hitParticlesMap.emplace(2u, d);
+  // hit 3 is a noise hit
+  hitParticlesMap.emplace(4u, b);
+  hitParticlesMap.emplace(5u, a);
+
+  TruthMatchingIndex index(particles, hitParticlesMap);
+  BOOST_CHECK_EQUAL(index.numParticles(), 4u);
+  BOOST_CHECK_EQUAL(index.numHits(), 6u);
+
+  // container particles use their container position
+  size_t position = 0;
+  for (const auto& particle : particles) {
+    auto ip = index.particleIndex(particle.particleId());
+    BOOST_CHECK_EQUAL(ip, position++);
+    BOOST_CHECK(index.isInContainer(ip));
+    BOOST_CHECK_EQUAL(index.particleId(ip), particle.particleId());
+  }
+  auto id = index.particleIndex(d);
+  BOOST_CHECK_EQUAL(id, 3u);
+  BOOST_CHECK(not index.isInContainer(id));
+  BOOST_CHECK_EQUAL(index.particleIndex(makeId(4, 1)),
+                    TruthMatchingIndex::kInvalidParticle);
+
+  BOOST_CHECK_EQUAL(index.hitParticles(0u).size(), 1u);
+  BOOST_CHECK_EQUAL(index.hitParticles(1u).size(), 2u);
+  BOOST_CHECK(index.hitParticles(3u).empty());
+  BOOST_CHECK(index.hitParticles(6u).empty());
+  BOOST_CHECK_EQUAL(*index.hitParticles(2u).begin(), id);
+
+  BOOST_CHECK_EQUAL(index.numParticleHits(index.particleIndex(a)), 3u);
+  BOOST_CHECK_EQUAL(index.numParticleHits(index.particleIndex(b)), 2u);
+  BOOST_CHECK_EQUAL(index.numParticleHits(index.particleIndex(c)), 0u);
+  BOOST_CHECK_EQUAL(index.numParticleHits(id), 1u);
+
+  // classification must be identical to the free function; also repeated
+  // calls must not see counts from previous calls
+  std::vector<ParticleHitCount> result;
+  std::vector<ParticleHitCount> reference;
+  for (const ProtoTrack& track : std::vector<ProtoTrack>{
+           {0u, 1u, 2u, 3u, 4u, 5u}, {4u, 1u}, {3u}, {2u, 2u, 0u}}) {
+    index.identifyContributingParticles(track, result);
+    identifyContributingParticles(hitParticlesMap, track, reference);
+    checkHitCounts(result, reference);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ManyParticlesOutsideContainer) {
+  auto particles = makeParticles({makeId(1, 1)});
+
+  IndexMultimap<Barcode> hitParticlesMap;
+  for (Index hit = 0; hit < 1000u; ++hit) {
+    hitParticlesMap.emplace(hit, makeId(2, 1 + hit / 2));
+  }
+
+  TruthMatchingIndex index(particles, hitParticlesMap);
+  BOOST_CHECK_EQUAL(index.numParticles(), 501u);
+  for (Index hit = 0; hit < 1000u; ++hit) {
+    auto ip = index.particleIndex(makeId(2, 1 + hit / 2));
+    BOOST_CHECK_EQUAL(ip, 1u + hit / 2);
+    BOOST_CHECK_EQUAL(*index.hitParticles(hit).begin(), ip);
+    BOOST_CHECK_EQUAL(index.numParticleHits(ip), 2u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Empty) {
+  TruthMatchingIndex index(SimParticleContainer{}, IndexMultimap<Barcode>{});
+  BOOST_CHECK_EQUAL(index.numParticles(), 0u);
+  BOOST_CHECK_EQUAL(index.numHits(), 0u);
+  BOOST_CHECK_EQUAL(index.particleIndex(makeId(1, 1)),
+                    TruthMatchingIndex::kInvalidParticle);
+
+  std::vector<ParticleHitCount> result;
+  index.identifyContributingParticles(ProtoTrack{0u, 1u}, result);
+  BOOST_CHECK(result.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()